@@ -0,0 +1,358 @@
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+
+#include "Doom/Demo.hpp"
+#include "Doom/Doom.hpp"
+#include "Doom/Thing/PlayerThing.hpp"
+#include "System/Utilities.hpp"
+
+const std::uint32_t DOOM::Demo::Magic = 0x4D444743;   // "CGDM"
+const std::uint32_t DOOM::Demo::Version = 1;          // First version
+const unsigned int  DOOM::Demo::ChecksumInterval = 35; // One checksum per second
+
+DOOM::Demo::Demo() :
+  _mode(DOOM::Demo::Mode::ModeNone),
+  _path(),
+  _seed(0),
+  _game(0),
+  _skill(0),
+  _level(0, 0),
+  _controllers(),
+  _inputs(),
+  _checksums(),
+  _tic(0),
+  _elapsed(0.f),
+  _desync(0)
+{}
+
+DOOM::Demo::~Demo()
+{
+  // Save pending recording
+  stop();
+}
+
+void  DOOM::Demo::record(DOOM::Doom& doom, const std::filesystem::path& path)
+{
+  // Cancel if no level loaded
+  if (doom.level.episode == std::pair<std::uint8_t, std::uint8_t>{ 0, 0 })
+    throw std::runtime_error((std::string(__FILE__) + ": l." + std::to_string(__LINE__)).c_str());
+
+  // Stop previous demo
+  stop();
+
+  // Demo header
+  _path = path;
+  _seed = (std::uint32_t)std::time(nullptr);
+  _game = (std::uint8_t)doom.mode;
+  _skill = (std::uint8_t)doom.skill;
+  _level = doom.level.episode;
+  _controllers.clear();
+  for (const auto& player : doom.level.players)
+    _controllers.push_back((std::uint8_t)player.get().controller);
+
+  // Reset recording
+  _inputs.clear();
+  _checksums.clear();
+
+  // Restart level
+  start(doom);
+
+  _mode = DOOM::Demo::Mode::ModeRecord;
+}
+
+void  DOOM::Demo::play(DOOM::Doom& doom, const std::filesystem::path& path)
+{
+  // Stop previous demo
+  stop();
+
+  // Load demo file
+  load(path);
+
+  // Check game compatibility
+  if (_game != (std::uint8_t)doom.mode)
+    throw std::runtime_error((std::string(__FILE__) + ": l." + std::to_string(__LINE__)).c_str());
+
+  // Register missing players
+  for (auto controller : _controllers)
+    doom.addPlayer(controller);
+
+  // Players must match the recording
+  if (doom.level.players.size() != _controllers.size())
+    throw std::runtime_error((std::string(__FILE__) + ": l." + std::to_string(__LINE__)).c_str());
+
+  // Restart level
+  doom.skill = (DOOM::Enum::Skill)_skill;
+  start(doom);
+
+  _mode = DOOM::Demo::Mode::ModePlayback;
+}
+
+void  DOOM::Demo::stop()
+{
+  // Save recorded demo
+  if (_mode == DOOM::Demo::Mode::ModeRecord)
+    save();
+
+  // Report desynchronizations
+  if (_mode == DOOM::Demo::Mode::ModePlayback && _desync > 0)
+    std::cerr << "[DOOM::Demo] Warning, " << _desync << " desynchronization(s) detected in '" << _path << "'." << std::endl;
+
+  _mode = DOOM::Demo::Mode::ModeNone;
+}
+
+void  DOOM::Demo::start(DOOM::Doom& doom)
+{
+  // Reset random generator
+  std::srand(_seed);
+
+  // Hard reset of level and players
+  doom.setLevel(_level, true);
+
+  // Reset counters
+  _tic = 0;
+  _elapsed = 0.f;
+  _desync = 0;
+}
+
+void  DOOM::Demo::load(const std::filesystem::path& path)
+{
+  std::ifstream file(path, std::ifstream::binary);
+
+  // Check if file open properly
+  if (file.good() == false)
+    throw std::runtime_error((std::string(__FILE__) + ": l." + std::to_string(__LINE__)).c_str());
+
+  std::uint32_t magic, version, count;
+  std::uint8_t  players;
+
+  // Check file signature and version
+  Game::Utilities::read<std::uint32_t>(file, &magic);
+  Game::Utilities::read<std::uint32_t>(file, &version);
+  if (magic != DOOM::Demo::Magic || version != DOOM::Demo::Version)
+    throw std::runtime_error((std::string(__FILE__) + ": l." + std::to_string(__LINE__)).c_str());
+
+  // Demo header
+  Game::Utilities::read<std::uint32_t>(file, &_seed);
+  Game::Utilities::read<std::uint8_t>(file, &_game);
+  Game::Utilities::read<std::uint8_t>(file, &_skill);
+  Game::Utilities::read<std::uint8_t>(file, &_level.first);
+  Game::Utilities::read<std::uint8_t>(file, &_level.second);
+  Game::Utilities::read<std::uint8_t>(file, &players);
+  if (players == 0)
+    throw std::runtime_error((std::string(__FILE__) + ": l." + std::to_string(__LINE__)).c_str());
+  _controllers.resize(players);
+  Game::Utilities::read<std::uint8_t>(file, _controllers.data(), _controllers.size());
+
+  // Inputs of each tic
+  Game::Utilities::read<std::uint32_t>(file, &count);
+  _inputs.resize((std::size_t)count * players);
+  for (auto& input : _inputs) {
+    Game::Utilities::read<std::int8_t>(file, &input.horizontal);
+    Game::Utilities::read<std::int8_t>(file, &input.vertical);
+    Game::Utilities::read<std::int8_t>(file, &input.forward);
+    Game::Utilities::read<std::int8_t>(file, &input.strafe);
+    Game::Utilities::read<std::int8_t>(file, &input.weapon);
+    Game::Utilities::read<std::uint16_t>(file, &input.down);
+    Game::Utilities::read<std::uint16_t>(file, &input.pressed);
+  }
+
+  // State checksums
+  Game::Utilities::read<std::uint32_t>(file, &count);
+  _checksums.resize(count);
+  Game::Utilities::read<std::uint64_t>(file, _checksums.data(), _checksums.size());
+
+  _path = path;
+}
+
+void  DOOM::Demo::save() const
+{
+  std::ofstream file(_path, std::ofstream::binary | std::ofstream::trunc);
+
+  // Check if file open properly
+  if (file.good() == false) {
+    std::cerr << "[DOOM::Demo] Warning, failed to open '" << _path << "'." << std::endl;
+    return;
+  }
+
+  std::uint32_t count;
+  std::uint8_t  players = (std::uint8_t)_controllers.size();
+
+  // Demo header
+  file.write((const char*)&DOOM::Demo::Magic, sizeof(DOOM::Demo::Magic));
+  file.write((const char*)&DOOM::Demo::Version, sizeof(DOOM::Demo::Version));
+  file.write((const char*)&_seed, sizeof(_seed));
+  file.write((const char*)&_game, sizeof(_game));
+  file.write((const char*)&_skill, sizeof(_skill));
+  file.write((const char*)&_level.first, sizeof(_level.first));
+  file.write((const char*)&_level.second, sizeof(_level.second));
+  file.write((const char*)&players, sizeof(players));
+  file.write((const char*)_controllers.data(), _controllers.size());
+
+  // Inputs of each tic (only full tics)
+  count = (std::uint32_t)(players > 0 ? _inputs.size() / players : 0);
+  file.write((const char*)&count, sizeof(count));
+  for (std::size_t index = 0; index < (std::size_t)count * players; index++) {
+    file.write((const char*)&_inputs[index].horizontal, sizeof(_inputs[index].horizontal));
+    file.write((const char*)&_inputs[index].vertical, sizeof(_inputs[index].vertical));
+    file.write((const char*)&_inputs[index].forward, sizeof(_inputs[index].forward));
+    file.write((const char*)&_inputs[index].strafe, sizeof(_inputs[index].strafe));
+    file.write((const char*)&_inputs[index].weapon, sizeof(_inputs[index].weapon));
+    file.write((const char*)&_inputs[index].down, sizeof(_inputs[index].down));
+    file.write((const char*)&_inputs[index].pressed, sizeof(_inputs[index].pressed));
+  }
+
+  // State checksums
+  count = (std::uint32_t)_checksums.size();
+  file.write((const char*)&count, sizeof(count));
+  file.write((const char*)_checksums.data(), _checksums.size() * sizeof(std::uint64_t));
+
+  // Check for success
+  if (file.good() == false) {
+    std::cerr << "[DOOM::Demo] Warning, failed to write '" << _path << "'." << std::endl;
+    return;
+  }
+}
+
+unsigned int  DOOM::Demo::tics(float elapsed)
+{
+  unsigned int  tics = 0;
+
+  // Accumulate time and extract complete tics
+  for (_elapsed += elapsed; _elapsed >= DOOM::Doom::Tic; _elapsed -= DOOM::Doom::Tic)
+    tics += 1;
+
+  return tics;
+}
+
+void  DOOM::Demo::input(int id, DOOM::Demo::Input& input)
+{
+  // Index of player input in current tic
+  std::size_t index = _tic * _controllers.size() + (id - 1);
+
+  // Invalid player
+  if (id < 1 || id > (int)_controllers.size())
+    return;
+
+  // Record player input
+  if (_mode == DOOM::Demo::Mode::ModeRecord) {
+    if (_inputs.size() <= index)
+      _inputs.resize(index + 1, DOOM::Demo::Input{ .horizontal = 0, .vertical = 0, .forward = 0, .strafe = 0, .weapon = -1, .down = 0, .pressed = 0 });
+    _inputs[index] = input;
+  }
+
+  // Replay player input
+  else if (_mode == DOOM::Demo::Mode::ModePlayback) {
+    if (index < _inputs.size())
+      input = _inputs[index];
+    else
+      input = DOOM::Demo::Input{ .horizontal = 0, .vertical = 0, .forward = 0, .strafe = 0, .weapon = -1, .down = 0, .pressed = 0 };
+  }
+}
+
+void  DOOM::Demo::update(const DOOM::Doom& doom)
+{
+  // Next tic
+  _tic += 1;
+
+  // Checksum only at fixed interval
+  if (_tic % DOOM::Demo::ChecksumInterval != 0)
+    return;
+
+  std::size_t index = _tic / DOOM::Demo::ChecksumInterval - 1;
+
+  // Record state checksum
+  if (_mode == DOOM::Demo::Mode::ModeRecord)
+    _checksums.push_back(checksum(doom));
+
+  // Check state checksum
+  else if (_mode == DOOM::Demo::Mode::ModePlayback && index < _checksums.size() && _checksums[index] != checksum(doom)) {
+    if (_desync == 0)
+      std::cerr << "[DOOM::Demo] Warning, desynchronization at tic " << _tic << "." << std::endl;
+    _desync += 1;
+  }
+}
+
+DOOM::Demo::Mode  DOOM::Demo::mode() const
+{
+  // Get current demo mode
+  return _mode;
+}
+
+std::size_t DOOM::Demo::tic() const
+{
+  // Get current tic
+  return _tic;
+}
+
+bool  DOOM::Demo::end() const
+{
+  // Playback is over when every recorded tic has been replayed
+  return _mode == DOOM::Demo::Mode::ModePlayback && _tic >= _inputs.size() / _controllers.size();
+}
+
+std::uint64_t DOOM::Demo::checksum(const DOOM::Doom& doom)
+{
+  std::uint64_t hash = 0xCBF29CE484222325;
+
+  // FNV-1a hash of raw bytes
+  auto  accumulate = [&hash](const void* data, std::size_t size) {
+    for (std::size_t index = 0; index < size; index++)
+      hash = (hash ^ ((const std::uint8_t*)data)[index]) * 0x00000100000001B3;
+    };
+
+  // Things position, orientation and health
+  for (const auto& thing : doom.level.things) {
+    accumulate(&thing->position.x(), sizeof(float));
+    accumulate(&thing->position.y(), sizeof(float));
+    accumulate(&thing->position.z(), sizeof(float));
+    accumulate(&thing->angle, sizeof(float));
+    accumulate(&thing->health, sizeof(float));
+  }
+
+  // Sectors floor and ceiling heights
+  for (const auto& sector : doom.level.sectors) {
+    accumulate(&sector.floor_current, sizeof(float));
+    accumulate(&sector.ceiling_current, sizeof(float));
+  }
+
+  return hash;
+}
+
+void  DOOM::Demo::benchmark(const std::filesystem::path& wad, const std::filesystem::path& demo)
+{
+  DOOM::Doom  doom;
+  DOOM::Demo  header;
+
+  // Get game mode from demo header
+  header.load(demo);
+
+  // Load WAD and start playback
+  doom.load(wad, (DOOM::Enum::Mode)header._game);
+  doom.demo.play(doom, demo);
+
+  auto  start = std::chrono::steady_clock::now();
+
+  // Simulate every tic of the demo as fast as possible
+  while (doom.demo.end() == false) {
+    doom.resources.update(doom, DOOM::Doom::Tic);
+    doom.level.update(doom, DOOM::Doom::Tic);
+    doom.demo.update(doom);
+  }
+
+  auto  duration = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  // Report simulation throughput
+  std::cout
+    << "[DOOM::Demo] " << demo.filename().string() << ": "
+    << doom.demo.tic() << " tics in " << duration << "s, "
+    << (duration > 0. ? doom.demo.tic() / duration : 0.) << " tics/s, "
+    << "checksum " << std::hex << checksum(doom) << std::dec << ", "
+    << doom.demo._desync << " desync(s)." << std::endl;
+
+  doom.demo.stop();
+}
\ No newline at end of file
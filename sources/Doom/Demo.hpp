@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <utility>
+#include <vector>
+
+namespace DOOM
+{
+  class Doom;
+
+  class Demo
+  {
+  public:
+    static const std::uint32_t  Magic;            // Demo file signature ("CGDM")
+    static const std::uint32_t  Version;          // Demo file format version
+    static const unsigned int   ChecksumInterval; // Number of tics between two state checksums
+
+    enum Mode
+    {
+      ModeNone,     // No demo, inputs are read from controllers
+      ModeRecord,   // Inputs are read from controllers and recorded
+      ModePlayback  // Inputs are replayed from demo
+    };
+
+    struct Input
+    {
+      std::int8_t   horizontal; // Horizontal turning [-127, +127]
+      std::int8_t   vertical;   // Vertical turning [-127, +127]
+      std::int8_t   forward;    // Forward/backward movement [-127, +127]
+      std::int8_t   strafe;     // Left/right strafe movement [-127, +127]
+      std::int8_t   weapon;     // Weapon slot selected this tic (-1 if none)
+      std::uint16_t down;       // Bitfield of controls held down
+      std::uint16_t pressed;    // Bitfield of controls pressed this tic
+    };
+
+  private:
+    Mode                                  _mode;        // Current demo mode
+    std::filesystem::path                 _path;        // Path of demo file
+    std::uint32_t                         _seed;        // Random seed at start of demo
+    std::uint8_t                          _game;        // Game mode (DOOM::Enum::Mode)
+    std::uint8_t                          _skill;       // Skill level (DOOM::Enum::Skill)
+    std::pair<std::uint8_t, std::uint8_t> _level;       // Level episode and mission
+    std::vector<std::uint8_t>             _controllers; // Controller of each player
+    std::vector<DOOM::Demo::Input>        _inputs;      // Inputs of every player for each tic
+    std::vector<std::uint64_t>            _checksums;   // State checksums, every ChecksumInterval tics
+    std::size_t                           _tic;         // Current tic
+    float                                 _elapsed;     // Time not yet simulated
+    unsigned int                          _desync;      // Number of checksum mismatches in playback
+
+    void  load(const std::filesystem::path& path);  // Load demo from file
+    void  save() const;                             // Save recorded demo to file
+    void  start(DOOM::Doom& doom);                  // Reset random seed and level to initial state
+
+  public:
+    Demo();
+    ~Demo();
+
+    void  record(DOOM::Doom& doom, const std::filesystem::path& path); // Restart current level and record inputs
+    void  play(DOOM::Doom& doom, const std::filesystem::path& path);   // Restart recorded level and replay inputs
+    void  stop();                                                     // Stop demo, save it when recording
+
+    unsigned int  tics(float elapsed);              // Number of fixed tics to simulate for elapsed time
+    void          input(int id, Input& input);      // Record or replay input of player for current tic
+    void          update(const DOOM::Doom& doom);   // End of tic, record or check state checksum
+
+    DOOM::Demo::Mode  mode() const;   // Get current demo mode
+    std::size_t       tic() const;    // Get current tic
+    bool              end() const;    // True when playback is over
+
+    static std::uint64_t  checksum(const DOOM::Doom& doom); // Compute checksum of level state (things position and health, sectors heights)
+
+    static void benchmark(const std::filesystem::path& wad, const std::filesystem::path& demo); // Headless playback of demo at maximum speed, report tics per second
+  };
+}
\ No newline at end of file
@@ -1,3 +1,10 @@
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <iostream>
+#include <sstream>
+#include <unordered_map>
+
 #include "Doom/Doom.hpp"
 #include "Doom/Action/BlinkLightingAction.hpp"
 #include "Doom/Action/DoorLevelingAction.hpp"
@@ -127,6 +134,7 @@ const std::array<DOOM::Doom::Resources::Sound::SoundInfo, DOOM::Doom::Resources:
 DOOM::Doom::Resources::Texture const  DOOM::Doom::Resources::Texture::Null = DOOM::Doom::Resources::Texture();
 
 DOOM::Doom::Doom() :
+  _levelBuild(),
   wad(),
   resources(),
   level(),
@@ -136,9 +144,16 @@ DOOM::Doom::Doom() :
   sfx(0.125f),
   music(1.f),
   message(true),
-  image()
+  image(),
+  demo()
 {}
 
+DOOM::Doom::~Doom()
+{
+  // Level built in background reference this instance
+  buildLevelWait();
+}
+
 void  DOOM::Doom::load(const std::filesystem::path& path, DOOM::Enum::Mode mode)
 {
   // Clear resources
@@ -156,9 +171,30 @@ void  DOOM::Doom::load(const std::filesystem::path& path, DOOM::Enum::Mode mode)
 
 void  DOOM::Doom::update(float elapsed)
 {
+  // Read controls pressed this frame, once whatever the number of tics
+  for (auto& player : level.players)
+    player.get().poll();
+
   // Update components
-  resources.update(*this, elapsed);
-  level.update(*this, elapsed);
+  if (demo.mode() == DOOM::Demo::Mode::ModeNone) {
+    resources.update(*this, elapsed);
+    level.update(*this, elapsed);
+  }
+
+  // Demo recorded or played back at a fixed tic rate
+  else {
+    for (unsigned int tics = demo.tics(elapsed); tics > 0; tics--) {
+      resources.update(*this, DOOM::Doom::Tic);
+      level.update(*this, DOOM::Doom::Tic);
+      demo.update(*this);
+
+      // Stop at end of playback
+      if (demo.end() == true) {
+        demo.stop();
+        break;
+      }
+    }
+  }
 
   // Sound centered on the player in single player
   if (level.players.size() == 1) {
@@ -198,14 +234,56 @@ std::list<std::pair<std::uint8_t, std::uint8_t>>  DOOM::Doom::getLevels() const
 
 void  DOOM::Doom::setLevel(std::pair<std::uint8_t, std::uint8_t> level, bool reset)
 {
+  // A demo only covers a single level
+  demo.stop();
+
+  bool  preloaded = false;
+
+  // Get level preloaded in background, a failed build is done again below
+  if (_levelBuild.valid() == true && this->level.episode == level) {
+    try {
+      _levelBuild.get();
+      preloaded = true;
+    }
+    catch (const std::exception& e) {
+      std::cerr << "[DOOM::Doom] Warning, failed to build level (" << (int)level.first << ", " << (int)level.second << ") in background (" << e.what() << ")." << std::endl;
+    }
+  }
+
+  // Complete preloaded level on main thread
+  if (preloaded == true) {
+    buildLevelActions();
+
+    // Update components (might be useful for initializations)
+    this->level.update(*this, 0.f);
+  }
+
   // Build level
-  buildLevel(level);
+  else {
+    buildLevelWait();
+    buildLevel(level);
+  }
 
   // Reset players
   for (const auto& player : this->level.players)
     player.get().reset(*this, reset);
 }
 
+void  DOOM::Doom::preloadLevel(std::pair<std::uint8_t, std::uint8_t> level)
+{
+  // A demo only covers a single level
+  demo.stop();
+
+  // Discard previous preloading
+  buildLevelWait();
+
+  // Remove old level and set base info in main thread, so level is identified while building
+  buildLevelBase(level);
+
+  // Build components in background
+  _levelBuild = std::async(std::launch::async, [this]() { buildLevelComponents(); });
+}
+
 void  DOOM::Doom::addPlayer(int controller)
 {
   // Cancel if invalid controller id
@@ -301,6 +379,9 @@ void  DOOM::Doom::sound(Game::Audio::Sound::Reference& ref, DOOM::Doom::Resource
 
 void  DOOM::Doom::clear()
 {
+  // Level built in background reference resources
+  buildLevelWait();
+
   // Clear resources and current level
   clearResources();
   clearLevel();
@@ -344,6 +425,7 @@ void  DOOM::Doom::clearLevel()
   level.nodes.clear();
   level.sectors.clear();
   level.blockmap = DOOM::Doom::Level::Blockmap();
+  level.adjacency = DOOM::Doom::Level::Adjacency();
   level.statistics = DOOM::Doom::Level::Statistics();
 }
 
@@ -490,6 +572,19 @@ void  DOOM::Doom::buildResourcesSounds()
 }
 
 void  DOOM::Doom::buildLevel(const std::pair<std::uint8_t, uint8_t>& level)
+{
+  // Remove old level and set base info
+  buildLevelBase(level);
+
+  // Build every component of level
+  buildLevelComponents();
+  buildLevelActions();
+
+  // Update components (might be useful for initializations)
+  this->level.update(*this, 0.f);
+}
+
+void  DOOM::Doom::buildLevelBase(const std::pair<std::uint8_t, uint8_t>& level)
 {
   // Remove old level
   clearLevel();
@@ -515,20 +610,36 @@ void  DOOM::Doom::buildLevel(const std::pair<std::uint8_t, uint8_t>& level)
     else
       this->level.sky = std::cref(resources.textures.find(Game::Utilities::str_to_key<std::uint64_t>("SKY3"))->second);
   }
+}
 
-  // Build every component of resources
+void  DOOM::Doom::buildLevelComponents()
+{
+  const std::array<std::pair<const char*, void (DOOM::Doom::*)()>, 11> stages = {
+    std::pair<const char*, void (DOOM::Doom::*)()>("vertexes", &DOOM::Doom::buildLevelVertexes),
+    std::pair<const char*, void (DOOM::Doom::*)()>("adjacency", &DOOM::Doom::buildLevelAdjacency),
+    std::pair<const char*, void (DOOM::Doom::*)()>("sectors", &DOOM::Doom::buildLevelSectors),
+    std::pair<const char*, void (DOOM::Doom::*)()>("linedefs", &DOOM::Doom::buildLevelLinedefs),
+    std::pair<const char*, void (DOOM::Doom::*)()>("sidedefs", &DOOM::Doom::buildLevelSidedefs),
+    std::pair<const char*, void (DOOM::Doom::*)()>("subsectors", &DOOM::Doom::buildLevelSubsectors),
+    std::pair<const char*, void (DOOM::Doom::*)()>("segments", &DOOM::Doom::buildLevelSegments),
+    std::pair<const char*, void (DOOM::Doom::*)()>("nodes", &DOOM::Doom::buildLevelNodes),
+    std::pair<const char*, void (DOOM::Doom::*)()>("blockmap", &DOOM::Doom::buildLevelBlockmap),
+    std::pair<const char*, void (DOOM::Doom::*)()>("things", &DOOM::Doom::buildLevelThings),
+    std::pair<const char*, void (DOOM::Doom::*)()>("statistics", &DOOM::Doom::buildLevelStatistics)
+  };
+
+  std::ostringstream  report;
+  sf::Clock           total;
+
+  // Build every component of level, in order
   try
   {
-    buildLevelVertexes();
-    buildLevelSectors();
-    buildLevelLinedefs();
-    buildLevelSidedefs();
-    buildLevelSubsectors();
-    buildLevelSegments();
-    buildLevelNodes();
-    buildLevelBlockmap();
-    buildLevelThings();
-    buildLevelStatistics();
+    for (const auto& stage : stages) {
+      sf::Clock clock;
+
+      std::invoke(stage.second, this);
+      report << " " << stage.first << " " << clock.getElapsedTime().asMicroseconds() / 1000.f << "ms,";
+    }
   }
   catch (const std::exception& e)
   {
@@ -536,8 +647,24 @@ void  DOOM::Doom::buildLevel(const std::pair<std::uint8_t, uint8_t>& level)
     throw std::runtime_error(e.what());
   }
 
-  // Update components (might be useful for initializations)
-  this->level.update(*this, 0.f);
+  // Report build time of each stage
+  std::cout << "[DOOM::Doom] Level (" << (int)level.episode.first << ", " << (int)level.episode.second << ") built in " << total.getElapsedTime().asMicroseconds() / 1000.f << "ms:" << report.str().substr(0, report.str().length() - 1) << "." << std::endl;
+}
+
+void  DOOM::Doom::buildLevelActions()
+{
+  // Push actions of sector specials
+  for (auto& sector : level.sectors)
+    sector.start(*this);
+}
+
+void  DOOM::Doom::buildLevelWait()
+{
+  // Wait for end of background build, ignoring its errors
+  if (_levelBuild.valid() == true) {
+    _levelBuild.wait();
+    _levelBuild = std::future<void>();
+  }
 }
 
 void  DOOM::Doom::buildLevelVertexes()
@@ -547,6 +674,12 @@ void  DOOM::Doom::buildLevelVertexes()
     level.vertexes.emplace_back(*this, vertex);
 }
 
+void  DOOM::Doom::buildLevelAdjacency()
+{
+  // Build sectors adjacency from WAD, before sectors as they reference it
+  level.adjacency = DOOM::Doom::Level::Adjacency(wad.levels[level.episode]);
+}
+
 void  DOOM::Doom::buildLevelSectors()
 {
   // Load level's sectors from WAD
@@ -1153,7 +1286,8 @@ DOOM::Doom::Level::Level() :
   subsectors(),
   nodes(),
   sectors(),
-  blockmap()
+  blockmap(),
+  adjacency()
 {}
 
 DOOM::Doom::Level::Vertex::Vertex(DOOM::Doom& doom, const DOOM::Wad::RawLevel::Vertex& vertex) :
@@ -1399,6 +1533,8 @@ DOOM::Doom::Level::Node::Node(DOOM::Doom& doom, const DOOM::Wad::RawLevel::Node&
 }
 
 DOOM::Doom::Level::Blockmap::Blockmap(DOOM::Doom& doom, const DOOM::Wad::RawLevel::Blockmap& blockmap) :
+  _linedefs(),
+  _things(),
   x(blockmap.x),
   y(blockmap.y),
   column(blockmap.column),
@@ -1493,6 +1629,46 @@ void  DOOM::Doom::Level::Blockmap::removeThing(DOOM::AbstractThing& thing, const
       blocks[index].things.erase(std::ref(thing));
 }
 
+std::pair<std::span<const std::int16_t>, std::span<const std::reference_wrapper<DOOM::AbstractThing>>> DOOM::Doom::Level::Blockmap::gather(const Math::Vector<2>& position, const Math::Vector<2>& movement, float radius)
+{
+  // Reuse buffers of previous blocks
+  _linedefs.clear();
+  _things.clear();
+
+  // Get blockmap index at current and target position, using the four corners
+  std::array<int, 8> indexes = {
+    index(Math::Vector<2>(position.x() - radius, position.y() - radius)),
+    index(Math::Vector<2>(position.x() - radius, position.y() + radius)),
+    index(Math::Vector<2>(position.x() + radius, position.y() - radius)),
+    index(Math::Vector<2>(position.x() + radius, position.y() + radius)),
+    index(Math::Vector<2>(position.x() + movement.x() - radius, position.y() + movement.y() - radius)),
+    index(Math::Vector<2>(position.x() + movement.x() - radius, position.y() + movement.y() + radius)),
+    index(Math::Vector<2>(position.x() + movement.x() + radius, position.y() + movement.y() - radius)),
+    index(Math::Vector<2>(position.x() + movement.x() + radius, position.y() + movement.y() + radius))
+  };
+
+  // Ignore blocks listed twice
+  std::sort(indexes.begin(), indexes.end());
+  auto  indexes_end = std::unique(indexes.begin(), indexes.end());
+
+  // Get linedefs and things of every block
+  for (auto iterator = indexes.begin(); iterator != indexes_end; iterator++)
+    if (*iterator != -1) {
+      const DOOM::Doom::Level::Blockmap::Block& block = blocks[*iterator];
+
+      _linedefs.insert(_linedefs.end(), block.linedefs.begin(), block.linedefs.end());
+      _things.insert(_things.end(), block.things.begin(), block.things.end());
+    }
+
+  // Remove duplicates, keeping linedefs and things sorted so collisions are resolved in a stable order
+  std::sort(_linedefs.begin(), _linedefs.end());
+  _linedefs.erase(std::unique(_linedefs.begin(), _linedefs.end()), _linedefs.end());
+  std::sort(_things.begin(), _things.end());
+  _things.erase(std::unique(_things.begin(), _things.end(), [](const std::reference_wrapper<DOOM::AbstractThing>& left, const std::reference_wrapper<DOOM::AbstractThing>& right) { return &left.get() == &right.get(); }), _things.end());
+
+  return { _linedefs, _things };
+}
+
 DOOM::Doom::Level::Sector::Sector(DOOM::Doom& doom, const DOOM::Wad::RawLevel::Sector& sector) :
   floor_name(sector.floor_texture),
   ceiling_name(sector.ceiling_texture),
@@ -1521,14 +1697,55 @@ DOOM::Doom::Level::Sector::Sector(DOOM::Doom& doom, const DOOM::Wad::RawLevel::S
   // Index of this sector
   std::int16_t index = (int16_t)doom.level.sectors.size();
 
-  // Compute neighbor sectors
-  for (const DOOM::Wad::RawLevel::Linedef& linedef : doom.wad.levels.find(doom.level.episode)->second.linedefs) {
-    if (doom.wad.levels.find(doom.level.episode)->second.sidedefs[linedef.front].sector == index && linedef.back != -1)
-      _neighbors.insert(doom.wad.levels.find(doom.level.episode)->second.sidedefs[linedef.back].sector);
-    if (linedef.back != -1 && doom.wad.levels.find(doom.level.episode)->second.sidedefs[linedef.back].sector == index)
-      _neighbors.insert(doom.wad.levels.find(doom.level.episode)->second.sidedefs[linedef.front].sector);
+  // Get neighbor sectors from level adjacency
+  _neighbors = doom.level.adjacency[index];
+
+  // Damage and secrets of specials, actions are pushed by start
+  switch (this->special)
+  {
+  case DOOM::Doom::Level::Sector::Special::Damage20Blink05:
+  case DOOM::Doom::Level::Sector::Special::Damage20:
+    damage = 20.f;
+    break;
+  case DOOM::Doom::Level::Sector::Special::Damage10:
+    damage = 10.f;
+    break;
+  case DOOM::Doom::Level::Sector::Special::Damage5:
+    damage = 5.f;
+    break;
+  case DOOM::Doom::Level::Sector::Special::Secret:
+    doom.level.statistics.total.secrets += 1;
+    break;
+
+  default:
+    break;
   }
+}
+
+DOOM::Doom::Level::Sector::Sector(DOOM::Doom::Level::Sector&& sector) :
+  floor_name(sector.floor_name),
+  ceiling_name(sector.ceiling_name),
+  floor_flat(sector.floor_flat),
+  ceiling_flat(sector.ceiling_flat),
+  light_current(sector.light_current), light_base(sector.light_base),
+  floor_current(sector.floor_current), floor_base(sector.floor_base),
+  ceiling_current(sector.ceiling_current), ceiling_base(sector.ceiling_base),
+  damage(sector.damage),
+  tag(sector.tag),
+  special(sector.special),
+  sound_target(sector.sound_target),
+  _neighbors(std::move(sector._neighbors)),
+  _actions(std::move(sector._actions))
+{}
 
+std::unique_ptr<DOOM::AbstractAction> DOOM::Doom::Level::Sector::_factory(DOOM::Doom& doom, DOOM::Doom::Level::Sector& sector, std::int16_t type, std::int16_t model)
+{
+  // Just a relay (cycling inclusion problem)
+  return DOOM::AbstractAction::factory(doom, sector, type, model);
+}
+
+void  DOOM::Doom::Level::Sector::start(DOOM::Doom& doom)
+{
   // Push action for specific specials
   switch (this->special)
   {
@@ -1545,20 +1762,10 @@ DOOM::Doom::Level::Sector::Sector(DOOM::Doom& doom, const DOOM::Wad::RawLevel::S
     break;
   case DOOM::Doom::Level::Sector::Special::Damage20Blink05:
     action<DOOM::Doom::Level::Sector::Action::Lighting>(std::make_unique<DOOM::BlinkLightingAction<15, 5, false>>(doom, *this));
-    damage = 20.f;
-    break;
-  case DOOM::Doom::Level::Sector::Special::Damage10:
-    damage = 10.f;
-    break;
-  case DOOM::Doom::Level::Sector::Special::Damage5:
-    damage = 5.f;
     break;
   case DOOM::Doom::Level::Sector::Special::LightOscillates:
     action<DOOM::Doom::Level::Sector::Action::Lighting>(std::make_unique<DOOM::OscillateLightingAction<>>(doom, *this));
     break;
-  case DOOM::Doom::Level::Sector::Special::Secret:
-    doom.level.statistics.total.secrets += 1;
-    break;
   case DOOM::Doom::Level::Sector::Special::DoorClose:
     action<DOOM::Doom::Level::Sector::Action::Leveling>(std::make_unique<DOOM::DoorLevelingAction<DOOM::EnumAction::Door::DoorWaitClose, DOOM::EnumAction::Speed::SpeedFast, 1050>>(doom, *this));
     break;
@@ -1573,9 +1780,6 @@ DOOM::Doom::Level::Sector::Sector(DOOM::Doom& doom, const DOOM::Wad::RawLevel::S
   case DOOM::Doom::Level::Sector::Special::DoorOpen:
     action<DOOM::Doom::Level::Sector::Action::Leveling>(std::make_unique<DOOM::DoorLevelingAction<DOOM::EnumAction::Door::DoorWaitOpen, DOOM::EnumAction::Speed::SpeedFast, 10500>>(doom, *this));
     break;
-  case DOOM::Doom::Level::Sector::Special::Damage20:
-    damage = 20.f;
-    break;
   case DOOM::Doom::Level::Sector::Special::LightFlickers:
     action<DOOM::Doom::Level::Sector::Action::Lighting>(std::make_unique<DOOM::FlickerLightingAction<>>(doom, *this));
     break;
@@ -1585,28 +1789,6 @@ DOOM::Doom::Level::Sector::Sector(DOOM::Doom& doom, const DOOM::Wad::RawLevel::S
   }
 }
 
-DOOM::Doom::Level::Sector::Sector(DOOM::Doom::Level::Sector&& sector) :
-  floor_name(sector.floor_name),
-  ceiling_name(sector.ceiling_name),
-  floor_flat(sector.floor_flat),
-  ceiling_flat(sector.ceiling_flat),
-  light_current(sector.light_current), light_base(sector.light_base),
-  floor_current(sector.floor_current), floor_base(sector.floor_base),
-  ceiling_current(sector.ceiling_current), ceiling_base(sector.ceiling_base),
-  damage(sector.damage),
-  tag(sector.tag),
-  special(sector.special),
-  sound_target(sector.sound_target),
-  _neighbors(std::move(sector._neighbors)),
-  _actions(std::move(sector._actions))
-{}
-
-std::unique_ptr<DOOM::AbstractAction> DOOM::Doom::Level::Sector::_factory(DOOM::Doom& doom, DOOM::Doom::Level::Sector& sector, std::int16_t type, std::int16_t model)
-{
-  // Just a relay (cycling inclusion problem)
-  return DOOM::AbstractAction::factory(doom, sector, type, model);
-}
-
 void  DOOM::Doom::Level::Sector::update(DOOM::Doom& doom, float elapsed)
 {
   // Update sector actions
@@ -1620,9 +1802,9 @@ std::pair<std::int16_t, float> DOOM::Doom::Level::Sector::getNeighborLowestFloor
   std::pair<std::int16_t, float> result = { -1, std::numeric_limits<float>::quiet_NaN() };
 
   // Find lowest neighboor floor
-  for (int16_t index : _neighbors)
-    if (result.first == -1 || doom.level.sectors[index].floor_base < doom.level.sectors[result.first].floor_base)
-      result = { index, doom.level.sectors[index].floor_base };
+  for (const DOOM::Doom::Level::Sector::Neighbor& neighbor : _neighbors)
+    if (result.first == -1 || doom.level.sectors[neighbor.index].floor_base < doom.level.sectors[result.first].floor_base)
+      result = { neighbor.index, doom.level.sectors[neighbor.index].floor_base };
 
   return result;
 }
@@ -1632,9 +1814,9 @@ std::pair<std::int16_t, float> DOOM::Doom::Level::Sector::getNeighborHighestFloo
   std::pair<std::int16_t, float> result = { -1, std::numeric_limits<float>::quiet_NaN() };
 
   // Find highest neighboor floor
-  for (int16_t index : _neighbors)
-    if (result.first == -1 || doom.level.sectors[index].floor_base > doom.level.sectors[result.first].floor_base)
-      result = { index, doom.level.sectors[index].floor_base };
+  for (const DOOM::Doom::Level::Sector::Neighbor& neighbor : _neighbors)
+    if (result.first == -1 || doom.level.sectors[neighbor.index].floor_base > doom.level.sectors[result.first].floor_base)
+      result = { neighbor.index, doom.level.sectors[neighbor.index].floor_base };
 
   return result;
 }
@@ -1644,11 +1826,11 @@ std::pair<std::int16_t, float> DOOM::Doom::Level::Sector::getNeighborNextLowestF
   std::pair<std::int16_t, float> result = { -1, std::numeric_limits<float>::quiet_NaN() };
 
   // Find next lowest neighboor floor
-  for (int16_t index : _neighbors) {
-    float floor = doom.level.sectors[index].floor_base;
+  for (const DOOM::Doom::Level::Sector::Neighbor& neighbor : _neighbors) {
+    float floor = doom.level.sectors[neighbor.index].floor_base;
 
     if (floor < height && (result.first == -1 || floor > result.second))
-      result = { index, floor };
+      result = { neighbor.index, floor };
   }
 
   return result;
@@ -1659,11 +1841,11 @@ std::pair<std::int16_t, float> DOOM::Doom::Level::Sector::getNeighborNextHighest
   std::pair<std::int16_t, float> result = { -1, std::numeric_limits<float>::quiet_NaN() };
 
   // Find next highest neighboor floor
-  for (int16_t index : _neighbors) {
-    float floor = doom.level.sectors[index].floor_base;
+  for (const DOOM::Doom::Level::Sector::Neighbor& neighbor : _neighbors) {
+    float floor = doom.level.sectors[neighbor.index].floor_base;
 
     if (floor > height && (result.first == -1 || floor < result.second))
-      result = { index, floor };
+      result = { neighbor.index, floor };
   }
 
   return result;
@@ -1674,9 +1856,9 @@ std::pair<std::int16_t, float> DOOM::Doom::Level::Sector::getNeighborLowestCeili
   std::pair<std::int16_t, float> result = { -1, std::numeric_limits<float>::quiet_NaN() };
 
   // Find lowest neighboor ceiling
-  for (int16_t index : _neighbors)
-    if (result.first == -1 || doom.level.sectors[index].ceiling_base < doom.level.sectors[result.first].ceiling_base)
-      result = { index, doom.level.sectors[index].ceiling_base };
+  for (const DOOM::Doom::Level::Sector::Neighbor& neighbor : _neighbors)
+    if (result.first == -1 || doom.level.sectors[neighbor.index].ceiling_base < doom.level.sectors[result.first].ceiling_base)
+      result = { neighbor.index, doom.level.sectors[neighbor.index].ceiling_base };
 
   return result;
 }
@@ -1686,9 +1868,9 @@ std::pair<std::int16_t, float> DOOM::Doom::Level::Sector::getNeighborHighestCeil
   std::pair<std::int16_t, float> result = { -1, std::numeric_limits<float>::quiet_NaN() };
 
   // Find lowest neighboor ceiling
-  for (int16_t index : _neighbors)
-    if (result.first == -1 || doom.level.sectors[index].ceiling_base > doom.level.sectors[result.first].ceiling_base)
-      result = { index, doom.level.sectors[index].ceiling_base };
+  for (const DOOM::Doom::Level::Sector::Neighbor& neighbor : _neighbors)
+    if (result.first == -1 || doom.level.sectors[neighbor.index].ceiling_base > doom.level.sectors[result.first].ceiling_base)
+      result = { neighbor.index, doom.level.sectors[neighbor.index].ceiling_base };
 
   return result;
 }
@@ -1698,11 +1880,11 @@ std::pair<std::int16_t, float> DOOM::Doom::Level::Sector::getNeighborNextLowestC
   std::pair<std::int16_t, float> result = { -1, std::numeric_limits<float>::quiet_NaN() };
 
   // Find next lowest neighboor ceiling
-  for (int16_t index : _neighbors) {
-    float ceiling = doom.level.sectors[index].ceiling_base;
+  for (const DOOM::Doom::Level::Sector::Neighbor& neighbor : _neighbors) {
+    float ceiling = doom.level.sectors[neighbor.index].ceiling_base;
 
     if (ceiling < height && (result.first == -1 || ceiling > result.second))
-      result = { index, ceiling };
+      result = { neighbor.index, ceiling };
   }
 
   return result;
@@ -1713,17 +1895,17 @@ std::pair<std::int16_t, float> DOOM::Doom::Level::Sector::getNeighborNextHighest
   std::pair<std::int16_t, float> result = { -1, std::numeric_limits<float>::quiet_NaN() };
 
   // Find next highest neighboor floor
-  for (int16_t index : _neighbors) {
-    float ceiling = doom.level.sectors[index].ceiling_base;
+  for (const DOOM::Doom::Level::Sector::Neighbor& neighbor : _neighbors) {
+    float ceiling = doom.level.sectors[neighbor.index].ceiling_base;
 
     if (ceiling > height && (result.first == -1 || ceiling < result.second))
-      result = { index, ceiling };
+      result = { neighbor.index, ceiling };
   }
 
   return result;
 }
 
-const std::set<std::int16_t>&  DOOM::Doom::Level::Sector::getNeighbors() const
+std::span<const DOOM::Doom::Level::Sector::Neighbor>  DOOM::Doom::Level::Sector::getNeighbors() const
 {
   return _neighbors;
 }
@@ -1750,8 +1932,8 @@ int16_t DOOM::Doom::Level::Sector::getNeighborLowestLight(const DOOM::Doom& doom
   std::int16_t result = light_base;
 
   // Find lowest neighboor light level
-  for (int16_t index : _neighbors)
-    result = std::min(result, doom.level.sectors[index].light_base);
+  for (const DOOM::Doom::Level::Sector::Neighbor& neighbor : _neighbors)
+    result = std::min(result, doom.level.sectors[neighbor.index].light_base);
 
   return result;
 }
@@ -1761,12 +1943,206 @@ int16_t DOOM::Doom::Level::Sector::getNeighborHighestLight(const DOOM::Doom& doo
   std::int16_t result = light_base;
 
   // Find highest neighboor light level
-  for (int16_t index : _neighbors)
-    result = std::min(result, doom.level.sectors[index].light_base);
+  for (const DOOM::Doom::Level::Sector::Neighbor& neighbor : _neighbors)
+    result = std::min(result, doom.level.sectors[neighbor.index].light_base);
 
   return result;
 }
 
+DOOM::Doom::Level::Adjacency::Adjacency(const DOOM::Wad::RawLevel& level) :
+  _limits(level.sectors.size(), 0),
+  _queue(),
+  _reached(),
+  offsets(level.sectors.size() + 1, 0),
+  neighbors()
+{
+  std::vector<std::pair<std::int16_t, DOOM::Doom::Level::Sector::Neighbor>> pairs;
+
+  // Get both directions of every two-sided linedef
+  for (const DOOM::Wad::RawLevel::Linedef& linedef : level.linedefs) {
+    if (linedef.front == -1 || linedef.back == -1)
+      continue;
+
+    // Check for errors
+    if (linedef.front < 0 || linedef.front >= level.sidedefs.size() || linedef.back < 0 || linedef.back >= level.sidedefs.size() ||
+      level.sidedefs[linedef.front].sector < 0 || level.sidedefs[linedef.front].sector >= level.sectors.size() ||
+      level.sidedefs[linedef.back].sector < 0 || level.sidedefs[linedef.back].sector >= level.sectors.size())
+      throw std::runtime_error((std::string(__FILE__) + ": l." + std::to_string(__LINE__)).c_str());
+
+    bool  blocking = (linedef.flag & DOOM::AbstractLinedef::Flag::BlockSound) != 0;
+
+    pairs.push_back({ level.sidedefs[linedef.front].sector, { .index = level.sidedefs[linedef.back].sector, .blocking = blocking } });
+    pairs.push_back({ level.sidedefs[linedef.back].sector, { .index = level.sidedefs[linedef.front].sector, .blocking = blocking } });
+  }
+
+  // Sort by sector then neighbor
+  std::sort(pairs.begin(), pairs.end(), [](const auto& left, const auto& right) { return left.first < right.first || (left.first == right.first && left.second.index < right.second.index); });
+
+  // Merge linedefs shared by the same sectors, sound is blocked only if every linedef blocks it
+  neighbors.reserve(pairs.size());
+  for (std::size_t index = 0; index < pairs.size(); index++) {
+    if (index > 0 && pairs[index].first == pairs[index - 1].first && pairs[index].second.index == pairs[index - 1].second.index)
+      neighbors.back().blocking &= pairs[index].second.blocking;
+    else {
+      neighbors.push_back(pairs[index].second);
+      offsets[pairs[index].first + 1] += 1;
+    }
+  }
+  neighbors.shrink_to_fit();
+
+  // Accumulate neighbor counts into row offsets
+  for (std::size_t index = 1; index < offsets.size(); index++)
+    offsets[index] += offsets[index - 1];
+
+  // Reserve flood buffers, a sector is queued once per limit increase (at most twice for default noise limit)
+  _queue.reserve(level.sectors.size() * 2);
+  _reached.reserve(level.sectors.size());
+}
+
+std::span<const DOOM::Doom::Level::Sector::Neighbor>  DOOM::Doom::Level::Adjacency::operator[](std::int16_t sector) const
+{
+  // No neighbors for invalid sector
+  if (sector < 0 || sector + 1 >= offsets.size())
+    return {};
+
+  return std::span<const DOOM::Doom::Level::Sector::Neighbor>(neighbors.data() + offsets[sector], offsets[sector + 1] - offsets[sector]);
+}
+
+std::span<const std::int16_t> DOOM::Doom::Level::Adjacency::flood(const std::vector<DOOM::Doom::Level::Sector>& sectors, std::int16_t sector, int limit)
+{
+  // Reset sectors reached by previous flood
+  for (std::int16_t index : _reached)
+    _limits[index] = 0;
+  _reached.clear();
+  _queue.clear();
+
+  // Nothing to propagate
+  if (sector < 0 || sector >= _limits.size() || limit <= 0)
+    return {};
+
+  // Start from emitter sector
+  _limits[sector] = (std::int8_t)std::min(limit, (int)std::numeric_limits<std::int8_t>::max());
+  _reached.push_back(sector);
+  _queue.push_back(sector);
+
+  // Propagate to neighbors, sectors reached again with a higher limit are queued again
+  for (std::size_t head = 0; head < _queue.size(); head++) {
+    const DOOM::Doom::Level::Sector&  current = sectors[_queue[head]];
+    int                               current_limit = _limits[_queue[head]];
+
+    for (const DOOM::Doom::Level::Sector::Neighbor& neighbor : (*this)[_queue[head]]) {
+      int neighbor_limit = neighbor.blocking == true ? current_limit - 1 : current_limit;
+
+      // Limit reached, or neighbor already reached with a higher limit
+      if (neighbor_limit <= _limits[neighbor.index])
+        continue;
+
+      const DOOM::Doom::Level::Sector&  next = sectors[neighbor.index];
+
+      // Door is closed
+      if (std::min(current.ceiling_current, next.ceiling_current) <= std::max(current.floor_current, next.floor_current))
+        continue;
+
+      // Propagate sound in neighbor sector
+      if (_limits[neighbor.index] == 0)
+        _reached.push_back(neighbor.index);
+      _limits[neighbor.index] = (std::int8_t)neighbor_limit;
+      _queue.push_back(neighbor.index);
+    }
+  }
+
+  return _reached;
+}
+
+void  DOOM::Doom::Level::Adjacency::benchmark(const std::filesystem::path& wad)
+{
+  DOOM::Doom  doom;
+
+  // Load WAD resources, game mode doesn't matter for level geometry
+  doom.load(wad, DOOM::Enum::Mode::ModeRetail);
+
+  for (const std::pair<std::uint8_t, std::uint8_t>& level : doom.getLevels()) {
+    doom.setLevel(level);
+
+    const std::size_t count = doom.level.sectors.size();
+    const std::size_t repeat = std::max((std::size_t)1, (std::size_t)100000 / std::max(count, (std::size_t)1));
+
+    // Reference: scan every linedef of the level for each reached sector, as done before adjacency
+    std::function<void(std::unordered_map<std::int16_t, int>&, std::int16_t, int)> scan = [&doom, &scan](std::unordered_map<std::int16_t, int>& sectors, std::int16_t sector_index, int limit) {
+      // Limit reached or sector already traversed with a higher limit
+      if (limit <= 0 || (sectors.find(sector_index) != sectors.end() && sectors[sector_index] >= limit))
+        return;
+      sectors[sector_index] = limit;
+
+      for (const auto& linedef : doom.level.linedefs) {
+        if (linedef->back == -1 || linedef->front == -1)
+          continue;
+
+        std::int16_t  neighbor_index;
+
+        // Get adjacent sector index
+        if (doom.level.sidedefs[linedef->back].sector == sector_index)
+          neighbor_index = doom.level.sidedefs[linedef->front].sector;
+        else if (doom.level.sidedefs[linedef->front].sector == sector_index)
+          neighbor_index = doom.level.sidedefs[linedef->back].sector;
+        else
+          continue;
+
+        // Door is closed
+        if (std::min(doom.level.sectors[sector_index].ceiling_current, doom.level.sectors[neighbor_index].ceiling_current) <= std::max(doom.level.sectors[sector_index].floor_current, doom.level.sectors[neighbor_index].floor_current))
+          continue;
+
+        scan(sectors, neighbor_index, (linedef->flag & DOOM::AbstractLinedef::Flag::BlockSound) ? (limit - 1) : (limit));
+      }
+    };
+
+    unsigned int  mismatch = 0;
+
+    // Check that both methods reach the same sectors
+    for (std::int16_t sector = 0; sector < count; sector++) {
+      std::unordered_map<std::int16_t, int> sectors;
+      std::span<const std::int16_t>         reached = doom.level.adjacency.flood(doom.level.sectors, sector, 2);
+      std::vector<std::int16_t>             expected, result(reached.begin(), reached.end());
+
+      scan(sectors, sector, 2);
+      for (const auto& entry : sectors)
+        expected.push_back(entry.first);
+      std::sort(expected.begin(), expected.end());
+      std::sort(result.begin(), result.end());
+      if (expected != result)
+        mismatch += 1;
+    }
+
+    sf::Clock clock;
+
+    // Time linedefs scan from every sector
+    for (std::size_t iteration = 0; iteration < repeat; iteration++)
+      for (std::int16_t sector = 0; sector < count; sector++) {
+        std::unordered_map<std::int16_t, int> sectors;
+
+        scan(sectors, sector, 2);
+      }
+
+    float scan_time = clock.restart().asSeconds();
+
+    // Time adjacency flood from every sector
+    for (std::size_t iteration = 0; iteration < repeat; iteration++)
+      for (std::int16_t sector = 0; sector < count; sector++)
+        doom.level.adjacency.flood(doom.level.sectors, sector, 2);
+
+    float flood_time = clock.restart().asSeconds();
+    float floods = (float)(repeat * std::max(count, (std::size_t)1));
+
+    std::cout
+      << "[DOOM::Doom::Level::Adjacency] Level (" << (int)level.first << ", " << (int)level.second << "): "
+      << count << " sectors, " << doom.level.adjacency.neighbors.size() << " neighbors, "
+      << "scan " << scan_time / floods * 1000000.f << "us/flood, "
+      << "adjacency " << flood_time / floods * 1000000.f << "us/flood "
+      << "(x" << scan_time / std::max(flood_time, std::numeric_limits<float>::min()) << "), "
+      << mismatch << " mismatch(es)." << std::endl;
+  }
+}
+
 DOOM::Doom::Level::Statistics::Statistics() :
   players(),
   total(),
@@ -4,9 +4,11 @@
 #include <cstdint>
 #include <filesystem>
 #include <functional>
+#include <future>
 #include <list>
 #include <memory>
 #include <set>
+#include <span>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -15,6 +17,7 @@
 #include <SFML/Graphics.hpp>
 #include <SFML/Audio.hpp>
 
+#include "Doom/Demo.hpp"
 #include "Doom/Wad.hpp"
 #include "Math/Box.hpp"
 #include "Math/Vector.hpp"
@@ -641,6 +644,12 @@ namespace DOOM
           Number    // Number of type of action
         };
 
+        struct Neighbor
+        {
+          std::int16_t  index;    // Index of neighbor sector
+          bool          blocking; // True if every linedef shared with neighbor blocks sound
+        };
+
         std::uint64_t                                     floor_name, ceiling_name; // Textures names
         std::reference_wrapper<const DOOM::AbstractFlat>  floor_flat, ceiling_flat; // Textures pointers (null if sky)
 
@@ -655,7 +664,7 @@ namespace DOOM
         DOOM::AbstractThing* sound_target;  // Last sound emitter
 
       protected:
-        std::set<std::int16_t>  _neighbors; // List of neighbor sectors (sorted)
+        std::span<const DOOM::Doom::Level::Sector::Neighbor>  _neighbors; // List of neighbor sectors (sorted), range of level adjacency
 
       private:
         std::array<std::unique_ptr<DOOM::AbstractAction>, DOOM::Doom::Level::Sector::Action::Number>  _actions; // Actions on sector
@@ -668,6 +677,7 @@ namespace DOOM
         ~Sector() = default;
 
         void  update(DOOM::Doom& doom, float elapsed);  // Update sector
+        void  start(DOOM::Doom& doom);                  // Push actions of sector special, on main thread as actions reserve sounds and use random generator
 
         template<DOOM::Doom::Level::Sector::Action Type>
         inline void action(DOOM::Doom& doom, std::int16_t type, std::int16_t model = -1)  // Add action to sector if possible
@@ -719,7 +729,7 @@ namespace DOOM
         std::pair<std::int16_t, float>  getNeighborNextLowestCeiling(const DOOM::Doom& doom, float height) const;   // Get next lowest neighbor floor level from height
         std::pair<std::int16_t, float>  getNeighborNextHighestCeiling(const DOOM::Doom& doom, float height) const;  // Get next highest neighbor floor level from height
 
-        const std::set<std::int16_t>& getNeighbors() const; // Get neighbors indexes
+        std::span<const DOOM::Doom::Level::Sector::Neighbor>  getNeighbors() const;  // Get neighbors indexes
 
         std::int16_t  getShortestLowerTexture(const DOOM::Doom& doom) const;  // Get shortest lower texture height on the boundary of the sector
 
@@ -729,6 +739,10 @@ namespace DOOM
 
       class Blockmap
       {
+      private:
+        std::vector<std::int16_t>                                 _linedefs;  // Linedefs of last gathered blocks
+        std::vector<std::reference_wrapper<DOOM::AbstractThing>>  _things;    // Things of last gathered blocks
+
       public:
         struct Block
         {
@@ -753,6 +767,30 @@ namespace DOOM
         void  addThing(DOOM::AbstractThing& thing, const Math::Vector<2>& position);                                            // Add thing to blockmap
         void  moveThing(DOOM::AbstractThing& thing, const Math::Vector<2>& old_position, const Math::Vector<2>& new_position);  // Update thing position in blockmap
         void  removeThing(DOOM::AbstractThing& thing, const Math::Vector<2>& position);                                         // Remove thing from blockmap
+
+        std::pair<std::span<const std::int16_t>, std::span<const std::reference_wrapper<DOOM::AbstractThing>>> gather(const Math::Vector<2>& position, const Math::Vector<2>& movement, float radius); // Return linedefs and things of blocks under bounding box corners before and after movement, sorted without duplicates (valid until next gather)
+      };
+
+      class Adjacency
+      {
+      private:
+        std::vector<std::int8_t>  _limits;  // Limit reached by last flood in each sector (0 if not reached)
+        std::vector<std::int16_t> _queue;   // Sectors to propagate flood from
+        std::vector<std::int16_t> _reached; // Sectors reached by last flood
+
+      public:
+        std::vector<std::uint32_t>                        offsets;    // Index of first neighbor of each sector, followed by total number of neighbors (CSR rows)
+        std::vector<DOOM::Doom::Level::Sector::Neighbor>  neighbors;  // Neighbors of every sector, sorted by sector then neighbor (CSR columns)
+
+        Adjacency() = default;
+        Adjacency(const DOOM::Wad::RawLevel& level);
+        ~Adjacency() = default;
+
+        std::span<const DOOM::Doom::Level::Sector::Neighbor>  operator[](std::int16_t sector) const; // Get neighbors of sector
+
+        std::span<const std::int16_t> flood(const std::vector<DOOM::Doom::Level::Sector>& sectors, std::int16_t sector, int limit); // Propagate sound through open neighbors, losing one limit on blocking linedefs, return reached sectors (valid until next flood)
+
+        static void benchmark(const std::filesystem::path& wad);  // Compare sound flood with a scan of linedefs on every level of WAD
       };
 
       class Statistics
@@ -795,6 +833,7 @@ namespace DOOM
       std::vector<DOOM::Doom::Level::Node>                          nodes;      // List of nodes
       std::vector<DOOM::Doom::Level::Sector>                        sectors;    // List of sectors
       DOOM::Doom::Level::Blockmap                                   blockmap;   // Blockmap of level
+      DOOM::Doom::Level::Adjacency                                  adjacency;  // Sectors adjacency graph
       DOOM::Doom::Level::Statistics                                 statistics; // Statistics of level
       
 
@@ -827,21 +866,28 @@ namespace DOOM
     void  buildResourcesFlats();      // Build flats from WAD
     void  buildResourcesSounds();     // Build sounds from WAD
 
-    void  buildLevel(const std::pair<uint8_t, uint8_t>& level); // Build level from WAD file
-    void  buildLevelVertexes();                                 // Build level's vertexes from WAD file
-    void  buildLevelSectors();                                  // Build level's sectors from WAD file
-    void  buildLevelLinedefs();                                 // Build level's linedefs from WAD file
-    void  buildLevelSidedefs();                                 // Build level's sidedefs from WAD file
-    void  buildLevelSubsectors();                               // Build level's subsectors from WAD file
-    void  buildLevelThings();                                   // Build level's things from WAD file
-    void  buildLevelSegments();                                 // Build level's segments from WAD file
-    void  buildLevelNodes();                                    // Build level's nodes from WAD file
-    void  buildLevelBlockmap();                                 // Build level's blockmap from WAD file
-    void  buildLevelStatistics();                               // Initialize level statistics for loaded level
+    std::future<void> _levelBuild;  // Level components being built in background
+
+    void  buildLevel(const std::pair<uint8_t, uint8_t>& level);     // Build level from WAD file
+    void  buildLevelBase(const std::pair<uint8_t, uint8_t>& level); // Clear previous level and set level base info
+    void  buildLevelComponents();                                   // Build level's components from WAD file, report time of each stage
+    void  buildLevelWait();                                         // Wait for level being built in background, discard it
+    void  buildLevelVertexes();                                     // Build level's vertexes from WAD file
+    void  buildLevelAdjacency();                                    // Build level's sectors adjacency from WAD file
+    void  buildLevelSectors();                                      // Build level's sectors from WAD file
+    void  buildLevelLinedefs();                                     // Build level's linedefs from WAD file
+    void  buildLevelSidedefs();                                     // Build level's sidedefs from WAD file
+    void  buildLevelSubsectors();                                   // Build level's subsectors from WAD file
+    void  buildLevelThings();                                       // Build level's things from WAD file
+    void  buildLevelSegments();                                     // Build level's segments from WAD file
+    void  buildLevelNodes();                                        // Build level's nodes from WAD file
+    void  buildLevelBlockmap();                                     // Build level's blockmap from WAD file
+    void  buildLevelStatistics();                                   // Initialize level statistics for loaded level
+    void  buildLevelActions();                                      // Push sector special actions, on main thread once components are built
 
   public:
     Doom();
-    ~Doom() = default;
+    ~Doom();
 
     DOOM::Wad             wad;        // File holding WAD datas
     DOOM::Doom::Resources resources;  // Resources built from WAD
@@ -853,12 +899,14 @@ namespace DOOM
     float                 music;      // Music valume [0-1]
     bool                  message;    // Message enabled
     sf::Image             image;      // DOOM rendering target
+    DOOM::Demo            demo;       // Demo recording and playback
 
     void  load(const std::filesystem::path& file, DOOM::Enum::Mode mode); // Load WAD file and build resources
     void  update(float elapsed);                                          // Update current level and resources
 
     std::list<std::pair<std::uint8_t, std::uint8_t>>  getLevels() const;                                                          // Return list of available level in WAD
     void                                              setLevel(std::pair<std::uint8_t, std::uint8_t> level, bool reset = false);  // Build specified level from WAD, use reset to hard reset players
+    void                                              preloadLevel(std::pair<std::uint8_t, std::uint8_t> level);                  // Start building specified level in background, level must not be used until setLevel is called with the same level
 
     void  addPlayer(int controller);  // Add player to current game
 
@@ -61,14 +61,17 @@ bool  DOOM::GameDoomScene::update(float elapsed)
     }
   }
 
-  // Add new players (keyboard)
-  if (Game::Window::Instance().keyboard().keyPressed(Game::Window::Key::Space) == true)
-    _doom.addPlayer(0);
-
-  // Add new players (joystick)
-  for (unsigned int id = 0; id < Game::Window::JoystickCount; id++)
-    if (Game::Window::Instance().joystick().buttonPressed(id, 0) == true)
-      _doom.addPlayer(id + 1);
+  // Add new players, not while a demo is running
+  if (_doom.demo.mode() == DOOM::Demo::Mode::ModeNone) {
+    // Add new players (keyboard)
+    if (Game::Window::Instance().keyboard().keyPressed(Game::Window::Key::Space) == true)
+      _doom.addPlayer(0);
+
+    // Add new players (joystick)
+    for (unsigned int id = 0; id < Game::Window::JoystickCount; id++)
+      if (Game::Window::Instance().joystick().buttonPressed(id, 0) == true)
+        _doom.addPlayer(id + 1);
+  }
 
   // Update game components
   _doom.update(elapsed);
@@ -143,6 +146,26 @@ bool  DOOM::GameDoomScene::update(float elapsed)
     _doom.setLevel(*next);
   }
 
+  // TODO: remove this
+  // Record demo of current level
+  if (Game::Window::Instance().keyboard().keyPressed(Game::Window::Key::F5) == true) {
+    if (_doom.demo.mode() == DOOM::Demo::Mode::ModeRecord)
+      _doom.demo.stop();
+    else
+      _doom.demo.record(_doom, Game::Config::ExecutablePath / "assets" / "levels" / "doom.dem");
+  }
+
+  // TODO: remove this
+  // Play back recorded demo
+  if (Game::Window::Instance().keyboard().keyPressed(Game::Window::Key::F6) == true) {
+    try {
+      _doom.demo.play(_doom, Game::Config::ExecutablePath / "assets" / "levels" / "doom.dem");
+    }
+    catch (const std::exception&) {
+      std::cerr << "[DOOM::GameDoomScene] Warning, failed to play demo." << std::endl;
+    }
+  }
+
   // TODO: remove this
   // End level
   if (Game::Window::Instance().keyboard().keyPressed(Game::Window::Key::F2) == true) {
@@ -441,9 +464,9 @@ void  DOOM::GameDoomScene::end()
   // Reset scenes
   machine.clear();
 
-  // Load next level
+  // Build next level in background during intermission
   if (next != std::pair<std::uint8_t, std::uint8_t>(0, 0)) {
-    doom.setLevel(next);
+    doom.preloadLevel(next);
     machine.push<DOOM::GameDoomScene>(doom);
   }
 
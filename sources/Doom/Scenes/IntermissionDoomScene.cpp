@@ -333,6 +333,10 @@ void  DOOM::IntermissionDoomScene::updateEnd()
   auto& machine = _machine;
   auto& doom = _doom;
 
+  // Complete next level, built in background since end of previous level
+  if (_next != std::pair<std::uint8_t, std::uint8_t>(0, 0))
+    doom.setLevel(_next);
+
   // Pop to next screen
   machine.pop();
 
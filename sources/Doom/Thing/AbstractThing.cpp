@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <functional>
 #include <iostream>
 #include <set>
@@ -5111,108 +5112,115 @@ void  DOOM::AbstractThing::updatePhysics(DOOM::Doom& doom, float elapsed)
   updatePhysicsGravity(doom, elapsed);
 }
 
-void  DOOM::AbstractThing::updatePhysicsThrust(DOOM::Doom& doom, float elapsed, int depth, int16_t linedef_ignored, const DOOM::AbstractThing* thing_ignored)
+void  DOOM::AbstractThing::updatePhysicsThrust(DOOM::Doom& doom, float elapsed)
 {
   // NOTE: glitch might happen if radius > 128
   // NOTE: we are using bounding circle instead of square
 
-  // Limit movement to 30 units per tics
-  Math::Vector<2> movement = ((_thrust.convert<2>().length() > 30.f) ? (_thrust.convert<2>() * 30.f / _thrust.convert<2>().length()) : _thrust.convert<2>())* elapsed / DOOM::Doom::Tic;
+  int16_t               linedef_ignored = -1;
+  DOOM::AbstractThing*  thing_ignored = nullptr;
 
-  // Stop if maximum recursion depth reach
-  if (depth > 4 || (movement.x() == 0.f && movement.y() == 0.f)) {
-    _thrust.convert<2>() = Math::Vector<2>(0.f, 0.f);
-    return;
-  }
-
-  // Get intersectable linedefs and things
-  std::pair<std::set<int16_t>, std::set<std::reference_wrapper<DOOM::AbstractThing>>> linedefs_things = updatePhysicsThrustLinedefsThings(doom, movement);
+  // Slide against obstacles until movement is over, ignoring last collided linedef/thing
+  for (int depth = 0;; depth++) {
+    // Limit movement to 30 units per tics
+    Math::Vector<2> movement = ((_thrust.convert<2>().length() > 30.f) ? (_thrust.convert<2>() * 30.f / _thrust.convert<2>().length()) : _thrust.convert<2>()) * elapsed / DOOM::Doom::Tic;
 
-  int16_t               closest_linedef = -1;
-  DOOM::AbstractThing*  closest_thing = nullptr;
-  float                 closest_distance = 1.f;
-  Math::Vector<2>       closest_normal = Math::Vector<2>();
-
-  // Check collision with linedefs
-  for (int16_t linedef_index : linedefs_things.first) {
-    std::pair<float, Math::Vector<2>> intersection = updatePhysicsThrustLinedef(doom, movement, linedef_index, linedef_ignored);
-
-    // Get nearest linedef
-    if (intersection.first < closest_distance && !(flags & DOOM::Enum::ThingProperty::ThingProperty_NoClip)) {
-      closest_linedef = linedef_index;
-      closest_thing = nullptr;
-      closest_distance = intersection.first;
-      closest_normal = intersection.second;
+    // Stop if maximum slide count reach
+    if (depth > 4 || (movement.x() == 0.f && movement.y() == 0.f)) {
+      _thrust.convert<2>() = Math::Vector<2>(0.f, 0.f);
+      return;
     }
-  }
 
-  // Check collision with things
-  if ((flags & DOOM::Enum::ThingProperty::ThingProperty_Solid) || (flags & DOOM::Enum::ThingProperty::ThingProperty_Missile))
-    for (const std::reference_wrapper<DOOM::AbstractThing>& thing : linedefs_things.second) {
-      // Thing has already been removed
-      if (thing.get()._remove == true)
-        continue;
+    // Get intersectable linedefs and things
+    auto [linedefs, things] = doom.level.blockmap.gather(position.convert<2>(), movement, (float)attributs.radius);
 
-      std::pair<float, Math::Vector<2>> intersection = updatePhysicsThrustThing(doom, movement, thing.get(), thing_ignored);
+    int16_t               closest_linedef = -1;
+    DOOM::AbstractThing*  closest_thing = nullptr;
+    float                 closest_distance = 1.f;
+    Math::Vector<2>       closest_normal = Math::Vector<2>();
 
-      // Ignore missile emitter
-      if ((flags & DOOM::Enum::ThingProperty::ThingProperty_Missile) && &thing.get() == _target)
-        continue;
+    // Check collision with linedefs
+    for (int16_t linedef_index : linedefs) {
+      std::pair<float, Math::Vector<2>> intersection = updatePhysicsThrustLinedef(doom, movement, linedef_index, linedef_ignored);
 
-      // Get nearest thing
+      // Get nearest linedef
       if (intersection.first < closest_distance && !(flags & DOOM::Enum::ThingProperty::ThingProperty_NoClip)) {
-        closest_linedef = -1;
-        closest_thing = &thing.get();
+        closest_linedef = linedef_index;
+        closest_thing = nullptr;
         closest_distance = intersection.first;
         closest_normal = intersection.second;
       }
     }
 
-  // Walkover linedefs
-  for (int16_t linedef_index : linedefs_things.first) {
-    // Ignore linedef if collided or ignored
-    if (linedef_index == closest_linedef || linedef_index == linedef_ignored)
-      continue;
+    // Check collision with things
+    if ((flags & DOOM::Enum::ThingProperty::ThingProperty_Solid) || (flags & DOOM::Enum::ThingProperty::ThingProperty_Missile))
+      for (const std::reference_wrapper<DOOM::AbstractThing>& thing : things) {
+        // Thing has already been removed
+        if (thing.get()._remove == true)
+          continue;
+
+        std::pair<float, Math::Vector<2>> intersection = updatePhysicsThrustThing(doom, movement, thing.get(), thing_ignored);
+
+        // Ignore missile emitter
+        if ((flags & DOOM::Enum::ThingProperty::ThingProperty_Missile) && &thing.get() == _target)
+          continue;
+
+        // Get nearest thing
+        if (intersection.first < closest_distance && !(flags & DOOM::Enum::ThingProperty::ThingProperty_NoClip)) {
+          closest_linedef = -1;
+          closest_thing = &thing.get();
+          closest_distance = intersection.first;
+          closest_normal = intersection.second;
+        }
+      }
 
-    DOOM::AbstractLinedef&  linedef = *doom.level.linedefs[linedef_index].get();
+    // Walkover linedefs
+    for (int16_t linedef_index : linedefs) {
+      // Ignore linedef if collided or ignored
+      if (linedef_index == closest_linedef || linedef_index == linedef_ignored)
+        continue;
 
-    // Compute intersection of movement with linedef
-    std::pair<float, float> intersection = Math::intersection(
-      doom.level.vertexes[linedef.start],
-      doom.level.vertexes[linedef.end] - doom.level.vertexes[linedef.start],
-      position.convert<2>(),
-      movement * closest_distance);
+      DOOM::AbstractLinedef&  linedef = *doom.level.linedefs[linedef_index].get();
 
-    // Walkover linedef if intersected
-    if (intersection.first >= 0.f && intersection.first <= 1.f &&
-      intersection.second >= 0.f && intersection.second <= 1.f)
-      linedef.walkover(doom, *this);
-  }
+      // Compute intersection of movement with linedef
+      std::pair<float, float> intersection = Math::intersection(
+        doom.level.vertexes[linedef.start],
+        doom.level.vertexes[linedef.end] - doom.level.vertexes[linedef.start],
+        position.convert<2>(),
+        movement * closest_distance);
 
-  // Pickup things
-  if ((flags & DOOM::Enum::ThingProperty::ThingProperty_PickUp) != 0)
-    for (const std::reference_wrapper<DOOM::AbstractThing>& thing : linedefs_things.second) {
-      // Ignore thing if collided or ignored or already removed
-      if (&thing.get() == closest_thing || &thing.get() == thing_ignored || (thing.get().flags & DOOM::Enum::ThingProperty::ThingProperty_Special) == 0 || thing.get()._remove == true)
-        continue;
+      // Walkover linedef if intersected
+      if (intersection.first >= 0.f && intersection.first <= 1.f &&
+        intersection.second >= 0.f && intersection.second <= 1.f)
+        linedef.walkover(doom, *this);
+    }
 
-      // Pickup thing if destination is in thing area
-      if ((position.convert<2>() + movement * closest_distance - thing.get().position.convert<2>()).length() < thing.get().attributs.radius + attributs.radius &&
-        position.z() + height > thing.get().position.z() && position.z() < thing.get().position.z() + thing.get().height) {
-        thing.get()._remove = pickup(doom, thing);
+    // Pickup things
+    if ((flags & DOOM::Enum::ThingProperty::ThingProperty_PickUp) != 0)
+      for (const std::reference_wrapper<DOOM::AbstractThing>& thing : things) {
+        // Ignore thing if collided or ignored or already removed
+        if (&thing.get() == closest_thing || &thing.get() == thing_ignored || (thing.get().flags & DOOM::Enum::ThingProperty::ThingProperty_Special) == 0 || thing.get()._remove == true)
+          continue;
+
+        // Pickup thing if destination is in thing area
+        if ((position.convert<2>() + movement * closest_distance - thing.get().position.convert<2>()).length() < thing.get().attributs.radius + attributs.radius &&
+          position.z() + height > thing.get().position.z() && position.z() < thing.get().position.z() + thing.get().height) {
+          thing.get()._remove = pickup(doom, thing);
+        }
       }
+
+    // Move player to closest obstacle or full movement if none found
+    if (closest_distance > 0.f) {
+      Math::Vector<2> destination = position.convert<2>() + movement * closest_distance;
+      if (!(flags & DOOM::Enum::ThingProperty::ThingProperty_NoBlockmap))
+        doom.level.blockmap.moveThing(*this, position.convert<2>(), destination);
+      position.convert<2>() = destination;
     }
 
-  // Move player to closest obstacle or full movement if none found
-  if (closest_distance > 0.f) {
-    Math::Vector<2> destination = position.convert<2>() + movement * closest_distance;
-    if (!(flags & DOOM::Enum::ThingProperty::ThingProperty_NoBlockmap))
-      doom.level.blockmap.moveThing(*this, position.convert<2>(), destination);
-    position.convert<2>() = destination;
-  }
+    // Movement is over if no obstacle found
+    if (closest_linedef == -1 && closest_thing == nullptr)
+      return;
 
-  // Re-compute movement if obstacle found
-  if (closest_linedef != -1 || closest_thing != nullptr) {
     Math::Vector<2> closest_direction = Math::Vector<2>(+closest_normal.y(), -closest_normal.x());
 
     // Slide against currently collisioned walls/things (change movement and thrust)
@@ -5244,11 +5252,13 @@ void  DOOM::AbstractThing::updatePhysicsThrust(DOOM::Doom& doom, float elapsed,
         else
           setState(doom, DOOM::AbstractThing::ThingState::State_None);
       }
+      return;
     }
 
-    // Attempt new move, ignoring collided linedef/thing
-    else
-      updatePhysicsThrust(doom, elapsed * (1.f - closest_distance), depth + 1, closest_linedef, closest_thing);
+    // Attempt new move with remaining time, ignoring collided linedef/thing
+    elapsed *= 1.f - closest_distance;
+    linedef_ignored = closest_linedef;
+    thing_ignored = closest_thing;
   }
 }
 
@@ -5436,37 +5446,6 @@ std::pair<float, Math::Vector<2>> DOOM::AbstractThing::updatePhysicsThrustThing(
     return { 1.f, Math::Vector<2>() };
 }
 
-std::pair<std::set<int16_t>, std::set<std::reference_wrapper<DOOM::AbstractThing>>> DOOM::AbstractThing::updatePhysicsThrustLinedefsThings(DOOM::Doom& doom, const Math::Vector<2>& movement)
-{
-  std::set<int16_t> blocks;
-
-  // Get blockmap index at current, using the four corners
-  blocks.insert(doom.level.blockmap.index(Math::Vector<2>(position.x() - (float)attributs.radius, position.y() - (float)attributs.radius)));
-  blocks.insert(doom.level.blockmap.index(Math::Vector<2>(position.x() - (float)attributs.radius, position.y() + (float)attributs.radius)));
-  blocks.insert(doom.level.blockmap.index(Math::Vector<2>(position.x() + (float)attributs.radius, position.y() - (float)attributs.radius)));
-  blocks.insert(doom.level.blockmap.index(Math::Vector<2>(position.x() + (float)attributs.radius, position.y() + (float)attributs.radius)));
-
-  // Get blockmap index at target position, using the four corners
-  blocks.insert(doom.level.blockmap.index(Math::Vector<2>(position.x() + movement.x() - (float)attributs.radius, position.y() + movement.y() - (float)attributs.radius)));
-  blocks.insert(doom.level.blockmap.index(Math::Vector<2>(position.x() + movement.x() - (float)attributs.radius, position.y() + movement.y() + (float)attributs.radius)));
-  blocks.insert(doom.level.blockmap.index(Math::Vector<2>(position.x() + movement.x() + (float)attributs.radius, position.y() + movement.y() - (float)attributs.radius)));
-  blocks.insert(doom.level.blockmap.index(Math::Vector<2>(position.x() + movement.x() + (float)attributs.radius, position.y() + movement.y() + (float)attributs.radius)));
-
-  std::pair<std::set<int16_t>, std::set<std::reference_wrapper<DOOM::AbstractThing>>> linedefs_things;
-
-  // Get index of linedefs to test against position
-  for (int16_t block_index : blocks)
-    if (block_index != -1) {
-      const DOOM::Doom::Level::Blockmap::Block& block = doom.level.blockmap.blocks[block_index];
-
-      linedefs_things.first.insert(block.linedefs.begin(), block.linedefs.end());
-      linedefs_things.second.insert(block.things.begin(), block.things.end());
-    }
-
-  // Return set of intersectable linedef
-  return linedefs_things;
-}
-
 void  DOOM::AbstractThing::updatePhysicsGravity(DOOM::Doom& doom, float elapsed)
 {
   std::set<int16_t> sectors = doom.level.getSectors(*this);
@@ -4,6 +4,7 @@
 #include <cstdint>
 #include <set>
 #include <utility>
+#include <vector>
 
 #include "Doom/Doom.hpp"
 #include "Doom/Statusbar.hpp"
@@ -347,12 +348,11 @@ namespace DOOM
 
     void                                                                                updateState(DOOM::Doom& doom, float elapsed);                                                                                                               // Update state of thing
     void                                                                                updatePhysics(DOOM::Doom& doom, float elapsed);                                                                                                             // Update physics of thing
-    void                                                                                updatePhysicsThrust(DOOM::Doom& doom, float elapsed, int depth = 0, std::int16_t linedef_ignored = -1, const DOOM::AbstractThing* thing_ignored = nullptr); // Update thrust component of thing
+    void                                                                                updatePhysicsThrust(DOOM::Doom& doom, float elapsed);                                                                                                       // Update thrust component of thing, sliding against obstacles
     bool                                                                                updatePhysicsThrustSidedefs(DOOM::Doom& doom, std::int16_t sidedef_front_index, std::int16_t sidedef_back_index);                                           // Return true if thing can move through sidedefs
     std::pair<float, Math::Vector<2>>                                                   updatePhysicsThrustVertex(DOOM::Doom& doom, const Math::Vector<2>& movement, std::int16_t vertex_index, std::int16_t ignored_index);                        // Return intersection of movement with vertex (coef. along movement / normal vector)
     std::pair<float, Math::Vector<2>>                                                   updatePhysicsThrustLinedef(DOOM::Doom& doom, const Math::Vector<2>& movement, std::int16_t linedef_index, std::int16_t ignored_index);                      // Return intersection of movement with linedef (coef. along movement / normal vector)
     std::pair<float, Math::Vector<2>>                                                   updatePhysicsThrustThing(DOOM::Doom& doom, const Math::Vector<2>& movement, const DOOM::AbstractThing& thing, const DOOM::AbstractThing* ignored);          // Return intersection of movement with thing (coef. along movement / normal vector)
-    std::pair<std::set<int16_t>, std::set<std::reference_wrapper<DOOM::AbstractThing>>> updatePhysicsThrustLinedefsThings(DOOM::Doom& doom, const Math::Vector<2>& movement);                                                                       // Return set of intersectable linedef indexes
     void                                                                                updatePhysicsGravity(DOOM::Doom& doom, float elapsed);                                                                                                      // Update gravity component of thing
 
   public:
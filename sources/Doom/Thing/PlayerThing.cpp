@@ -204,6 +204,9 @@ DOOM::PlayerThing::PlayerThing(DOOM::Doom& doom, int id, int controller) :
   _weapon(DOOM::Enum::Weapon::WeaponPistol), _weaponNext(DOOM::Enum::Weapon::WeaponPistol), _weaponState(_attributs[_weapon].up), _weaponElapsed(0.f), _weaponRampage(0.f), _weaponSound(Game::Audio::Sound::Instance().get()), _weaponPosition(), _weaponRefire(false), _weaponFire(false),
   _flash(0), _flashState(DOOM::PlayerThing::WeaponState::State_None), _flashElapsed(0.f),
   _palettePickup(0.f), _paletteDamage(0.f), _paletteBerserk(0.f),
+  _input{ .horizontal = 0, .vertical = 0, .forward = 0, .strafe = 0, .weapon = -1, .down = 0, .pressed = 0 },
+  _pressed(0),
+  _slot(-1),
   id(id),
   controller(controller),
   camera(),
@@ -347,11 +350,29 @@ void  DOOM::PlayerThing::updateLightAmplificationVisor(DOOM::Doom& doom, float e
 
 bool  DOOM::PlayerThing::update(DOOM::Doom& doom, float elapsed)
 {
-  // Update player using controller
+  // Get input of current tic
+  updateInput(doom);
+
+  // Turn player
+  updateTurn(doom, elapsed, _input.horizontal / 127.f, _input.vertical / 127.f);
+
+  Math::Vector<2> movement(_input.forward / 127.f, _input.strafe / 127.f);
+
+  // Handle running (keyboard: shift held, game pad: left stick click)
   if (controller == 0)
-    updateKeyboard(doom, elapsed);
-  else if (controller > 0)
-    updateController(doom, elapsed);
+    _running = control(DOOM::PlayerThing::Control::ControlRun);
+  else {
+    if (movement.length() < 0.72f)
+      _running = false;
+    if (control(DOOM::PlayerThing::Control::ControlRun, true) == true)
+      _running = true;
+  }
+
+  // Move player
+  updateMove(doom, elapsed, movement);
+
+  // Select weapon
+  updateInputWeapon(doom, elapsed);
 
   // Switch weapon
   if (control(DOOM::PlayerThing::Control::ControlNext, true) == true)
@@ -469,109 +490,139 @@ void  DOOM::PlayerThing::updateAutomap(DOOM::Doom& doom, float elapsed)
   }
 }
 
-void  DOOM::PlayerThing::updateKeyboard(DOOM::Doom& doom, float elapsed)
+void  DOOM::PlayerThing::poll()
 {
-  updateKeyboardTurn(doom, elapsed);
-  updateKeyboardMove(doom, elapsed);
-  updateKeyboardWeapon(doom, elapsed);
+  // Read controller
+  updateInputDevice();
+
+  // Keep edges until a tic consumes them, a frame might run no tic
+  _pressed |= _input.pressed;
+  if (_slot == -1)
+    _slot = _input.weapon;
 }
 
-void  DOOM::PlayerThing::updateKeyboardTurn(DOOM::Doom& doom, float elapsed)
+void  DOOM::PlayerThing::updateInput(DOOM::Doom& doom)
+{
+  // Read controller
+  updateInputDevice();
+
+  // Controls pressed since last tic, consumed by first tic of a frame only
+  _input.pressed = _pressed;
+  _input.weapon = _slot;
+  _pressed = 0;
+  _slot = -1;
+
+  // Record input or replace it with recorded one
+  doom.demo.input(id, _input);
+}
+
+void  DOOM::PlayerThing::updateInputDevice()
+{
+  if (controller == 0)
+    updateInputKeyboard();
+  else
+    updateInputController();
+}
+
+void  DOOM::PlayerThing::updateInputKeyboard()
 {
   // Turn player
-  float horizontal = 0.f;
-  float vertical = 0.f;
+  _input.horizontal = 0;
+  _input.vertical = 0;
 
   if (Game::Window::Instance().keyboard().keyDown(Game::Window::Key::Left) == true)  // Turn left
-    horizontal += 1.f;
+    _input.horizontal += 127;
   if (Game::Window::Instance().keyboard().keyDown(Game::Window::Key::Right) == true) // Turn right
-    horizontal -= 1.f;
+    _input.horizontal -= 127;
 
   if (Game::Window::Instance().keyboard().keyDown(Game::Window::Key::Up) == true)    // Turn up
-    vertical += 1.f;
+    _input.vertical += 127;
   if (Game::Window::Instance().keyboard().keyDown(Game::Window::Key::Down) == true)  // Turn down
-    vertical -= 1.f;
+    _input.vertical -= 127;
 
-  // Apply rotation to player
-  updateTurn(doom, elapsed, horizontal, vertical);
-}
-
-void  DOOM::PlayerThing::updateKeyboardMove(DOOM::Doom & doom, float elapsed)
-{
   // Move player
-  Math::Vector<2> movement(0.f, 0.f);
+  _input.forward = 0;
+  _input.strafe = 0;
 
   if (Game::Window::Instance().keyboard().keyDown(Game::Window::Key::Z) == true) // Move forward
-    movement += Math::Vector<2>(+1.f, 0.f);
+    _input.forward += 127;
   if (Game::Window::Instance().keyboard().keyDown(Game::Window::Key::S) == true) // Move backward
-    movement += Math::Vector<2>(-1.f, 0.f);
+    _input.forward -= 127;
   if (Game::Window::Instance().keyboard().keyDown(Game::Window::Key::Q) == true) // Strafe left
-    movement += Math::Vector<2>(0.f, -1.f);
+    _input.strafe -= 127;
   if (Game::Window::Instance().keyboard().keyDown(Game::Window::Key::D) == true) // Strafe right
-    movement += Math::Vector<2>(0.f, +1.f);
-
-  // Handle running
-  _running = Game::Window::Instance().keyboard().keyDown(Game::Window::Key::LShift);
-
-  // Apply movement to player position
-  updateMove(doom, elapsed, movement);
-}
+    _input.strafe += 127;
 
-void  DOOM::PlayerThing::updateKeyboardWeapon(DOOM::Doom& doom, float elapsed)
-{
-  // Weapon binding
-  static const std::list<std::pair<Game::Window::Key, std::list<DOOM::Enum::Weapon>>> bindings = {
-    { Game::Window::Key::Num1, { DOOM::Enum::Weapon::WeaponChainsaw, DOOM::Enum::Weapon::WeaponFist } },
-    { Game::Window::Key::Num2, { DOOM::Enum::Weapon::WeaponPistol } },
-    { Game::Window::Key::Num3, { DOOM::Enum::Weapon::WeaponSuperShotgun, DOOM::Enum::Weapon::WeaponShotgun } },
-    { Game::Window::Key::Num4, { DOOM::Enum::Weapon::WeaponChaingun } },
-    { Game::Window::Key::Num5, { DOOM::Enum::Weapon::WeaponRocketLauncher } },
-    { Game::Window::Key::Num6, { DOOM::Enum::Weapon::WeaponPlasmaGun } },
-    { Game::Window::Key::Num7, { DOOM::Enum::Weapon::WeaponBFG9000 } },
+  // Weapon slots
+  static const std::array<Game::Window::Key, 7> slots = {
+    Game::Window::Key::Num1, Game::Window::Key::Num2, Game::Window::Key::Num3, Game::Window::Key::Num4,
+    Game::Window::Key::Num5, Game::Window::Key::Num6, Game::Window::Key::Num7
   };
 
-  // Attempt every bind
-  for (auto& bind : bindings) {
-    if (Game::Window::Instance().keyboard().keyPressed(bind.first) == true) {
-      for (auto weapon : bind.second) {
-        if (setWeapon(weapon) == true)
-          return;
-      }
-    }
+  _input.weapon = -1;
+  for (std::size_t slot = 0; slot < slots.size(); slot++)
+    if (_input.weapon == -1 && Game::Window::Instance().keyboard().keyPressed(slots[slot]) == true)
+      _input.weapon = (std::int8_t)slot;
+
+  // Controls
+  _input.down = 0;
+  _input.pressed = 0;
+  for (int action = 0; action < DOOM::PlayerThing::Control::ControlCount; action++) {
+    _input.down |= controlDevice((DOOM::PlayerThing::Control)action, false) ? (1 << action) : 0;
+    _input.pressed |= controlDevice((DOOM::PlayerThing::Control)action, true) ? (1 << action) : 0;
   }
 }
 
-void  DOOM::PlayerThing::updateController(DOOM::Doom & doom, float elapsed)
+void  DOOM::PlayerThing::updateInputController()
 {
-  updateControllerTurn(doom, elapsed);
-  updateControllerMove(doom, elapsed);
-}
+  // Dead zone and quantization of an axis
+  auto  axis = [this](Game::Window::JoystickAxis axis, float sign) {
+    float position = Game::Window::Instance().joystick().position(controller - 1, axis) / 100.f;
 
-void  DOOM::PlayerThing::updateControllerTurn(DOOM::Doom & doom, float elapsed)
-{
-  // Apply rotation to player
-  updateTurn(doom, elapsed,
-    std::abs(Game::Window::Instance().joystick().position(controller - 1, Game::Window::JoystickAxis::U)) / 100.f > 0.2f ? -Game::Window::Instance().joystick().position(controller - 1, Game::Window::JoystickAxis::U) / 100.f : 0.f,
-    std::abs(Game::Window::Instance().joystick().position(controller - 1, Game::Window::JoystickAxis::V)) / 100.f > 0.2f ? -Game::Window::Instance().joystick().position(controller - 1, Game::Window::JoystickAxis::V) / 100.f : 0.f
-  );
+    return (std::int8_t)(std::abs(position) > 0.2f ? std::clamp(sign * position, -1.f, +1.f) * 127.f : 0.f);
+    };
+
+  // Turn player
+  _input.horizontal = axis(Game::Window::JoystickAxis::U, -1.f);
+  _input.vertical = axis(Game::Window::JoystickAxis::V, -1.f);
+
+  // Move player
+  _input.forward = axis(Game::Window::JoystickAxis::Y, -1.f);
+  _input.strafe = axis(Game::Window::JoystickAxis::X, +1.f);
+
+  // No weapon slots on game pad
+  _input.weapon = -1;
+
+  // Controls
+  _input.down = 0;
+  _input.pressed = 0;
+  for (int action = 0; action < DOOM::PlayerThing::Control::ControlCount; action++) {
+    _input.down |= controlDevice((DOOM::PlayerThing::Control)action, false) ? (1 << action) : 0;
+    _input.pressed |= controlDevice((DOOM::PlayerThing::Control)action, true) ? (1 << action) : 0;
+  }
 }
 
-void  DOOM::PlayerThing::updateControllerMove(DOOM::Doom & doom, float elapsed)
+void  DOOM::PlayerThing::updateInputWeapon(DOOM::Doom& doom, float elapsed)
 {
-  // Move player
-  Math::Vector<2> movement(
-    std::abs(Game::Window::Instance().joystick().position(controller - 1, Game::Window::JoystickAxis::Y)) / 100.f > 0.2f ? -Game::Window::Instance().joystick().position(controller - 1, Game::Window::JoystickAxis::Y) / 100.f : 0.f,
-    std::abs(Game::Window::Instance().joystick().position(controller - 1, Game::Window::JoystickAxis::X)) / 100.f > 0.2f ? +Game::Window::Instance().joystick().position(controller - 1, Game::Window::JoystickAxis::X) / 100.f : 0.f
-  );
-  
-  // Handle running (left stick click)
-  if (movement.length() < 0.72f)
-    _running = false;
-  if (control(DOOM::PlayerThing::Control::ControlRun, true) == true)
-    _running = true;
+  // Weapon binding
+  static const std::array<std::list<DOOM::Enum::Weapon>, 7> bindings = {
+    std::list<DOOM::Enum::Weapon>{ DOOM::Enum::Weapon::WeaponChainsaw, DOOM::Enum::Weapon::WeaponFist },
+    std::list<DOOM::Enum::Weapon>{ DOOM::Enum::Weapon::WeaponPistol },
+    std::list<DOOM::Enum::Weapon>{ DOOM::Enum::Weapon::WeaponSuperShotgun, DOOM::Enum::Weapon::WeaponShotgun },
+    std::list<DOOM::Enum::Weapon>{ DOOM::Enum::Weapon::WeaponChaingun },
+    std::list<DOOM::Enum::Weapon>{ DOOM::Enum::Weapon::WeaponRocketLauncher },
+    std::list<DOOM::Enum::Weapon>{ DOOM::Enum::Weapon::WeaponPlasmaGun },
+    std::list<DOOM::Enum::Weapon>{ DOOM::Enum::Weapon::WeaponBFG9000 },
+  };
 
-  // Apply movement to player position
-  updateMove(doom, elapsed, movement);
+  // No weapon slot selected
+  if (_input.weapon < 0 || _input.weapon >= (int)bindings.size())
+    return;
+
+  // Attempt every weapon of slot
+  for (auto weapon : bindings[_input.weapon])
+    if (setWeapon(weapon) == true)
+      return;
 }
 
 void  DOOM::PlayerThing::updateTurn(DOOM::Doom & doom, float elapsed, float horizontal, float vertical)
@@ -1311,7 +1362,13 @@ void  DOOM::PlayerThing::updateFlash(DOOM::Doom& doom, float elapsed)
   }
 }
 
-bool  DOOM::PlayerThing::control(DOOM::PlayerThing::Control action, bool pressed)
+bool  DOOM::PlayerThing::control(DOOM::PlayerThing::Control action, bool pressed) const
+{
+  // Get control bit of current tic input
+  return (((pressed == true) ? _input.pressed : _input.down) & (1 << action)) ? true : false;
+}
+
+bool  DOOM::PlayerThing::controlDevice(DOOM::PlayerThing::Control action, bool pressed) const
 {
   // Keyboard
   if (controller == 0) {
@@ -1675,56 +1732,9 @@ void  DOOM::PlayerThing::P_FireWeapon(DOOM::Doom& doom)
 
 void  DOOM::PlayerThing::P_NoiseAlert(DOOM::Doom& doom, int16_t sector_index, int limit)
 {
-  // Initialize sound propagation map
-  std::unordered_map<int16_t, int>  sectors;
-
-  P_NoiseAlert(doom, sector_index, limit, sectors);
-}
-
-void  DOOM::PlayerThing::P_NoiseAlert(DOOM::Doom& doom, int16_t sector_index, int limit, std::unordered_map<int16_t, int>& sectors)
-{
-  // Limit reached
-  if (limit <= 0)
-    return;
-
-  // Check if sector has already been traversed
-  if (sectors.find(sector_index) == sectors.end())
-    sectors[sector_index] = limit;
-  else if (sectors[sector_index] < limit)
-    sectors[sector_index] = limit;
-  else
-    return;
-
-  auto& sector = doom.level.sectors[sector_index];
-
-  // Set current sector target
-  sector.sound_target = this;
-
-  for (const auto& linedef : doom.level.linedefs)
-  {
-    // Need sector on both sides
-    if (linedef->back == -1 || linedef->front == -1)
-      continue;
-
-    int16_t neighbor_index;
-
-    // Get adjacent sector index
-    if (doom.level.sidedefs[linedef->back].sector == sector_index)
-      neighbor_index = doom.level.sidedefs[linedef->front].sector;
-    else if (doom.level.sidedefs[linedef->front].sector == sector_index)
-      neighbor_index = doom.level.sidedefs[linedef->back].sector;
-    else
-      continue;
-
-    auto& neighbor = doom.level.sectors[neighbor_index];
-
-    // Door is closed
-    if (std::min(sector.ceiling_current, neighbor.ceiling_current) <= std::max(sector.floor_current, neighbor.floor_current))
-      continue;
-
-    // Propagate sound in neighbor sector
-    P_NoiseAlert(doom, neighbor_index, (linedef->flag & DOOM::AbstractLinedef::Flag::BlockSound) ? (limit - 1) : (limit), sectors);
-  }
+  // Make player sound target of every sector reached by sound
+  for (int16_t index : doom.level.adjacency.flood(doom.level.sectors, sector_index, limit))
+    doom.level.sectors[index].sound_target = this;
 }
 
 bool  DOOM::PlayerThing::P_CheckAmmo(DOOM::Doom& doom)
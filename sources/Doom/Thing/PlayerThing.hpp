@@ -6,6 +6,7 @@
 
 #include "Doom/Automap.hpp"
 #include "Doom/Camera.hpp"
+#include "Doom/Demo.hpp"
 #include "Doom/Statusbar.hpp"
 #include "Math/Vector.hpp"
 
@@ -98,13 +99,15 @@ namespace DOOM
     float _paletteDamage;
     float _paletteBerserk;
 
-    void  updateKeyboard(DOOM::Doom& doom, float elapsed);         // Update using keyboard
-    void  updateKeyboardTurn(DOOM::Doom& doom, float elapsed);     // Update using keyboard
-    void  updateKeyboardMove(DOOM::Doom& doom, float elapsed);     // Update using keyboard
-    void  updateKeyboardWeapon(DOOM::Doom& doom, float elapsed);   // Update using keyboard
-    void  updateController(DOOM::Doom& doom, float elapsed);       // Update using game pad
-    void  updateControllerTurn(DOOM::Doom& doom, float elapsed);   // Update using game pad
-    void  updateControllerMove(DOOM::Doom& doom, float elapsed);   // Update using game pad
+    DOOM::Demo::Input _input;   // Player input of current tic
+    std::uint16_t     _pressed; // Controls pressed in frames since last tic
+    std::int8_t       _slot;    // Weapon slot selected in frames since last tic (-1 if none)
+
+    void  updateInput(DOOM::Doom& doom);                          // Read player input from controller, record or replay it with demo
+    void  updateInputDevice();                                    // Read player input from keyboard or game pad
+    void  updateInputKeyboard();                                  // Read player input from keyboard
+    void  updateInputController();                                // Read player input from game pad
+    void  updateInputWeapon(DOOM::Doom& doom, float elapsed);     // Select weapon from input slot
 
     void  updateTurn(DOOM::Doom& doom, float elapsed, float horizontal, float vertical); // Update player angle
     void  updateMove(DOOM::Doom& doom, float elapsed, Math::Vector<2> movement);         // Update player position
@@ -167,7 +170,6 @@ namespace DOOM
     void  P_BringUpWeapon(DOOM::Doom& doom);                                                                          // Starts bringing the pending weapon up from the bottom of the screen.
     void  P_GunShot(DOOM::Doom& doom, float dispersion, float damage);                                                // Simple gun shot
     void  P_NoiseAlert(DOOM::Doom& doom, int16_t sector_index, int limit = 2);                                        // Make player sound target of adjacent sectors
-    void  P_NoiseAlert(DOOM::Doom& doom, int16_t sector_index, int limit, std::unordered_map<int16_t, int>& sectors); // Make player sound target of adjacent sectors
 
     enum Control
     {
@@ -185,7 +187,8 @@ namespace DOOM
       ControlCount
     };
 
-    bool  control(DOOM::PlayerThing::Control action, bool pressed = false);
+    bool  control(DOOM::PlayerThing::Control action, bool pressed = false) const;       // Get control state from current tic input
+    bool  controlDevice(DOOM::PlayerThing::Control action, bool pressed = false) const; // Get control state from player controller
 
     void  drawCamera(DOOM::Doom& doom, sf::Image& target, Math::Box<2, std::int16_t> rect, unsigned int scale, std::int16_t palette);     // Render player camera
     void  drawWeapon(DOOM::Doom& doom, sf::Image& target, Math::Box<2, std::int16_t> rect, unsigned int scale, std::int16_t palette);     // Render player weapon and muzzle flash
@@ -205,6 +208,7 @@ namespace DOOM
     void  reset(DOOM::Doom& doom, bool hard = false); // Reset player to begin level
 
     bool  update(DOOM::Doom& doom, float elapsed) override; // Update player using controller, alway return false as a player thing is never deleted
+    void  poll();                                           // Accumulate controls pressed this frame, consumed by next tic
     bool  key(DOOM::Enum::KeyColor color) const override;   // Return true if player has the key
 
     void  draw(DOOM::Doom& doom, sf::Image& target, Math::Box<2, std::int16_t> rect, unsigned int scale); // Render player on target
@@ -1,3 +1,5 @@
+#include <algorithm>
+#include <cmath>
 #include <stdexcept>
 
 #include "GameBoyColor/AudioProcessingUnit.hpp"
@@ -6,12 +8,39 @@
 
 #include "System/Window.hpp"
 
+const std::array<std::array<float, GBC::AudioProcessingUnit::BlepWidth>, GBC::AudioProcessingUnit::BlepPhases> GBC::AudioProcessingUnit::_blep = []() {
+  std::array<std::array<float, GBC::AudioProcessingUnit::BlepWidth>, GBC::AudioProcessingUnit::BlepPhases> blep = {};
+
+  // Blackman-windowed sinc, cut slightly below Nyquist frequency
+  for (std::size_t phase = 0; phase < GBC::AudioProcessingUnit::BlepPhases; phase++) {
+    double  sum = 0.;
+
+    for (std::size_t sample = 0; sample < GBC::AudioProcessingUnit::BlepWidth; sample++) {
+      double  x = (double)sample + 1. - GBC::AudioProcessingUnit::BlepWidth / 2. - (double)phase / GBC::AudioProcessingUnit::BlepPhases;
+      double  sinc = (x == 0.) ? 1. : std::sin(Math::Pi * 0.9 * x) / (Math::Pi * 0.9 * x);
+      double  window = 0.42 + 0.5 * std::cos(2. * Math::Pi * x / GBC::AudioProcessingUnit::BlepWidth) + 0.08 * std::cos(4. * Math::Pi * x / GBC::AudioProcessingUnit::BlepWidth);
+
+      blep[phase][sample] = (float)(sinc * window);
+      sum += sinc * window;
+    }
+
+    // Normalize so steps reach their exact level
+    for (auto& value : blep[phase])
+      value = (float)(value / sum);
+  }
+
+  return blep;
+}();
+
 GBC::AudioProcessingUnit::AudioProcessingUnit(GBC::GameBoyColor& gbc) :
   _gbc(gbc),
   _sound1{ 0 },
   _sound2{ 0 },
   _sound3{ 0 },
   _sound4{ 0 },
+  _deltas{ 0 },
+  _levels{ 0 },
+  _outputs{ 0 },
   _sound{ 0 }
 {
   // Initialize audio
@@ -34,125 +63,179 @@ GBC::AudioProcessingUnit::AudioProcessingUnit(GBC::GameBoyColor& gbc) :
 
 void  GBC::AudioProcessingUnit::simulate()
 {
-  // Time between two samples
-  const float delta = (float)(456 * 154) / (float)(4 * 1024 * 1024) / (float)GBC::AudioProcessingUnit::FrameSize;
+  // Duration of a frame of sound (seconds)
+  const float duration = (float)GBC::PixelProcessingUnit::FrameDuration / (float)GBC::CentralProcessingUnit::Frequency;
 
-  std::array<float, GBC::AudioProcessingUnit::FrameSize>  channel1 = { 0 };
-  std::array<float, GBC::AudioProcessingUnit::FrameSize>  channel2 = { 0 };
-  std::array<float, GBC::AudioProcessingUnit::FrameSize>  channel3 = { 0 };
-  std::array<float, GBC::AudioProcessingUnit::FrameSize>  channel4 = { 0 };
+  // Record amplitude changes of each channel
+  simulateSound1(duration);
+  simulateSound2(duration);
+  simulateSound3(duration);
+  simulateSound4(duration);
 
-  // Channel 1
-  for (std::size_t index = 0; index < channel1.size(); index++)
-  {
-    // No envelope
-    if (_sound1.envelope == 0.f && _sound1.envelopeDirection == false)
-      break;
+  // Turn amplitude changes into samples
+  simulateMixer();
+}
 
-    // Sound duration
-    _sound1.length = std::max(0.f, _sound1.length - delta);
-    if (_sound1.length <= 0.f)
+void  GBC::AudioProcessingUnit::simulateSound1(float duration)
+{
+  for (float time = 0.f; time < duration;)
+  {
+    // No envelope, sound duration elapsed or frequency out of range
+    if ((_sound1.envelope == 0.f && _sound1.envelopeDirection == false) || _sound1.length <= 0.f || !(_sound1.frequency > 0.f && _sound1.frequency <= 131072.f)) {
+      step(0, time, 0.f);
       break;
+    }
 
     // Limit wave clock to one oscillation
-    _sound1.clock = Math::Modulo(_sound1.clock, 1.f / _sound1.frequency);
+    const float period = 1.f / _sound1.frequency;
+    const float duty = period * _sound1.wave;
+
+    _sound1.clock = Math::Modulo(_sound1.clock, period);
 
     // Generate wave form
-    channel1[index] = _sound1.envelope * ((_sound1.clock < 1.f / _sound1.frequency * _sound1.wave) ? -1.f : +1.f);
+    const bool  high = _sound1.clock >= duty;
 
-    // Tick wave clock
-    _sound1.clock += delta;
+    step(0, time, _sound1.envelope * (high ? +1.f : -1.f));
+
+    // Time to next wave edge, frequency sweep, envelope change, end of sound or end of frame
+    const float edge = (high ? period : duty) - _sound1.clock;
+    const float elapsed = std::max(0.f, std::min({ duration - time, edge, _sound1.length, _sound1.frequencyTime - _sound1.frequencyElapsed, _sound1.envelopeTime - _sound1.envelopeElapsed }));
+
+    // Sound duration
+    time += elapsed;
+    _sound1.length = std::max(0.f, _sound1.length - elapsed);
+
+    // Tick wave clock, snap to edge to avoid rounding errors
+    _sound1.clock = (elapsed == edge) ? (high ? 0.f : duty) : _sound1.clock + elapsed;
 
     // Frequency sweep
-    for (_sound1.frequencyElapsed += delta;
+    for (_sound1.frequencyElapsed += elapsed;
       _sound1.frequencyElapsed >= _sound1.frequencyTime;
       _sound1.frequencyElapsed -= _sound1.frequencyTime)
       _sound1.frequency += (_sound1.frequencyDirection ? -1.f : +1.f) * _sound1.frequency * _sound1.frequencyShift;
 
     // Envelope change
-    for (_sound1.envelopeElapsed += delta;
+    for (_sound1.envelopeElapsed += elapsed;
       _sound1.envelopeElapsed >= _sound1.envelopeTime;
       _sound1.envelopeElapsed -= _sound1.envelopeTime)
       _sound1.envelope = std::clamp(_sound1.envelope + (_sound1.envelopeDirection ? +1.f / 16.f : -1.f / 16.f), 0.f, 1.f);
   }
+}
 
-  // Channel 2
-  for (std::size_t index = 0; index < channel2.size(); index++)
+void  GBC::AudioProcessingUnit::simulateSound2(float duration)
+{
+  for (float time = 0.f; time < duration;)
   {
-    // No envelope
-    if (_sound2.envelope == 0.f && _sound2.envelopeDirection == false)
-      break;
-
-    // Sound duration
-    _sound2.length = std::max(0.f, _sound2.length - delta);
-    if (_sound2.length <= 0.f)
+    // No envelope, sound duration elapsed or frequency out of range
+    if ((_sound2.envelope == 0.f && _sound2.envelopeDirection == false) || _sound2.length <= 0.f || !(_sound2.frequency > 0.f && _sound2.frequency <= 131072.f)) {
+      step(1, time, 0.f);
       break;
+    }
 
     // Limit wave clock to one oscillation
-    _sound2.clock = Math::Modulo(_sound2.clock, 1.f / _sound2.frequency);
+    const float period = 1.f / _sound2.frequency;
+    const float duty = period * _sound2.wave;
+
+    _sound2.clock = Math::Modulo(_sound2.clock, period);
 
     // Generate wave form
-    channel2[index] = _sound2.envelope * ((_sound2.clock < 1.f / _sound2.frequency * _sound2.wave) ? -1.f : +1.f);
+    const bool  high = _sound2.clock >= duty;
 
-    // Tick wave clock
-    _sound2.clock += delta;
+    step(1, time, _sound2.envelope * (high ? +1.f : -1.f));
+
+    // Time to next wave edge, envelope change, end of sound or end of frame
+    const float edge = (high ? period : duty) - _sound2.clock;
+    const float elapsed = std::max(0.f, std::min({ duration - time, edge, _sound2.length, _sound2.envelopeTime - _sound2.envelopeElapsed }));
+
+    // Sound duration
+    time += elapsed;
+    _sound2.length = std::max(0.f, _sound2.length - elapsed);
+
+    // Tick wave clock, snap to edge to avoid rounding errors
+    _sound2.clock = (elapsed == edge) ? (high ? 0.f : duty) : _sound2.clock + elapsed;
 
     // Envelope change
-    for (_sound2.envelopeElapsed += delta;
+    for (_sound2.envelopeElapsed += elapsed;
       _sound2.envelopeElapsed >= _sound2.envelopeTime;
       _sound2.envelopeElapsed -= _sound2.envelopeTime)
       _sound2.envelope = std::clamp(_sound2.envelope + (_sound2.envelopeDirection ? +1.f / 16.f : -1.f / 16.f), 0.f, 1.f);
   }
+}
 
-  // Channel 3
-  for (std::size_t index = 0; index < channel3.size(); index++)
-  {
-    // Sound stopped
-    if (!(_gbc._io[IO::NR30] & 0b10000000))
-      break;
+void  GBC::AudioProcessingUnit::simulateSound3(float duration)
+{
+  // Sound stopped, no envelope, sound duration elapsed or frequency out of range
+  if (!(_gbc._io[IO::NR30] & 0b10000000) || _sound3.envelope == 0.f || _sound3.length <= 0.f || !(_sound3.frequency > 0.f && _sound3.frequency <= 65536.f)) {
+    step(2, 0.f, 0.f);
+    return;
+  }
 
-    // No envelope
-    if (_sound3.envelope == 0.f)
-      break;
+  // Limit wave clock to one oscillation, frequency is constant during frame
+  const float period = 1.f / _sound3.frequency;
+  const float width = period / (float)_sound3.wave.size();
 
-    // Sound duration
-    _sound3.length = std::max(0.f, _sound3.length - delta);
-    if (_sound3.length <= 0.f)
-      break;
+  _sound3.clock = Math::Modulo(_sound3.clock, period);
 
-    // Limit wave clock to one oscillation
-    _sound3.clock = Math::Modulo(_sound3.clock, 1.f / _sound3.frequency);
+  // Index of current sample of wave, kept to avoid rounding errors
+  std::size_t index = std::min((std::size_t)(_sound3.clock / width), _sound3.wave.size() - 1);
+
+  for (float time = 0.f; time < duration;)
+  {
+    // Sound duration elapsed
+    if (_sound3.length <= 0.f) {
+      step(2, time, 0.f);
+      break;
+    }
 
     // Generate wave form
-    channel3[index] = _sound3.envelope * _sound3.wave[(std::size_t)(_sound3.clock * _sound3.frequency * 32.f)];
+    step(2, time, _sound3.envelope * _sound3.wave[index]);
+
+    // Time to next wave sample, end of sound or end of frame
+    const float edge = std::max(0.f, (index + 1) * width - _sound3.clock);
+    const float elapsed = std::max(0.f, std::min({ duration - time, edge, _sound3.length }));
+
+    // Sound duration
+    time += elapsed;
+    _sound3.length = std::max(0.f, _sound3.length - elapsed);
 
     // Tick wave clock
-    _sound3.clock += delta;
+    if (elapsed == edge) {
+      index = (index + 1) % _sound3.wave.size();
+      _sound3.clock = index * width;
+    }
+    else
+      _sound3.clock += elapsed;
   }
+}
 
-  // Channel 4
-  for (std::size_t index = 0; index < channel4.size(); index++)
+void  GBC::AudioProcessingUnit::simulateSound4(float duration)
+{
+  for (float time = 0.f; time < duration;)
   {
-    // No envelope
-    if (_sound4.envelope == 0.f && _sound4.envelopeDirection == false)
-      break;
-
-    // Sound duration
-    _sound4.length = std::max(0.f, _sound4.length - delta);
-    if (_sound4.length <= 0.f)
+    // No envelope or sound duration elapsed
+    if ((_sound4.envelope == 0.f && _sound4.envelopeDirection == false) || _sound4.length <= 0.f) {
+      step(3, time, 0.f);
       break;
+    }
 
     // Generate wave form
-    channel4[index] = _sound4.counter * _sound4.envelope;
+    step(3, time, _sound4.counter * _sound4.envelope);
+
+    // Time to next LFSR step, envelope change, end of sound or end of frame
+    const float elapsed = std::max(0.f, std::min({ duration - time, _sound4.length, _sound4.counterTime - _sound4.counterElapsed, _sound4.envelopeTime - _sound4.envelopeElapsed }));
+
+    // Sound duration
+    time += elapsed;
+    _sound4.length = std::max(0.f, _sound4.length - elapsed);
 
     // Envelope change
-    for (_sound4.envelopeElapsed += delta;
+    for (_sound4.envelopeElapsed += elapsed;
       _sound4.envelopeElapsed >= _sound4.envelopeTime;
       _sound4.envelopeElapsed -= _sound4.envelopeTime)
       _sound4.envelope = std::clamp(_sound4.envelope + (_sound4.envelopeDirection ? +1.f / 16.f : -1.f / 16.f), 0.f, 1.f);
 
     // LFSR step
-    for (_sound4.counterElapsed += delta;
+    for (_sound4.counterElapsed += elapsed;
       _sound4.counterElapsed >= _sound4.counterTime;
       _sound4.counterElapsed -= _sound4.counterTime) {
       bool  left = (_sound4.counterValue & (0b0000000000000001 << (_sound4.counterWidth - 1))) ? true : false;
@@ -165,42 +248,49 @@ void  GBC::AudioProcessingUnit::simulate()
       }
     }
   }
-  
-  // Mixer and amplifier
-  float leftVolume = (((_gbc._io[IO::NR50] & 0b01110000) >> 4) + 1) / 8.f;
-  float rightVolume = (((_gbc._io[IO::NR50] & 0b00000111) >> 0) + 1) / 8.f;
-
-  for (std::size_t index = 0; index < _sound.size() / 2; index++) {
-    float leftSample = 0.f;
-    float rightSample = 0.f;
-
-    // Accumulate right channel
-    if (_gbc._io[IO::NR51] & 0b00000001)
-      rightSample += channel1[index];
-    if (_gbc._io[IO::NR51] & 0b00000010)
-      rightSample += channel2[index];
-    if (_gbc._io[IO::NR51] & 0b00000100)
-      rightSample += channel3[index];
-    if (_gbc._io[IO::NR51] & 0b00001000)
-      rightSample += channel4[index];
-
-    // Accumulate left channel
-    if (_gbc._io[IO::NR51] & 0b00010000)
-      leftSample += channel1[index];
-    if (_gbc._io[IO::NR51] & 0b00100000)
-      leftSample += channel2[index];
-    if (_gbc._io[IO::NR51] & 0b01000000)
-      leftSample += channel3[index];
-    if (_gbc._io[IO::NR51] & 0b10000000)
-      leftSample += channel4[index];
-
-    // Normalize samples
-    leftSample /= 4.f;
-    rightSample /= 4.f;
-
-    // Add to sound buffer
-    _sound[index * 2 + 0] = (std::uint16_t)(leftSample * leftVolume * 32767.f);
-    _sound[index * 2 + 1] = (std::uint16_t)(rightSample * rightVolume * 32767.f);
+}
+
+void  GBC::AudioProcessingUnit::simulateMixer()
+{
+  // Integrate band-limited steps into samples
+  for (std::size_t index = 0; index < GBC::AudioProcessingUnit::FrameSize; index++) {
+    for (std::size_t channel = 0; channel < GBC::AudioProcessingUnit::ChannelCount; channel++) {
+      _outputs[channel] += _deltas[channel][index];
+      _sound[index * GBC::AudioProcessingUnit::ChannelCount + channel] = (std::int16_t)std::clamp(_outputs[channel] * 32767.f, -32768.f, +32767.f);
+    }
+  }
+
+  // Move kernel tails to the beginning of next frame
+  for (auto& deltas : _deltas) {
+    std::copy(deltas.begin() + GBC::AudioProcessingUnit::FrameSize, deltas.end(), deltas.begin());
+    std::fill(deltas.begin() + GBC::AudioProcessingUnit::BlepWidth, deltas.end(), 0.f);
+  }
+}
+
+void  GBC::AudioProcessingUnit::step(std::size_t channel, float time, float amplitude)
+{
+  // Position of amplitude change in samples of frame
+  const float       position = time * (float)GBC::CentralProcessingUnit::Frequency / (float)GBC::PixelProcessingUnit::FrameDuration * (float)GBC::AudioProcessingUnit::FrameSize;
+  const std::size_t index = std::min((std::size_t)position, GBC::AudioProcessingUnit::FrameSize);
+  const auto&       kernel = _blep[std::min((std::size_t)((position - index) * GBC::AudioProcessingUnit::BlepPhases), GBC::AudioProcessingUnit::BlepPhases - 1)];
+
+  // Mixer and amplifier, channels are normalized to allow four at full volume
+  const std::array<float, GBC::AudioProcessingUnit::ChannelCount> levels = {
+    (_gbc._io[IO::NR51] & (0b00010000 << channel)) ? amplitude / 4.f * (((_gbc._io[IO::NR50] & 0b01110000) >> 4) + 1) / 8.f : 0.f,
+    (_gbc._io[IO::NR51] & (0b00000001 << channel)) ? amplitude / 4.f * (((_gbc._io[IO::NR50] & 0b00000111) >> 0) + 1) / 8.f : 0.f
+  };
+
+  // Record level difference as a band-limited step
+  for (std::size_t output = 0; output < GBC::AudioProcessingUnit::ChannelCount; output++) {
+    const float delta = levels[output] - _levels[channel][output];
+
+    // No change
+    if (delta == 0.f)
+      continue;
+
+    _levels[channel][output] = levels[output];
+    for (std::size_t sample = 0; sample < GBC::AudioProcessingUnit::BlepWidth; sample++)
+      _deltas[output][index + sample] += delta * kernel[sample];
   }
 }
 
@@ -553,20 +643,35 @@ const std::array<std::int16_t, GBC::AudioProcessingUnit::BufferSize>& GBC::Audio
   return _sound;
 }
 
-void  GBC::AudioProcessingUnit::save(std::ofstream& file) const
+void  GBC::AudioProcessingUnit::save(GBC::SaveState& state) const
 {
   // Save APU variables
-  _gbc.save(file, "APU_SOUND1", _sound1);
-  _gbc.save(file, "APU_SOUND2", _sound2);
-  _gbc.save(file, "APU_SOUND3", _sound3);
-  _gbc.save(file, "APU_SOUND4", _sound4);
+  _gbc.save(state, "APU_SOUND1", _sound1);
+  _gbc.save(state, "APU_SOUND2", _sound2);
+  _gbc.save(state, "APU_SOUND3", _sound3);
+  _gbc.save(state, "APU_SOUND4", _sound4);
+  _gbc.save(state, "APU_DELTAS", _deltas);
+  _gbc.save(state, "APU_LEVELS", _levels);
+  _gbc.save(state, "APU_OUTPUTS", _outputs);
 }
 
-void  GBC::AudioProcessingUnit::load(std::ifstream& file)
+void  GBC::AudioProcessingUnit::load(GBC::LoadState& state)
 {
   // Load APU variables
-  _gbc.load(file, "APU_SOUND1", _sound1);
-  _gbc.load(file, "APU_SOUND2", _sound2);
-  _gbc.load(file, "APU_SOUND3", _sound3);
-  _gbc.load(file, "APU_SOUND4", _sound4);
+  _gbc.load(state, "APU_SOUND1", _sound1);
+  _gbc.load(state, "APU_SOUND2", _sound2);
+  _gbc.load(state, "APU_SOUND3", _sound3);
+  _gbc.load(state, "APU_SOUND4", _sound4);
+
+  // Missing in text states older than band-limited synthesis, restart from silence
+  if (_gbc.loadExists(state, "APU_DELTAS") == false) {
+    _deltas = {};
+    _levels = {};
+    _outputs = {};
+    return;
+  }
+
+  _gbc.load(state, "APU_DELTAS", _deltas);
+  _gbc.load(state, "APU_LEVELS", _levels);
+  _gbc.load(state, "APU_OUTPUTS", _outputs);
 }
\ No newline at end of file
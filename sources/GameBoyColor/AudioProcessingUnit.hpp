@@ -10,6 +10,8 @@
 namespace GBC
 {
   class GameBoyColor;
+  struct LoadState;
+  struct SaveState;
 
   class AudioProcessingUnit
   {
@@ -18,6 +20,8 @@ namespace GBC
     static const std::size_t  ChannelCount = 2;                                                                                                                                                                                 // Number of sound channels
     static const std::size_t  FrameSize = SampleRate * (GBC::PixelProcessingUnit::ScanlineDuration * (GBC::PixelProcessingUnit::ScreenHeight + GBC::PixelProcessingUnit::ScreenBlank)) / GBC::CentralProcessingUnit::Frequency; // Number of sample in each frame of sound
     static const std::size_t  BufferSize = FrameSize * ChannelCount;                                                                                                                                                            // Size of a sound buffer
+    static constexpr std::size_t  BlepWidth = 16;   // Number of samples of band-limited step kernel
+    static constexpr std::size_t  BlepPhases = 32;  // Number of sub-sample positions of band-limited step kernel
 
     enum IO : std::uint8_t
     {
@@ -113,8 +117,22 @@ namespace GBC
       float         counterElapsed;     // Elapsed time since last LFSR change
     } _sound4;  // Data of sound channel 4
 
+    static const std::array<std::array<float, GBC::AudioProcessingUnit::BlepWidth>, GBC::AudioProcessingUnit::BlepPhases> _blep;  // Band-limited impulse kernel by sub-sample phase, integrated into a step
+
+    std::array<std::array<float, GBC::AudioProcessingUnit::FrameSize + GBC::AudioProcessingUnit::BlepWidth>, GBC::AudioProcessingUnit::ChannelCount> _deltas;  // Band-limited amplitude changes of current frame by output channel, kernel tail spills over next frame
+    std::array<std::array<float, GBC::AudioProcessingUnit::ChannelCount>, 4>                                                                          _levels;  // Last level of each sound channel in each output channel
+    std::array<float, GBC::AudioProcessingUnit::ChannelCount>                                                                                         _outputs; // Integrated level of each output channel
+
     std::array<std::int16_t, GBC::AudioProcessingUnit::BufferSize> _sound; // Sound buffer of current frame
 
+    void  simulateSound1(float duration); // Record amplitude changes of sound channel 1 for a frame
+    void  simulateSound2(float duration); // Record amplitude changes of sound channel 2 for a frame
+    void  simulateSound3(float duration); // Record amplitude changes of sound channel 3 for a frame
+    void  simulateSound4(float duration); // Record amplitude changes of sound channel 4 for a frame
+    void  simulateMixer();                // Integrate amplitude changes of frame to sound buffer
+
+    void  step(std::size_t channel, float time, float amplitude); // Record amplitude of a sound channel at a time of frame (seconds)
+
   public:
     AudioProcessingUnit(GBC::GameBoyColor& gbc);
     ~AudioProcessingUnit() = default;
@@ -126,7 +144,7 @@ namespace GBC
 
     const std::array<std::int16_t, GBC::AudioProcessingUnit::BufferSize>& sound() const;  // Get sound buffer
 
-    void  save(std::ofstream& file) const;  // Save state to file
-    void  load(std::ifstream& file);        // Load state from file
+    void  save(GBC::SaveState& state) const;  // Save state
+    void  load(GBC::LoadState& state);        // Load state
   };
 }
\ No newline at end of file
@@ -559,6 +559,554 @@ constexpr const std::array<GBC::CentralProcessingUnit::Opcode, 5> GBC::CentralPr
   [](GBC::CentralProcessingUnit& cpu) { cpu.instruction_RET_c_execute(); }    // Execute function return
 };
 
+constexpr const std::array<GBC::CentralProcessingUnit::Record, 256> GBC::CentralProcessingUnit::_records = {
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { }, 0, 1, 1 },                                                                   // 0x00, 0b00000000: NOP
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_rr_nn(cpu._rBC, record); }, 0, 3, 3 },                              // 0x01, 0b00000001: LD BC, nn
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_prr_A(cpu._rBC); }, 0, 1, 2 },                                      // 0x02, 0b00000010: LD (BC), A
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_INC_rr(cpu._rBC); }, 0, 1, 2 },                                        // 0x03, 0b00000011: INC BC
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_INC_r(cpu._rBC.u8.high); }, 0, 1, 1 },                                 // 0x04, 0b00000100: INC B
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_DEC_r(cpu._rBC.u8.high); }, 0, 1, 1 },                                 // 0x05, 0b00000101: DEC B
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rBC.u8.high, (std::uint8_t)record.operand); }, 0, 2, 2 },  // 0x06, 0b00000110: LD B, n
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RLCA(); }, 0, 1, 1 },                                                  // 0x07, 0b00000111: RLCA
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_pnn_SP(record); }, 0, 3, 5 },                                       // 0x08, 0b00001000: LD (nn), SP
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_ADD_HL_rr(cpu._rBC); }, 0, 1, 2 },                                     // 0x09, 0b00001001: ADD HL, BC
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_A_prr(cpu._rBC); }, 0, 1, 2 },                                      // 0x0A, 0b00001010: LD A, (BC)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_DEC_rr(cpu._rBC); }, 0, 1, 2 },                                        // 0x0B, 0b00001011: DEC BC
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_INC_r(cpu._rBC.u8.low); }, 0, 1, 1 },                                  // 0x0C, 0b00001100: INC C
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_DEC_r(cpu._rBC.u8.low); }, 0, 1, 1 },                                  // 0x0D, 0b00001101: DEC C
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rBC.u8.low, (std::uint8_t)record.operand); }, 0, 2, 2 },   // 0x0E, 0b00001110: LD C, n
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RRCA(); }, 0, 1, 1 },                                                  // 0x0F, 0b00001111: RRCA
+
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_STOP(); }, 0, 2, 2 },                                                  // 0x10, 0b00010000: STOP (0x10 & 0x00)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_rr_nn(cpu._rDE, record); }, 0, 3, 3 },                              // 0x11, 0b00010001: LD DE, nn
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_prr_A(cpu._rDE); }, 0, 1, 2 },                                      // 0x12, 0b00010010: LD (DE), A
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_INC_rr(cpu._rDE); }, 0, 1, 2 },                                        // 0x13, 0b00010011: INC DE
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_INC_r(cpu._rDE.u8.high); }, 0, 1, 1 },                                 // 0x14, 0b00010100: INC D
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_DEC_r(cpu._rDE.u8.high); }, 0, 1, 1 },                                 // 0x15, 0b00010101: DEC D
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rDE.u8.high, (std::uint8_t)record.operand); }, 0, 2, 2 },  // 0x16, 0b00010110: LD D, n
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RLA(); }, 0, 1, 1 },                                                   // 0x17, 0b00010111: RLA
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_JR_n(record); }, 0, 2, 3 },                                            // 0x18, 0b00011000: JR n
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_ADD_HL_rr(cpu._rDE); }, 0, 1, 2 },                                     // 0x19, 0b00011001: ADD HL, DE
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_A_prr(cpu._rDE); }, 0, 1, 2 },                                      // 0x1A, 0b00011010: LD A, (DE)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_DEC_rr(cpu._rDE); }, 0, 1, 2 },                                        // 0x1B, 0b00011011: DEC DE
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_INC_r(cpu._rDE.u8.low); }, 0, 1, 1 },                                  // 0x1C, 0b00011100: INC E
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_DEC_r(cpu._rDE.u8.low); }, 0, 1, 1 },                                  // 0x1D, 0b00011101: DEC E
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rDE.u8.low, (std::uint8_t)record.operand); }, 0, 2, 2 },   // 0x1E, 0b00011110: LD E, n
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RRA(); }, 0, 1, 1 },                                                   // 0x1F, 0b00011111: RRA
+
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_JR_c0_n(Register::Z, record); }, 0, 2, 2 },                            // 0x20, 0b00100000: JR NZ, n
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_rr_nn(cpu._rHL, record); }, 0, 3, 3 },                              // 0x21, 0b00100001: LD HL, nn
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_HLi_A(); }, 0, 1, 2 },                                              // 0x22, 0b00100010: LD (HL+), A
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_INC_rr(cpu._rHL); }, 0, 1, 2 },                                        // 0x23, 0b00100011: INC HL
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_INC_r(cpu._rHL.u8.high); }, 0, 1, 1 },                                 // 0x24, 0b00100100: INC H
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_DEC_r(cpu._rHL.u8.high); }, 0, 1, 1 },                                 // 0x25, 0b00100101: DEC H
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rHL.u8.high, (std::uint8_t)record.operand); }, 0, 2, 2 },  // 0x26, 0b00100110: LD H, n
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_DAA(); }, 0, 1, 1 },                                                   // 0x27, 0b00100111: DAA
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_JR_c1_n(Register::Z, record); }, 0, 2, 2 },                            // 0x28, 0b00101000: JR Z, n
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_ADD_HL_rr(cpu._rHL); }, 0, 1, 2 },                                     // 0x29, 0b00101001: ADD HL, HL
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_A_HLi(); }, 0, 1, 2 },                                              // 0x2A, 0b00101010: LD A, (HL+)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_DEC_rr(cpu._rHL); }, 0, 1, 2 },                                        // 0x2B, 0b00101011: DEC HL
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_INC_r(cpu._rHL.u8.low); }, 0, 1, 1 },                                  // 0x2C, 0b00101100: INC L
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_DEC_r(cpu._rHL.u8.low); }, 0, 1, 1 },                                  // 0x2D, 0b00101101: DEC L
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rHL.u8.low, (std::uint8_t)record.operand); }, 0, 2, 2 },   // 0x2E, 0b00101110: LD L, n
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_CPL(); }, 0, 1, 1 },                                                   // 0x2F, 0b00101111: CPL
+
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_JR_c0_n(Register::C, record); }, 0, 2, 2 },                            // 0x30, 0b00110000: JR NC, n
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_rr_nn(cpu._rSP, record); }, 0, 3, 3 },                              // 0x31, 0b00110001: LD SP, nn
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_HLd_A(); }, 0, 1, 2 },                                              // 0x32, 0b00110010: LD (HL-), A
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_INC_rr(cpu._rSP); }, 0, 1, 2 },                                        // 0x33, 0b00110011: INC SP
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_pHL<&GBC::CentralProcessingUnit::fast_INC_r>(); }, 0, 1, 3 },          // 0x34, 0b00110100: INC (HL)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_pHL<&GBC::CentralProcessingUnit::fast_DEC_r>(); }, 0, 1, 3 },          // 0x35, 0b00110101: DEC (HL)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_pHL_r((std::uint8_t)record.operand); }, 0, 2, 3 },                  // 0x36, 0b00110110: LD (HL), n
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SCF(); }, 0, 1, 1 },                                                   // 0x37, 0b00110111: SCF
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_JR_c1_n(Register::C, record); }, 0, 2, 2 },                            // 0x38, 0b00111000: JR C, n
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_ADD_HL_rr(cpu._rSP); }, 0, 1, 2 },                                     // 0x39, 0b00111001: ADD HL, SP
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_A_HLd(); }, 0, 1, 2 },                                              // 0x3A, 0b00111010: LD A, (HL-)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_DEC_rr(cpu._rSP); }, 0, 1, 2 },                                        // 0x3B, 0b00111011: DEC SP
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_INC_r(cpu._rAF.u8.high); }, 0, 1, 1 },                                 // 0x3C, 0b00111100: INC A
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_DEC_r(cpu._rAF.u8.high); }, 0, 1, 1 },                                 // 0x3D, 0b00111101: DEC A
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rAF.u8.high, (std::uint8_t)record.operand); }, 0, 2, 2 },  // 0x3E, 0b00111110: LD A, n
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_CCF(); }, 0, 1, 1 },                                                   // 0x3F, 0b00111111: CCF
+
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rBC.u8.high, cpu._rBC.u8.high); }, 0, 1, 1 },             // 0x40, 0b01000000: LD B, B
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rBC.u8.high, cpu._rBC.u8.low); }, 0, 1, 1 },              // 0x41, 0b01000001: LD B, C
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rBC.u8.high, cpu._rDE.u8.high); }, 0, 1, 1 },             // 0x42, 0b01000010: LD B, D
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rBC.u8.high, cpu._rDE.u8.low); }, 0, 1, 1 },              // 0x43, 0b01000011: LD B, E
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rBC.u8.high, cpu._rHL.u8.high); }, 0, 1, 1 },             // 0x44, 0b01000100: LD B, H
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rBC.u8.high, cpu._rHL.u8.low); }, 0, 1, 1 },              // 0x45, 0b01000101: LD B, L
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rBC.u8.high, cpu._gbc.read(cpu._rHL.u16)); }, 0, 1, 2 },  // 0x46, 0b01000110: LD B, (HL)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rBC.u8.high, cpu._rAF.u8.high); }, 0, 1, 1 },             // 0x47, 0b01000111: LD B, A
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rBC.u8.low, cpu._rBC.u8.high); }, 0, 1, 1 },              // 0x48, 0b01001000: LD C, B
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rBC.u8.low, cpu._rBC.u8.low); }, 0, 1, 1 },               // 0x49, 0b01001001: LD C, C
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rBC.u8.low, cpu._rDE.u8.high); }, 0, 1, 1 },              // 0x4A, 0b01001010: LD C, D
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rBC.u8.low, cpu._rDE.u8.low); }, 0, 1, 1 },               // 0x4B, 0b01001011: LD C, E
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rBC.u8.low, cpu._rHL.u8.high); }, 0, 1, 1 },              // 0x4C, 0b01001100: LD C, H
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rBC.u8.low, cpu._rHL.u8.low); }, 0, 1, 1 },               // 0x4D, 0b01001101: LD C, L
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rBC.u8.low, cpu._gbc.read(cpu._rHL.u16)); }, 0, 1, 2 },   // 0x4E, 0b01001110: LD C, (HL)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rBC.u8.low, cpu._rAF.u8.high); }, 0, 1, 1 },              // 0x4F, 0b01001111: LD C, A
+
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rDE.u8.high, cpu._rBC.u8.high); }, 0, 1, 1 },             // 0x50, 0b01010000: LD D, B
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rDE.u8.high, cpu._rBC.u8.low); }, 0, 1, 1 },              // 0x51, 0b01010001: LD D, C
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rDE.u8.high, cpu._rDE.u8.high); }, 0, 1, 1 },             // 0x52, 0b01010010: LD D, D
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rDE.u8.high, cpu._rDE.u8.low); }, 0, 1, 1 },              // 0x53, 0b01010011: LD D, E
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rDE.u8.high, cpu._rHL.u8.high); }, 0, 1, 1 },             // 0x54, 0b01010100: LD D, H
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rDE.u8.high, cpu._rHL.u8.low); }, 0, 1, 1 },              // 0x55, 0b01010101: LD D, L
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rDE.u8.high, cpu._gbc.read(cpu._rHL.u16)); }, 0, 1, 2 },  // 0x56, 0b01010110: LD D, (HL)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rDE.u8.high, cpu._rAF.u8.high); }, 0, 1, 1 },             // 0x57, 0b01010111: LD D, A
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rDE.u8.low, cpu._rBC.u8.high); }, 0, 1, 1 },              // 0x58, 0b01011000: LD E, B
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rDE.u8.low, cpu._rBC.u8.low); }, 0, 1, 1 },               // 0x59, 0b01011001: LD E, C
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rDE.u8.low, cpu._rDE.u8.high); }, 0, 1, 1 },              // 0x5A, 0b01011010: LD E, D
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rDE.u8.low, cpu._rDE.u8.low); }, 0, 1, 1 },               // 0x5B, 0b01011011: LD E, E
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rDE.u8.low, cpu._rHL.u8.high); }, 0, 1, 1 },              // 0x5C, 0b01011100: LD E, H
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rDE.u8.low, cpu._rHL.u8.low); }, 0, 1, 1 },               // 0x5D, 0b01011101: LD E, L
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rDE.u8.low, cpu._gbc.read(cpu._rHL.u16)); }, 0, 1, 2 },   // 0x5E, 0b01011110: LD E, (HL)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rDE.u8.low, cpu._rAF.u8.high); }, 0, 1, 1 },              // 0x5F, 0b01011111: LD E, A
+
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rHL.u8.high, cpu._rBC.u8.high); }, 0, 1, 1 },             // 0x60, 0b01100000: LD H, B
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rHL.u8.high, cpu._rBC.u8.low); }, 0, 1, 1 },              // 0x61, 0b01100001: LD H, C
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rHL.u8.high, cpu._rDE.u8.high); }, 0, 1, 1 },             // 0x62, 0b01100010: LD H, D
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rHL.u8.high, cpu._rDE.u8.low); }, 0, 1, 1 },              // 0x63, 0b01100011: LD H, E
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rHL.u8.high, cpu._rHL.u8.high); }, 0, 1, 1 },             // 0x64, 0b01100100: LD H, H
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rHL.u8.high, cpu._rHL.u8.low); }, 0, 1, 1 },              // 0x65, 0b01100101: LD H, L
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rHL.u8.high, cpu._gbc.read(cpu._rHL.u16)); }, 0, 1, 2 },  // 0x66, 0b01100110: LD H, (HL)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rHL.u8.high, cpu._rAF.u8.high); }, 0, 1, 1 },             // 0x67, 0b01100111: LD H, A
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rHL.u8.low, cpu._rBC.u8.high); }, 0, 1, 1 },              // 0x68, 0b01101000: LD L, B
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rHL.u8.low, cpu._rBC.u8.low); }, 0, 1, 1 },               // 0x69, 0b01101001: LD L, C
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rHL.u8.low, cpu._rDE.u8.high); }, 0, 1, 1 },              // 0x6A, 0b01101010: LD L, D
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rHL.u8.low, cpu._rDE.u8.low); }, 0, 1, 1 },               // 0x6B, 0b01101011: LD L, E
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rHL.u8.low, cpu._rHL.u8.high); }, 0, 1, 1 },              // 0x6C, 0b01101100: LD L, H
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rHL.u8.low, cpu._rHL.u8.low); }, 0, 1, 1 },               // 0x6D, 0b01101101: LD L, L
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rHL.u8.low, cpu._gbc.read(cpu._rHL.u16)); }, 0, 1, 2 },   // 0x6E, 0b01101110: LD L, (HL)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rHL.u8.low, cpu._rAF.u8.high); }, 0, 1, 1 },              // 0x6F, 0b01101111: LD L, A
+
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_pHL_r(cpu._rBC.u8.high); }, 0, 1, 2 },                             // 0x70, 0b01110000: LD (HL), B
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_pHL_r(cpu._rBC.u8.low); }, 0, 1, 2 },                              // 0x71, 0b01110001: LD (HL), C
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_pHL_r(cpu._rDE.u8.high); }, 0, 1, 2 },                             // 0x72, 0b01110010: LD (HL), D
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_pHL_r(cpu._rDE.u8.low); }, 0, 1, 2 },                              // 0x73, 0b01110011: LD (HL), E
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_pHL_r(cpu._rHL.u8.high); }, 0, 1, 2 },                             // 0x74, 0b01110100: LD (HL), H
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_pHL_r(cpu._rHL.u8.low); }, 0, 1, 2 },                              // 0x75, 0b01110101: LD (HL), L
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_HALT(); }, 0, 1, 1 },                                                 // 0x76, 0b01110110: HALT
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_pHL_r(cpu._rAF.u8.high); }, 0, 1, 2 },                             // 0x77, 0b01110111: LD (HL), A
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rAF.u8.high, cpu._rBC.u8.high); }, 0, 1, 1 },             // 0x78, 0b01111000: LD A, B
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rAF.u8.high, cpu._rBC.u8.low); }, 0, 1, 1 },              // 0x79, 0b01111001: LD A, C
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rAF.u8.high, cpu._rDE.u8.high); }, 0, 1, 1 },             // 0x7A, 0b01111010: LD A, D
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rAF.u8.high, cpu._rDE.u8.low); }, 0, 1, 1 },              // 0x7B, 0b01111011: LD A, E
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rAF.u8.high, cpu._rHL.u8.high); }, 0, 1, 1 },             // 0x7C, 0b01111100: LD A, H
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rAF.u8.high, cpu._rHL.u8.low); }, 0, 1, 1 },              // 0x7D, 0b01111101: LD A, L
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rAF.u8.high, cpu._gbc.read(cpu._rHL.u16)); }, 0, 1, 2 },  // 0x7E, 0b01111110: LD A, (HL)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_r_r(cpu._rAF.u8.high, cpu._rAF.u8.high); }, 0, 1, 1 },             // 0x7F, 0b01111111: LD A, A
+
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_ADD(cpu._rBC.u8.high); }, 0, 1, 1 },             // 0x80, 0b10000000: ADD B
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_ADD(cpu._rBC.u8.low); }, 0, 1, 1 },              // 0x81, 0b10000001: ADD C
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_ADD(cpu._rDE.u8.high); }, 0, 1, 1 },             // 0x82, 0b10000010: ADD D
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_ADD(cpu._rDE.u8.low); }, 0, 1, 1 },              // 0x83, 0b10000011: ADD E
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_ADD(cpu._rHL.u8.high); }, 0, 1, 1 },             // 0x84, 0b10000100: ADD H
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_ADD(cpu._rHL.u8.low); }, 0, 1, 1 },              // 0x85, 0b10000101: ADD L
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_ADD(cpu._gbc.read(cpu._rHL.u16)); }, 0, 1, 2 },  // 0x86, 0b10000110: ADD (HL)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_ADD(cpu._rAF.u8.high); }, 0, 1, 1 },             // 0x87, 0b10000111: ADD A
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_ADC(cpu._rBC.u8.high); }, 0, 1, 1 },             // 0x88, 0b10001000: ADC B
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_ADC(cpu._rBC.u8.low); }, 0, 1, 1 },              // 0x89, 0b10001001: ADC C
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_ADC(cpu._rDE.u8.high); }, 0, 1, 1 },             // 0x8A, 0b10001010: ADC D
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_ADC(cpu._rDE.u8.low); }, 0, 1, 1 },              // 0x8B, 0b10001011: ADC E
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_ADC(cpu._rHL.u8.high); }, 0, 1, 1 },             // 0x8C, 0b10001100: ADC H
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_ADC(cpu._rHL.u8.low); }, 0, 1, 1 },              // 0x8D, 0b10001101: ADC L
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_ADC(cpu._gbc.read(cpu._rHL.u16)); }, 0, 1, 2 },  // 0x8E, 0b10001110: ADC (HL)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_ADC(cpu._rAF.u8.high); }, 0, 1, 1 },             // 0x8F, 0b10001111: ADC A
+
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SUB(cpu._rBC.u8.high); }, 0, 1, 1 },             // 0x90, 0b10010000: SUB B
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SUB(cpu._rBC.u8.low); }, 0, 1, 1 },              // 0x91, 0b10010001: SUB C
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SUB(cpu._rDE.u8.high); }, 0, 1, 1 },             // 0x92, 0b10010010: SUB D
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SUB(cpu._rDE.u8.low); }, 0, 1, 1 },              // 0x93, 0b10010011: SUB E
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SUB(cpu._rHL.u8.high); }, 0, 1, 1 },             // 0x94, 0b10010100: SUB H
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SUB(cpu._rHL.u8.low); }, 0, 1, 1 },              // 0x95, 0b10010101: SUB L
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SUB(cpu._gbc.read(cpu._rHL.u16)); }, 0, 1, 2 },  // 0x96, 0b10010110: SUB (HL)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SUB(cpu._rAF.u8.high); }, 0, 1, 1 },             // 0x97, 0b10010111: SUB A
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SBC(cpu._rBC.u8.high); }, 0, 1, 1 },             // 0x98, 0b10011000: SBC B
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SBC(cpu._rBC.u8.low); }, 0, 1, 1 },              // 0x99, 0b10011001: SBC C
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SBC(cpu._rDE.u8.high); }, 0, 1, 1 },             // 0x9A, 0b10011010: SBC D
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SBC(cpu._rDE.u8.low); }, 0, 1, 1 },              // 0x9B, 0b10011011: SBC E
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SBC(cpu._rHL.u8.high); }, 0, 1, 1 },             // 0x9C, 0b10011100: SBC H
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SBC(cpu._rHL.u8.low); }, 0, 1, 1 },              // 0x9D, 0b10011101: SBC L
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SBC(cpu._gbc.read(cpu._rHL.u16)); }, 0, 1, 2 },  // 0x9E, 0b10011110: SBC (HL)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SBC(cpu._rAF.u8.high); }, 0, 1, 1 },             // 0x9F, 0b10011111: SBC A
+
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_AND(cpu._rBC.u8.high); }, 0, 1, 1 },             // 0xA0, 0b10100000: AND B
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_AND(cpu._rBC.u8.low); }, 0, 1, 1 },              // 0xA1, 0b10100001: AND C
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_AND(cpu._rDE.u8.high); }, 0, 1, 1 },             // 0xA2, 0b10100010: AND D
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_AND(cpu._rDE.u8.low); }, 0, 1, 1 },              // 0xA3, 0b10100011: AND E
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_AND(cpu._rHL.u8.high); }, 0, 1, 1 },             // 0xA4, 0b10100100: AND H
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_AND(cpu._rHL.u8.low); }, 0, 1, 1 },              // 0xA5, 0b10100101: AND L
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_AND(cpu._gbc.read(cpu._rHL.u16)); }, 0, 1, 2 },  // 0xA6, 0b10100110: AND (HL)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_AND(cpu._rAF.u8.high); }, 0, 1, 1 },             // 0xA7, 0b10100111: AND A
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_XOR(cpu._rBC.u8.high); }, 0, 1, 1 },             // 0xA8, 0b10101000: XOR B
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_XOR(cpu._rBC.u8.low); }, 0, 1, 1 },              // 0xA9, 0b10101001: XOR C
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_XOR(cpu._rDE.u8.high); }, 0, 1, 1 },             // 0xAA, 0b10101010: XOR D
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_XOR(cpu._rDE.u8.low); }, 0, 1, 1 },              // 0xAB, 0b10101011: XOR E
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_XOR(cpu._rHL.u8.high); }, 0, 1, 1 },             // 0xAC, 0b10101100: XOR H
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_XOR(cpu._rHL.u8.low); }, 0, 1, 1 },              // 0xAD, 0b10101101: XOR L
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_XOR(cpu._gbc.read(cpu._rHL.u16)); }, 0, 1, 2 },  // 0xAE, 0b10101110: XOR (HL)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_XOR(cpu._rAF.u8.high); }, 0, 1, 1 },             // 0xAF, 0b10101111: XOR A
+
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_OR(cpu._rBC.u8.high); }, 0, 1, 1 },             // 0xB0, 0b10110000: OR B
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_OR(cpu._rBC.u8.low); }, 0, 1, 1 },              // 0xB1, 0b10110001: OR C
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_OR(cpu._rDE.u8.high); }, 0, 1, 1 },             // 0xB2, 0b10110010: OR D
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_OR(cpu._rDE.u8.low); }, 0, 1, 1 },              // 0xB3, 0b10110011: OR E
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_OR(cpu._rHL.u8.high); }, 0, 1, 1 },             // 0xB4, 0b10110100: OR H
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_OR(cpu._rHL.u8.low); }, 0, 1, 1 },              // 0xB5, 0b10110101: OR L
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_OR(cpu._gbc.read(cpu._rHL.u16)); }, 0, 1, 2 },  // 0xB6, 0b10110110: OR (HL)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_OR(cpu._rAF.u8.high); }, 0, 1, 1 },             // 0xB7, 0b10110111: OR A
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_CP(cpu._rBC.u8.high); }, 0, 1, 1 },             // 0xB8, 0b10111000: CP B
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_CP(cpu._rBC.u8.low); }, 0, 1, 1 },              // 0xB9, 0b10111001: CP C
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_CP(cpu._rDE.u8.high); }, 0, 1, 1 },             // 0xBA, 0b10111010: CP D
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_CP(cpu._rDE.u8.low); }, 0, 1, 1 },              // 0xBB, 0b10111011: CP E
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_CP(cpu._rHL.u8.high); }, 0, 1, 1 },             // 0xBC, 0b10111100: CP H
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_CP(cpu._rHL.u8.low); }, 0, 1, 1 },              // 0xBD, 0b10111101: CP L
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_CP(cpu._gbc.read(cpu._rHL.u16)); }, 0, 1, 2 },  // 0xBE, 0b10111110: CP (HL)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_CP(cpu._rAF.u8.high); }, 0, 1, 1 },             // 0xBF, 0b10111111: CP A
+
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RET_c0(Register::Z); }, 0, 1, 2 },                // 0xC0, 0b11000000: RET NZ
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_POP_rr(cpu._rBC); }, 0, 1, 3 },                   // 0xC1, 0b11000001: POP BC
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_JP_c0_nn(Register::Z, record); }, 0, 3, 3 },      // 0xC2, 0b11000010: JP NZ, nn
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_JP_nn(record); }, 0, 3, 4 },                      // 0xC3, 0b11000011: JP nn
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_CALL_c0_nn(Register::Z, record); }, 0, 3, 3 },    // 0xC4, 0b11000100: CALL NZ, nn
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_PUSH_rr(cpu._rBC); }, 0, 1, 4 },                  // 0xC5, 0b11000101: PUSH BC
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_ADD((std::uint8_t)record.operand); }, 0, 2, 2 },  // 0xC6, 0b11000110: ADD n
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RST(0x0000); }, 0, 1, 4 },                        // 0xC7, 0b11000111: RST 00
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RET_c1(Register::Z); }, 0, 1, 2 },                // 0xC8, 0b11001000: RET Z
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RET(); }, 0, 1, 4 },                              // 0xC9, 0b11001001: RET
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_JP_c1_nn(Register::Z, record); }, 0, 3, 3 },      // 0xCA, 0b11001010: JP Z, nn
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { }, 0, 2, 2 },                                              // 0xCB, 0b11001011: SWAP / RLC / RL / RRC / RR / SLA / SRA / SRL / BIT / SET / RES
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_CALL_c1_nn(Register::Z, record); }, 0, 3, 3 },    // 0xCC, 0b11001100: CALL Z, nn
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_CALL_nn(record); }, 0, 3, 6 },                    // 0xCD, 0b11001101: CALL nn
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_ADC((std::uint8_t)record.operand); }, 0, 2, 2 },  // 0xCE, 0b11001110: ADC A, n
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RST(0x0008); }, 0, 1, 4 },                        // 0xCF, 0b11001111: RST 08
+
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RET_c0(Register::C); }, 0, 1, 2 },                // 0xD0, 0b11010000: RET NC
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_POP_rr(cpu._rDE); }, 0, 1, 3 },                   // 0xD1, 0b11010001: POP DE
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_JP_c0_nn(Register::C, record); }, 0, 3, 3 },      // 0xD2, 0b11010010: JP NC, nn
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { }, 0, 1, 1 },                                              // 0xD3, 0b11010011:
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_CALL_c0_nn(Register::C, record); }, 0, 3, 3 },    // 0xD4, 0b11010100: CALL NC, nn
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_PUSH_rr(cpu._rDE); }, 0, 1, 4 },                  // 0xD5, 0b11010101: PUSH DE
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SUB((std::uint8_t)record.operand); }, 0, 2, 2 },  // 0xD6, 0b11010110: SUB n
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RST(0x0010); }, 0, 1, 4 },                        // 0xD7, 0b11010111: RST 10
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RET_c1(Register::C); }, 0, 1, 2 },                // 0xD8, 0b11011000: RET C
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RETI(); }, 0, 1, 4 },                             // 0xD9, 0b11011001: RETI
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_JP_c1_nn(Register::C, record); }, 0, 3, 3 },      // 0xDA, 0b11011010: JP C, nn
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { }, 0, 1, 1 },                                              // 0xDB, 0b11011011:
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_CALL_c1_nn(Register::C, record); }, 0, 3, 3 },    // 0xDC, 0b11011100: CALL C, nn
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { }, 0, 1, 1 },                                              // 0xDD, 0b11011101:
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SBC((std::uint8_t)record.operand); }, 0, 2, 2 },  // 0xDE, 0b11011110: SBC A, n
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RST(0x0018); }, 0, 1, 4 },                        // 0xDF, 0b11011111: RST 18
+
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LDH_pn_A(record); }, 0, 2, 3 },                   // 0xE0, 0b11100000: LDH (n), A
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_POP_rr(cpu._rHL); }, 0, 1, 3 },                   // 0xE1, 0b11100001: POP HL
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LDH_pC_A(); }, 0, 1, 2 },                         // 0xE2, 0b11100010: LDH (C), A
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { }, 0, 1, 1 },                                              // 0xE3, 0b11100011:
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { }, 0, 1, 1 },                                              // 0xE4, 0b11100100:
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_PUSH_rr(cpu._rHL); }, 0, 1, 4 },                  // 0xE5, 0b11100101: PUSH HL
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_AND((std::uint8_t)record.operand); }, 0, 2, 2 },  // 0xE6, 0b11100110: AND n
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RST(0x0020); }, 0, 1, 4 },                        // 0xE7, 0b11100111: RST 20
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_ADD_SP_n(record); }, 0, 2, 4 },                   // 0xE8, 0b11101000: ADD SP, n
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_JP_HL(); }, 0, 1, 1 },                            // 0xE9, 0b11101001: JP HL
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_pnn_A(record); }, 0, 3, 4 },                   // 0xEA, 0b11101010: LD (nn), A
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { }, 0, 1, 1 },                                              // 0xEB, 0b11101011:
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { }, 0, 1, 1 },                                              // 0xEC, 0b11101100:
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { }, 0, 1, 1 },                                              // 0xED, 0b11101101:
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_XOR((std::uint8_t)record.operand); }, 0, 2, 2 },  // 0xEE, 0b11101110: XOR n
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RST(0x0028); }, 0, 1, 4 },                        // 0xEF, 0b11101111: RST 28
+
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LDH_A_pn(record); }, 0, 2, 3 },                  // 0xF0, 0b11110000: LD A, (n)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_POP_AF(); }, 0, 1, 3 },                          // 0xF1, 0b11110001: POP AF
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LDH_A_pC(); }, 0, 1, 2 },                        // 0xF2, 0b11110010: LD A, (C)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_DI(); }, 0, 1, 1 },                              // 0xF3, 0b11110011: DI
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { }, 0, 1, 1 },                                             // 0xF4, 0b11110100:
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_PUSH_rr(cpu._rAF); }, 0, 1, 4 },                 // 0xF5, 0b11110101: PUSH AF
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_OR((std::uint8_t)record.operand); }, 0, 2, 2 },  // 0xF6, 0b11110110: OR n
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RST(0x0030); }, 0, 1, 4 },                       // 0xF7, 0b11110111: RST 30
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_HL_SPn(record); }, 0, 2, 3 },                 // 0xF8, 0b11111000: LD HL, SP+n
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_SP_HL(); }, 0, 1, 2 },                        // 0xF9, 0b11111001: LD SP, HL
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_LD_A_pnn(record); }, 0, 3, 4 },                  // 0xFA, 0b11111010: LD A, (nn)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_EI(); }, 0, 1, 1 },                              // 0xFB, 0b11111011: EI
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { }, 0, 1, 1 },                                             // 0xFC, 0b11111100:
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { }, 0, 1, 1 },                                             // 0xFD, 0b11111101:
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_CP((std::uint8_t)record.operand); }, 0, 2, 2 },  // 0xFE, 0b11111110: CP n
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RST(0x0038); }, 0, 1, 4 }                        // 0xFF, 0b11111111: RST 38
+};
+
+constexpr const std::array<GBC::CentralProcessingUnit::Record, 256> GBC::CentralProcessingUnit::_recordsCb = {
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RLC(cpu._rBC.u8.high); }, 0, 2, 2 },                         // 0x00, 0b00000000: RLC B
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RLC(cpu._rBC.u8.low); }, 0, 2, 2 },                          // 0x01, 0b00000001: RLC C
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RLC(cpu._rDE.u8.high); }, 0, 2, 2 },                         // 0x02, 0b00000010: RLC D
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RLC(cpu._rDE.u8.low); }, 0, 2, 2 },                          // 0x03, 0b00000011: RLC E
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RLC(cpu._rHL.u8.high); }, 0, 2, 2 },                         // 0x04, 0b00000100: RLC H
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RLC(cpu._rHL.u8.low); }, 0, 2, 2 },                          // 0x05, 0b00000101: RLC L
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_pHL<&GBC::CentralProcessingUnit::fast_RLC>(); }, 0, 2, 4 },  // 0x06, 0b00000110: RLC (HL)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RLC(cpu._rAF.u8.high); }, 0, 2, 2 },                         // 0x07, 0b00000111: RLC A
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RRC(cpu._rBC.u8.high); }, 0, 2, 2 },                         // 0x08, 0b00001000: RRC B
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RRC(cpu._rBC.u8.low); }, 0, 2, 2 },                          // 0x09, 0b00001001: RRC C
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RRC(cpu._rDE.u8.high); }, 0, 2, 2 },                         // 0x0A, 0b00001010: RRC D
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RRC(cpu._rDE.u8.low); }, 0, 2, 2 },                          // 0x0B, 0b00001011: RRC E
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RRC(cpu._rHL.u8.high); }, 0, 2, 2 },                         // 0x0C, 0b00001100: RRC H
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RRC(cpu._rHL.u8.low); }, 0, 2, 2 },                          // 0x0D, 0b00001101: RRC L
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_pHL<&GBC::CentralProcessingUnit::fast_RRC>(); }, 0, 2, 4 },  // 0x0E, 0b00001110: RRC (HL)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RRC(cpu._rAF.u8.high); }, 0, 2, 2 },                         // 0x0F, 0b00001111: RRC A
+
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RL(cpu._rBC.u8.high); }, 0, 2, 2 },                         // 0x10, 0b00010000: RL B
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RL(cpu._rBC.u8.low); }, 0, 2, 2 },                          // 0x11, 0b00010001: RL C
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RL(cpu._rDE.u8.high); }, 0, 2, 2 },                         // 0x12, 0b00010010: RL D
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RL(cpu._rDE.u8.low); }, 0, 2, 2 },                          // 0x13, 0b00010011: RL E
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RL(cpu._rHL.u8.high); }, 0, 2, 2 },                         // 0x14, 0b00010100: RL H
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RL(cpu._rHL.u8.low); }, 0, 2, 2 },                          // 0x15, 0b00010101: RL L
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_pHL<&GBC::CentralProcessingUnit::fast_RL>(); }, 0, 2, 4 },  // 0x16, 0b00010110: RL (HL)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RL(cpu._rAF.u8.high); }, 0, 2, 2 },                         // 0x17, 0b00010111: RL A
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RR(cpu._rBC.u8.high); }, 0, 2, 2 },                         // 0x18, 0b00011000: RR B
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RR(cpu._rBC.u8.low); }, 0, 2, 2 },                          // 0x19, 0b00011001: RR C
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RR(cpu._rDE.u8.high); }, 0, 2, 2 },                         // 0x1A, 0b00011010: RR D
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RR(cpu._rDE.u8.low); }, 0, 2, 2 },                          // 0x1B, 0b00011011: RR E
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RR(cpu._rHL.u8.high); }, 0, 2, 2 },                         // 0x1C, 0b00011100: RR H
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RR(cpu._rHL.u8.low); }, 0, 2, 2 },                          // 0x1D, 0b00011101: RR L
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_pHL<&GBC::CentralProcessingUnit::fast_RR>(); }, 0, 2, 4 },  // 0x1E, 0b00011110: RR (HL)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RR(cpu._rAF.u8.high); }, 0, 2, 2 },                         // 0x1F, 0b00011111: RR A
+
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SLA(cpu._rBC.u8.high); }, 0, 2, 2 },                         // 0x20, 0b00100000: SLA B
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SLA(cpu._rBC.u8.low); }, 0, 2, 2 },                          // 0x21, 0b00100001: SLA C
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SLA(cpu._rDE.u8.high); }, 0, 2, 2 },                         // 0x22, 0b00100010: SLA D
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SLA(cpu._rDE.u8.low); }, 0, 2, 2 },                          // 0x23, 0b00100011: SLA E
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SLA(cpu._rHL.u8.high); }, 0, 2, 2 },                         // 0x24, 0b00100100: SLA H
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SLA(cpu._rHL.u8.low); }, 0, 2, 2 },                          // 0x25, 0b00100101: SLA L
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_pHL<&GBC::CentralProcessingUnit::fast_SLA>(); }, 0, 2, 4 },  // 0x26, 0b00100110: SLA (HL)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SLA(cpu._rAF.u8.high); }, 0, 2, 2 },                         // 0x27, 0b00100111: SLA A
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SRA(cpu._rBC.u8.high); }, 0, 2, 2 },                         // 0x28, 0b00101000: SRA B
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SRA(cpu._rBC.u8.low); }, 0, 2, 2 },                          // 0x29, 0b00101001: SRA C
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SRA(cpu._rDE.u8.high); }, 0, 2, 2 },                         // 0x2A, 0b00101010: SRA D
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SRA(cpu._rDE.u8.low); }, 0, 2, 2 },                          // 0x2B, 0b00101011: SRA E
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SRA(cpu._rHL.u8.high); }, 0, 2, 2 },                         // 0x2C, 0b00101100: SRA H
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SRA(cpu._rHL.u8.low); }, 0, 2, 2 },                          // 0x2D, 0b00101101: SRA L
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_pHL<&GBC::CentralProcessingUnit::fast_SRA>(); }, 0, 2, 4 },  // 0x2E, 0b00101110: SRA (HL)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SRA(cpu._rAF.u8.high); }, 0, 2, 2 },                         // 0x2F, 0b00101111: SRA A
+
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SWAP(cpu._rBC.u8.high); }, 0, 2, 2 },                         // 0x30, 0b00110000: SWAP B
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SWAP(cpu._rBC.u8.low); }, 0, 2, 2 },                          // 0x31, 0b00110001: SWAP C
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SWAP(cpu._rDE.u8.high); }, 0, 2, 2 },                         // 0x32, 0b00110010: SWAP D
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SWAP(cpu._rDE.u8.low); }, 0, 2, 2 },                          // 0x33, 0b00110011: SWAP E
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SWAP(cpu._rHL.u8.high); }, 0, 2, 2 },                         // 0x34, 0b00110100: SWAP H
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SWAP(cpu._rHL.u8.low); }, 0, 2, 2 },                          // 0x35, 0b00110101: SWAP L
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_pHL<&GBC::CentralProcessingUnit::fast_SWAP>(); }, 0, 2, 4 },  // 0x36, 0b00110110: SWAP (HL)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SWAP(cpu._rAF.u8.high); }, 0, 2, 2 },                         // 0x37, 0b00110111: SWAP A
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SRL(cpu._rBC.u8.high); }, 0, 2, 2 },                          // 0x38, 0b00111000: SRL B
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SRL(cpu._rBC.u8.low); }, 0, 2, 2 },                           // 0x39, 0b00111001: SRL C
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SRL(cpu._rDE.u8.high); }, 0, 2, 2 },                          // 0x3A, 0b00111010: SRL D
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SRL(cpu._rDE.u8.low); }, 0, 2, 2 },                           // 0x3B, 0b00111011: SRL E
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SRL(cpu._rHL.u8.high); }, 0, 2, 2 },                          // 0x3C, 0b00111100: SRL H
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SRL(cpu._rHL.u8.low); }, 0, 2, 2 },                           // 0x3D, 0b00111101: SRL L
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_pHL<&GBC::CentralProcessingUnit::fast_SRL>(); }, 0, 2, 4 },   // 0x3E, 0b00111110: SRL (HL)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SRL(cpu._rAF.u8.high); }, 0, 2, 2 },                          // 0x3F, 0b00111111: SRL A
+
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<0>(cpu._rBC.u8.high); }, 0, 2, 2 },             // 0x40, 0b01000000: BIT 0, B
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<0>(cpu._rBC.u8.low); }, 0, 2, 2 },              // 0x41, 0b01000001: BIT 0, C
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<0>(cpu._rDE.u8.high); }, 0, 2, 2 },             // 0x42, 0b01000010: BIT 0, D
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<0>(cpu._rDE.u8.low); }, 0, 2, 2 },              // 0x43, 0b01000011: BIT 0, E
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<0>(cpu._rHL.u8.high); }, 0, 2, 2 },             // 0x44, 0b01000100: BIT 0, H
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<0>(cpu._rHL.u8.low); }, 0, 2, 2 },              // 0x45, 0b01000101: BIT 0, L
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<0>(cpu._gbc.read(cpu._rHL.u16)); }, 0, 2, 3 },  // 0x46, 0b01000110: BIT 0, (HL)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<0>(cpu._rAF.u8.high); }, 0, 2, 2 },             // 0x47, 0b01000111: BIT 0, A
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<1>(cpu._rBC.u8.high); }, 0, 2, 2 },             // 0x48, 0b01001000: BIT 1, B
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<1>(cpu._rBC.u8.low); }, 0, 2, 2 },              // 0x49, 0b01001001: BIT 1, C
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<1>(cpu._rDE.u8.high); }, 0, 2, 2 },             // 0x4A, 0b01001010: BIT 1, D
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<1>(cpu._rDE.u8.low); }, 0, 2, 2 },              // 0x4B, 0b01001011: BIT 1, E
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<1>(cpu._rHL.u8.high); }, 0, 2, 2 },             // 0x4C, 0b01001100: BIT 1, H
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<1>(cpu._rHL.u8.low); }, 0, 2, 2 },              // 0x4D, 0b01001101: BIT 1, L
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<1>(cpu._gbc.read(cpu._rHL.u16)); }, 0, 2, 3 },  // 0x4E, 0b01001110: BIT 1, (HL)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<1>(cpu._rAF.u8.high); }, 0, 2, 2 },             // 0x4F, 0b01001111: BIT 1, A
+
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<2>(cpu._rBC.u8.high); }, 0, 2, 2 },             // 0x50, 0b01010000: BIT 2, B
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<2>(cpu._rBC.u8.low); }, 0, 2, 2 },              // 0x51, 0b01010001: BIT 2, C
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<2>(cpu._rDE.u8.high); }, 0, 2, 2 },             // 0x52, 0b01010010: BIT 2, D
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<2>(cpu._rDE.u8.low); }, 0, 2, 2 },              // 0x53, 0b01010011: BIT 2, E
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<2>(cpu._rHL.u8.high); }, 0, 2, 2 },             // 0x54, 0b01010100: BIT 2, H
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<2>(cpu._rHL.u8.low); }, 0, 2, 2 },              // 0x55, 0b01010101: BIT 2, L
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<2>(cpu._gbc.read(cpu._rHL.u16)); }, 0, 2, 3 },  // 0x56, 0b01010110: BIT 2, (HL)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<2>(cpu._rAF.u8.high); }, 0, 2, 2 },             // 0x57, 0b01010111: BIT 2, A
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<3>(cpu._rBC.u8.high); }, 0, 2, 2 },             // 0x58, 0b01011000: BIT 3, B
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<3>(cpu._rBC.u8.low); }, 0, 2, 2 },              // 0x59, 0b01011001: BIT 3, C
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<3>(cpu._rDE.u8.high); }, 0, 2, 2 },             // 0x5A, 0b01011010: BIT 3, D
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<3>(cpu._rDE.u8.low); }, 0, 2, 2 },              // 0x5B, 0b01011011: BIT 3, E
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<3>(cpu._rHL.u8.high); }, 0, 2, 2 },             // 0x5C, 0b01011100: BIT 3, H
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<3>(cpu._rHL.u8.low); }, 0, 2, 2 },              // 0x5D, 0b01011101: BIT 3, L
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<3>(cpu._gbc.read(cpu._rHL.u16)); }, 0, 2, 3 },  // 0x5E, 0b01011110: BIT 3, (HL)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<3>(cpu._rAF.u8.high); }, 0, 2, 2 },             // 0x5F, 0b01011111: BIT 3, A
+
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<4>(cpu._rBC.u8.high); }, 0, 2, 2 },             // 0x60, 0b01100000: BIT 4, B
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<4>(cpu._rBC.u8.low); }, 0, 2, 2 },              // 0x61, 0b01100001: BIT 4, C
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<4>(cpu._rDE.u8.high); }, 0, 2, 2 },             // 0x62, 0b01100010: BIT 4, D
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<4>(cpu._rDE.u8.low); }, 0, 2, 2 },              // 0x63, 0b01100011: BIT 4, E
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<4>(cpu._rHL.u8.high); }, 0, 2, 2 },             // 0x64, 0b01100100: BIT 4, H
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<4>(cpu._rHL.u8.low); }, 0, 2, 2 },              // 0x65, 0b01100101: BIT 4, L
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<4>(cpu._gbc.read(cpu._rHL.u16)); }, 0, 2, 3 },  // 0x66, 0b01100110: BIT 4, (HL)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<4>(cpu._rAF.u8.high); }, 0, 2, 2 },             // 0x67, 0b01100111: BIT 4, A
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<5>(cpu._rBC.u8.high); }, 0, 2, 2 },             // 0x68, 0b01101000: BIT 5, B
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<5>(cpu._rBC.u8.low); }, 0, 2, 2 },              // 0x69, 0b01101001: BIT 5, C
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<5>(cpu._rDE.u8.high); }, 0, 2, 2 },             // 0x6A, 0b01101010: BIT 5, D
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<5>(cpu._rDE.u8.low); }, 0, 2, 2 },              // 0x6B, 0b01101011: BIT 5, E
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<5>(cpu._rHL.u8.high); }, 0, 2, 2 },             // 0x6C, 0b01101100: BIT 5, H
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<5>(cpu._rHL.u8.low); }, 0, 2, 2 },              // 0x6D, 0b01101101: BIT 5, L
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<5>(cpu._gbc.read(cpu._rHL.u16)); }, 0, 2, 3 },  // 0x6E, 0b01101110: BIT 5, (HL)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<5>(cpu._rAF.u8.high); }, 0, 2, 2 },             // 0x6F, 0b01101111: BIT 5, A
+
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<6>(cpu._rBC.u8.high); }, 0, 2, 2 },             // 0x70, 0b01110000: BIT 6, B
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<6>(cpu._rBC.u8.low); }, 0, 2, 2 },              // 0x71, 0b01110001: BIT 6, C
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<6>(cpu._rDE.u8.high); }, 0, 2, 2 },             // 0x72, 0b01110010: BIT 6, D
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<6>(cpu._rDE.u8.low); }, 0, 2, 2 },              // 0x73, 0b01110011: BIT 6, E
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<6>(cpu._rHL.u8.high); }, 0, 2, 2 },             // 0x74, 0b01110100: BIT 6, H
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<6>(cpu._rHL.u8.low); }, 0, 2, 2 },              // 0x75, 0b01110101: BIT 6, L
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<6>(cpu._gbc.read(cpu._rHL.u16)); }, 0, 2, 3 },  // 0x76, 0b01110110: BIT 6, (HL)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<6>(cpu._rAF.u8.high); }, 0, 2, 2 },             // 0x77, 0b01110111: BIT 6, A
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<7>(cpu._rBC.u8.high); }, 0, 2, 2 },             // 0x78, 0b01111000: BIT 7, B
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<7>(cpu._rBC.u8.low); }, 0, 2, 2 },              // 0x79, 0b01111001: BIT 7, C
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<7>(cpu._rDE.u8.high); }, 0, 2, 2 },             // 0x7A, 0b01111010: BIT 7, D
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<7>(cpu._rDE.u8.low); }, 0, 2, 2 },              // 0x7B, 0b01111011: BIT 7, E
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<7>(cpu._rHL.u8.high); }, 0, 2, 2 },             // 0x7C, 0b01111100: BIT 7, H
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<7>(cpu._rHL.u8.low); }, 0, 2, 2 },              // 0x7D, 0b01111101: BIT 7, L
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<7>(cpu._gbc.read(cpu._rHL.u16)); }, 0, 2, 3 },  // 0x7E, 0b01111110: BIT 7, (HL)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_BIT<7>(cpu._rAF.u8.high); }, 0, 2, 2 },             // 0x7F, 0b01111111: BIT 7, A
+
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<0>(cpu._rBC.u8.high); }, 0, 2, 2 },                         // 0x80, 0b10000000: RES 0, B
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<0>(cpu._rBC.u8.low); }, 0, 2, 2 },                          // 0x81, 0b10000001: RES 0, C
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<0>(cpu._rDE.u8.high); }, 0, 2, 2 },                         // 0x82, 0b10000010: RES 0, D
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<0>(cpu._rDE.u8.low); }, 0, 2, 2 },                          // 0x83, 0b10000011: RES 0, E
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<0>(cpu._rHL.u8.high); }, 0, 2, 2 },                         // 0x84, 0b10000100: RES 0, H
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<0>(cpu._rHL.u8.low); }, 0, 2, 2 },                          // 0x85, 0b10000101: RES 0, L
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_pHL<&GBC::CentralProcessingUnit::fast_RES<0>>(); }, 0, 2, 4 },  // 0x86, 0b10000110: RES 0, (HL)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<0>(cpu._rAF.u8.high); }, 0, 2, 2 },                         // 0x87, 0b10000111: RES 0, A
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<1>(cpu._rBC.u8.high); }, 0, 2, 2 },                         // 0x88, 0b10001000: RES 1, B
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<1>(cpu._rBC.u8.low); }, 0, 2, 2 },                          // 0x89, 0b10001001: RES 1, C
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<1>(cpu._rDE.u8.high); }, 0, 2, 2 },                         // 0x8A, 0b10001010: RES 1, D
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<1>(cpu._rDE.u8.low); }, 0, 2, 2 },                          // 0x8B, 0b10001011: RES 1, E
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<1>(cpu._rHL.u8.high); }, 0, 2, 2 },                         // 0x8C, 0b10001100: RES 1, H
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<1>(cpu._rHL.u8.low); }, 0, 2, 2 },                          // 0x8D, 0b10001101: RES 1, L
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_pHL<&GBC::CentralProcessingUnit::fast_RES<1>>(); }, 0, 2, 4 },  // 0x8E, 0b10001110: RES 1, (HL)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<1>(cpu._rAF.u8.high); }, 0, 2, 2 },                         // 0x8F, 0b10001111: RES 1, A
+
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<2>(cpu._rBC.u8.high); }, 0, 2, 2 },                         // 0x90, 0b10010000: RES 2, B
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<2>(cpu._rBC.u8.low); }, 0, 2, 2 },                          // 0x91, 0b10010001: RES 2, C
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<2>(cpu._rDE.u8.high); }, 0, 2, 2 },                         // 0x92, 0b10010010: RES 2, D
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<2>(cpu._rDE.u8.low); }, 0, 2, 2 },                          // 0x93, 0b10010011: RES 2, E
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<2>(cpu._rHL.u8.high); }, 0, 2, 2 },                         // 0x94, 0b10010100: RES 2, H
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<2>(cpu._rHL.u8.low); }, 0, 2, 2 },                          // 0x95, 0b10010101: RES 2, L
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_pHL<&GBC::CentralProcessingUnit::fast_RES<2>>(); }, 0, 2, 4 },  // 0x96, 0b10010110: RES 2, (HL)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<2>(cpu._rAF.u8.high); }, 0, 2, 2 },                         // 0x97, 0b10010111: RES 2, A
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<3>(cpu._rBC.u8.high); }, 0, 2, 2 },                         // 0x98, 0b10011000: RES 3, B
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<3>(cpu._rBC.u8.low); }, 0, 2, 2 },                          // 0x99, 0b10011001: RES 3, C
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<3>(cpu._rDE.u8.high); }, 0, 2, 2 },                         // 0x9A, 0b10011010: RES 3, D
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<3>(cpu._rDE.u8.low); }, 0, 2, 2 },                          // 0x9B, 0b10011011: RES 3, E
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<3>(cpu._rHL.u8.high); }, 0, 2, 2 },                         // 0x9C, 0b10011100: RES 3, H
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<3>(cpu._rHL.u8.low); }, 0, 2, 2 },                          // 0x9D, 0b10011101: RES 3, L
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_pHL<&GBC::CentralProcessingUnit::fast_RES<3>>(); }, 0, 2, 4 },  // 0x9E, 0b10011110: RES 3, (HL)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<3>(cpu._rAF.u8.high); }, 0, 2, 2 },                         // 0x9F, 0b10011111: RES 3, A
+
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<4>(cpu._rBC.u8.high); }, 0, 2, 2 },                         // 0xA0, 0b10100000: RES 4, B
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<4>(cpu._rBC.u8.low); }, 0, 2, 2 },                          // 0xA1, 0b10100001: RES 4, C
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<4>(cpu._rDE.u8.high); }, 0, 2, 2 },                         // 0xA2, 0b10100010: RES 4, D
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<4>(cpu._rDE.u8.low); }, 0, 2, 2 },                          // 0xA3, 0b10100011: RES 4, E
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<4>(cpu._rHL.u8.high); }, 0, 2, 2 },                         // 0xA4, 0b10100100: RES 4, H
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<4>(cpu._rHL.u8.low); }, 0, 2, 2 },                          // 0xA5, 0b10100101: RES 4, L
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_pHL<&GBC::CentralProcessingUnit::fast_RES<4>>(); }, 0, 2, 4 },  // 0xA6, 0b10100110: RES 4, (HL)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<4>(cpu._rAF.u8.high); }, 0, 2, 2 },                         // 0xA7, 0b10100111: RES 4, A
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<5>(cpu._rBC.u8.high); }, 0, 2, 2 },                         // 0xA8, 0b10101000: RES 5, B
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<5>(cpu._rBC.u8.low); }, 0, 2, 2 },                          // 0xA9, 0b10101001: RES 5, C
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<5>(cpu._rDE.u8.high); }, 0, 2, 2 },                         // 0xAA, 0b10101010: RES 5, D
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<5>(cpu._rDE.u8.low); }, 0, 2, 2 },                          // 0xAB, 0b10101011: RES 5, E
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<5>(cpu._rHL.u8.high); }, 0, 2, 2 },                         // 0xAC, 0b10101100: RES 5, H
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<5>(cpu._rHL.u8.low); }, 0, 2, 2 },                          // 0xAD, 0b10101101: RES 5, L
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_pHL<&GBC::CentralProcessingUnit::fast_RES<5>>(); }, 0, 2, 4 },  // 0xAE, 0b10101110: RES 5, (HL)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<5>(cpu._rAF.u8.high); }, 0, 2, 2 },                         // 0xAF, 0b10101111: RES 5, A
+
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<6>(cpu._rBC.u8.high); }, 0, 2, 2 },                         // 0xB0, 0b10110000: RES 6, B
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<6>(cpu._rBC.u8.low); }, 0, 2, 2 },                          // 0xB1, 0b10110001: RES 6, C
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<6>(cpu._rDE.u8.high); }, 0, 2, 2 },                         // 0xB2, 0b10110010: RES 6, D
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<6>(cpu._rDE.u8.low); }, 0, 2, 2 },                          // 0xB3, 0b10110011: RES 6, E
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<6>(cpu._rHL.u8.high); }, 0, 2, 2 },                         // 0xB4, 0b10110100: RES 6, H
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<6>(cpu._rHL.u8.low); }, 0, 2, 2 },                          // 0xB5, 0b10110101: RES 6, L
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_pHL<&GBC::CentralProcessingUnit::fast_RES<6>>(); }, 0, 2, 4 },  // 0xB6, 0b10110110: RES 6, (HL)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<6>(cpu._rAF.u8.high); }, 0, 2, 2 },                         // 0xB7, 0b10110111: RES 6, A
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<7>(cpu._rBC.u8.high); }, 0, 2, 2 },                         // 0xB8, 0b10111000: RES 7, B
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<7>(cpu._rBC.u8.low); }, 0, 2, 2 },                          // 0xB9, 0b10111001: RES 7, C
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<7>(cpu._rDE.u8.high); }, 0, 2, 2 },                         // 0xBA, 0b10111010: RES 7, D
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<7>(cpu._rDE.u8.low); }, 0, 2, 2 },                          // 0xBB, 0b10111011: RES 7, E
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<7>(cpu._rHL.u8.high); }, 0, 2, 2 },                         // 0xBC, 0b10111100: RES 7, H
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<7>(cpu._rHL.u8.low); }, 0, 2, 2 },                          // 0xBD, 0b10111101: RES 7, L
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_pHL<&GBC::CentralProcessingUnit::fast_RES<7>>(); }, 0, 2, 4 },  // 0xBE, 0b10111110: RES 7, (HL)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_RES<7>(cpu._rAF.u8.high); }, 0, 2, 2 },                         // 0xBF, 0b10111111: RES 7, A
+
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<0>(cpu._rBC.u8.high); }, 0, 2, 2 },                         // 0xC0, 0b11000000: SET 0, B
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<0>(cpu._rBC.u8.low); }, 0, 2, 2 },                          // 0xC1, 0b11000001: SET 0, C
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<0>(cpu._rDE.u8.high); }, 0, 2, 2 },                         // 0xC2, 0b11000010: SET 0, D
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<0>(cpu._rDE.u8.low); }, 0, 2, 2 },                          // 0xC3, 0b11000011: SET 0, E
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<0>(cpu._rHL.u8.high); }, 0, 2, 2 },                         // 0xC4, 0b11000100: SET 0, H
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<0>(cpu._rHL.u8.low); }, 0, 2, 2 },                          // 0xC5, 0b11000101: SET 0, L
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_pHL<&GBC::CentralProcessingUnit::fast_SET<0>>(); }, 0, 2, 4 },  // 0xC6, 0b11000110: SET 0, (HL)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<0>(cpu._rAF.u8.high); }, 0, 2, 2 },                         // 0xC7, 0b11000111: SET 0, A
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<1>(cpu._rBC.u8.high); }, 0, 2, 2 },                         // 0xC8, 0b11001000: SET 1, B
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<1>(cpu._rBC.u8.low); }, 0, 2, 2 },                          // 0xC9, 0b11001001: SET 1, C
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<1>(cpu._rDE.u8.high); }, 0, 2, 2 },                         // 0xCA, 0b11001010: SET 1, D
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<1>(cpu._rDE.u8.low); }, 0, 2, 2 },                          // 0xCB, 0b11001011: SET 1, E
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<1>(cpu._rHL.u8.high); }, 0, 2, 2 },                         // 0xCC, 0b11001100: SET 1, H
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<1>(cpu._rHL.u8.low); }, 0, 2, 2 },                          // 0xCD, 0b11001101: SET 1, L
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_pHL<&GBC::CentralProcessingUnit::fast_SET<1>>(); }, 0, 2, 4 },  // 0xCE, 0b11001110: SET 1, (HL)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<1>(cpu._rAF.u8.high); }, 0, 2, 2 },                         // 0xCF, 0b11001111: SET 1, A
+
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<2>(cpu._rBC.u8.high); }, 0, 2, 2 },                         // 0xD0, 0b11010000: SET 2, B
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<2>(cpu._rBC.u8.low); }, 0, 2, 2 },                          // 0xD1, 0b11010001: SET 2, C
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<2>(cpu._rDE.u8.high); }, 0, 2, 2 },                         // 0xD2, 0b11010010: SET 2, D
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<2>(cpu._rDE.u8.low); }, 0, 2, 2 },                          // 0xD3, 0b11010011: SET 2, E
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<2>(cpu._rHL.u8.high); }, 0, 2, 2 },                         // 0xD4, 0b11010100: SET 2, H
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<2>(cpu._rHL.u8.low); }, 0, 2, 2 },                          // 0xD5, 0b11010101: SET 2, L
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_pHL<&GBC::CentralProcessingUnit::fast_SET<2>>(); }, 0, 2, 4 },  // 0xD6, 0b11010110: SET 2, (HL)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<2>(cpu._rAF.u8.high); }, 0, 2, 2 },                         // 0xD7, 0b11010111: SET 2, A
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<3>(cpu._rBC.u8.high); }, 0, 2, 2 },                         // 0xD8, 0b11011000: SET 3, B
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<3>(cpu._rBC.u8.low); }, 0, 2, 2 },                          // 0xD9, 0b11011001: SET 3, C
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<3>(cpu._rDE.u8.high); }, 0, 2, 2 },                         // 0xDA, 0b11011010: SET 3, D
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<3>(cpu._rDE.u8.low); }, 0, 2, 2 },                          // 0xDB, 0b11011011: SET 3, E
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<3>(cpu._rHL.u8.high); }, 0, 2, 2 },                         // 0xDC, 0b11011100: SET 3, H
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<3>(cpu._rHL.u8.low); }, 0, 2, 2 },                          // 0xDD, 0b11011101: SET 3, L
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_pHL<&GBC::CentralProcessingUnit::fast_SET<3>>(); }, 0, 2, 4 },  // 0xDE, 0b11011110: SET 3, (HL)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<3>(cpu._rAF.u8.high); }, 0, 2, 2 },                         // 0xDF, 0b11011111: SET 3, A
+
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<4>(cpu._rBC.u8.high); }, 0, 2, 2 },                         // 0xE0, 0b11100000: SET 4, B
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<4>(cpu._rBC.u8.low); }, 0, 2, 2 },                          // 0xE1, 0b11100001: SET 4, C
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<4>(cpu._rDE.u8.high); }, 0, 2, 2 },                         // 0xE2, 0b11100010: SET 4, D
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<4>(cpu._rDE.u8.low); }, 0, 2, 2 },                          // 0xE3, 0b11100011: SET 4, E
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<4>(cpu._rHL.u8.high); }, 0, 2, 2 },                         // 0xE4, 0b11100100: SET 4, H
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<4>(cpu._rHL.u8.low); }, 0, 2, 2 },                          // 0xE5, 0b11100101: SET 4, L
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_pHL<&GBC::CentralProcessingUnit::fast_SET<4>>(); }, 0, 2, 4 },  // 0xE6, 0b11100110: SET 4, (HL)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<4>(cpu._rAF.u8.high); }, 0, 2, 2 },                         // 0xE7, 0b11100111: SET 4, A
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<5>(cpu._rBC.u8.high); }, 0, 2, 2 },                         // 0xE8, 0b11101000: SET 5, B
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<5>(cpu._rBC.u8.low); }, 0, 2, 2 },                          // 0xE9, 0b11101001: SET 5, C
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<5>(cpu._rDE.u8.high); }, 0, 2, 2 },                         // 0xEA, 0b11101010: SET 5, D
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<5>(cpu._rDE.u8.low); }, 0, 2, 2 },                          // 0xEB, 0b11101011: SET 5, E
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<5>(cpu._rHL.u8.high); }, 0, 2, 2 },                         // 0xEC, 0b11101100: SET 5, H
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<5>(cpu._rHL.u8.low); }, 0, 2, 2 },                          // 0xED, 0b11101101: SET 5, L
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_pHL<&GBC::CentralProcessingUnit::fast_SET<5>>(); }, 0, 2, 4 },  // 0xEE, 0b11101110: SET 5, (HL)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<5>(cpu._rAF.u8.high); }, 0, 2, 2 },                         // 0xEF, 0b11101111: SET 5, A
+
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<6>(cpu._rBC.u8.high); }, 0, 2, 2 },                         // 0xF0, 0b11110000: SET 6, B
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<6>(cpu._rBC.u8.low); }, 0, 2, 2 },                          // 0xF1, 0b11110001: SET 6, C
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<6>(cpu._rDE.u8.high); }, 0, 2, 2 },                         // 0xF2, 0b11110010: SET 6, D
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<6>(cpu._rDE.u8.low); }, 0, 2, 2 },                          // 0xF3, 0b11110011: SET 6, E
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<6>(cpu._rHL.u8.high); }, 0, 2, 2 },                         // 0xF4, 0b11110100: SET 6, H
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<6>(cpu._rHL.u8.low); }, 0, 2, 2 },                          // 0xF5, 0b11110101: SET 6, L
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_pHL<&GBC::CentralProcessingUnit::fast_SET<6>>(); }, 0, 2, 4 },  // 0xF6, 0b11110110: SET 6, (HL)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<6>(cpu._rAF.u8.high); }, 0, 2, 2 },                         // 0xF7, 0b11110111: SET 6, A
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<7>(cpu._rBC.u8.high); }, 0, 2, 2 },                         // 0xF8, 0b11111000: SET 7, B
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<7>(cpu._rBC.u8.low); }, 0, 2, 2 },                          // 0xF9, 0b11111001: SET 7, C
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<7>(cpu._rDE.u8.high); }, 0, 2, 2 },                         // 0xFA, 0b11111010: SET 7, D
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<7>(cpu._rDE.u8.low); }, 0, 2, 2 },                          // 0xFB, 0b11111011: SET 7, E
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<7>(cpu._rHL.u8.high); }, 0, 2, 2 },                         // 0xFC, 0b11111100: SET 7, H
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<7>(cpu._rHL.u8.low); }, 0, 2, 2 },                          // 0xFD, 0b11111101: SET 7, L
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_pHL<&GBC::CentralProcessingUnit::fast_SET<7>>(); }, 0, 2, 4 },  // 0xFE, 0b11111110: SET 7, (HL)
+  Record{ [](GBC::CentralProcessingUnit& cpu, const Record& record) { cpu.fast_SET<7>(cpu._rAF.u8.high); }, 0, 2, 2 }                          // 0xFF, 0b11111111: SET 7, A
+};
+
 constexpr static const std::array<std::string_view, 256> _opcodes_desc = {
   "0x00, 0b00000000: NOP",
   "0x01, 0b00000001: LD BC, nn",
@@ -1122,7 +1670,13 @@ GBC::CentralProcessingUnit::CentralProcessingUnit(GBC::GameBoyColor& gbc) :
   _rHL{ .u16 = 0x0000 },
   _rSP{ .u16 = 0x0000 },
   _rPC{ .u16 = 0x0000 },
-  _rW{ .u16 = 0x0000 }
+  _rW{ .u16 = 0x0000 },
+  _mode(Mode::ModeAccurate),
+  _recordsRom(),
+  _recordsWRam(),
+  _recordsHRam(),
+  _recordScratch{ .handler = nullptr },
+  _cycles(0)
 {
   // Read first opcode
   _bus.read(_rPC.u16);
@@ -1163,6 +1717,184 @@ void  GBC::CentralProcessingUnit::simulate()
     simulateInterrupt();
 }
 
+unsigned int  GBC::CentralProcessingUnit::simulateInstruction()
+{
+  // Use micro-operations when halted, in the middle of an instruction or when an interrupt might be triggered
+  if (_status != Status::StatusRun ||
+    _instructions.empty() == false ||
+    _ime == InterruptMasterEnable::IMEScheduled ||
+    (_ime == InterruptMasterEnable::IMEEnabled && (_gbc._ie & _gbc._io[GBC::GameBoyColor::IO::IF] & 0b00011111))) {
+    simulate();
+    return 1;
+  }
+
+  // Cancel prefetch of opcode, move PC back to instruction
+  _bus.cancel();
+  _rPC.u16 -= 1;
+
+  const Record& record = fastRecord(_rPC.u16);
+
+  // Count executed instructions
+  if (_gbc._profile.enabled == true)
+    _gbc._profile.instructions++;
+
+  // Execute whole instruction
+  _rPC.u16 += record.length;
+  _cycles = record.cycles;
+  record.handler(*this, record);
+
+  // Prefetch next opcode, as in accurate mode
+  _bus.read(_rPC.u16);
+  _rPC.u16 += 1;
+
+  return _cycles;
+}
+
+bool  GBC::CentralProcessingUnit::halted() const
+{
+  // Halted CPU only wakes up on interrupt, ticks have no effect until then
+  return _status == Status::StatusHalt &&
+    _ime != InterruptMasterEnable::IMEScheduled &&
+    !(_gbc._ie & _gbc._io[GBC::GameBoyColor::IO::IF] & 0b00011111);
+}
+
+std::array<std::uint8_t, 6> GBC::CentralProcessingUnit::registers() const
+{
+  // General purpose registers, used by test ROMs to report results
+  return { _rBC.u8.high, _rBC.u8.low, _rDE.u8.high, _rDE.u8.low, _rHL.u8.high, _rHL.u8.low };
+}
+
+GBC::CentralProcessingUnit::Mode  GBC::CentralProcessingUnit::mode() const
+{
+  // Get execution mode
+  return _mode;
+}
+
+void  GBC::CentralProcessingUnit::mode(GBC::CentralProcessingUnit::Mode mode)
+{
+  // Set execution mode
+  _mode = mode;
+
+  // Release decoded instructions
+  _recordsRom.clear();
+  _recordsWRam.clear();
+  _recordsHRam.clear();
+
+  // Allocate decoded instructions cache, ROM banks are allocated on first execution
+  if (_mode == Mode::ModeFast) {
+    _recordsRom.resize((_gbc._mbc->getRomSize() + 0x3FFF) / 0x4000);
+    _recordsWRam.resize(_gbc._wRam.size(), Record{ .handler = nullptr });
+    _recordsHRam.resize(_gbc._hRam.size(), Record{ .handler = nullptr });
+  }
+}
+
+void  GBC::CentralProcessingUnit::invalidateWRam(std::size_t index)
+{
+  // Invalidate instructions overlapping WRAM byte
+  fastInvalidate(_recordsWRam, index);
+}
+
+void  GBC::CentralProcessingUnit::invalidateHRam(std::size_t index)
+{
+  // Invalidate instructions overlapping HRAM byte
+  fastInvalidate(_recordsHRam, index);
+}
+
+const GBC::CentralProcessingUnit::Record& GBC::CentralProcessingUnit::fastRecord(std::uint16_t address)
+{
+  Record* record = &_recordScratch;
+
+  // ROM, not cached while bootstrap sequence is mapped
+  if (address < 0x8000) {
+    if (_gbc._io[GBC::GameBoyColor::IO::BANK] != 0) {
+      std::size_t index = _gbc._mbc->getRomIndex(address);
+
+      // Only cache instructions fully inside a bank
+      if (index % 0x4000 <= 0x4000 - 3) {
+        auto& bank = _recordsRom[index / 0x4000];
+
+        // Allocate bank on first execution
+        if (bank.empty() == true)
+          bank.resize(0x4000, Record{ .handler = nullptr });
+        record = &bank[index % 0x4000];
+      }
+    }
+  }
+
+  // WRAM and its echo, only cache instructions fully inside a 4 KiB bank
+  else if (address >= 0xC000 && address < 0xFE00) {
+    std::uint16_t offset = (address - 0xC000) % 0x2000;
+
+    if (offset % 0x1000 <= 0x1000 - 3)
+      record = &_recordsWRam[(offset < 0x1000) ?
+        (offset) :
+        (std::max(_gbc._io[GBC::GameBoyColor::IO::SVBK] & 0b00000111, 1) * 0x1000 + (offset - 0x1000))];
+  }
+
+  // HRAM
+  else if (address >= 0xFF80 && address < 0xFFFF - 2)
+    record = &_recordsHRam[address - 0xFF80];
+
+  // Decode instruction if not cached
+  if (record->handler == nullptr || record == &_recordScratch)
+    fastDecode(address, *record);
+
+  return *record;
+}
+
+void  GBC::CentralProcessingUnit::fastDecode(std::uint16_t address, Record& record)
+{
+  std::uint8_t  opcode = _gbc.read(address);
+
+  // Bitwise instructions are decoded from their sub-opcode
+  if (opcode == 0xCB) {
+    record = _recordsCb[_gbc.read(address + 1)];
+    return;
+  }
+
+  // Get instruction from table
+  record = _records[opcode];
+
+  // Get immediate operand
+  if (record.length >= 2)
+    record.operand = _gbc.read(address + 1);
+  if (record.length >= 3)
+    record.operand |= (std::uint16_t)_gbc.read(address + 2) << 8;
+}
+
+void  GBC::CentralProcessingUnit::fastInvalidate(std::vector<Record>& records, std::size_t index)
+{
+  // No cache in accurate mode
+  if (records.empty() == true)
+    return;
+
+  // Invalidate every instruction which might include the byte
+  for (std::size_t offset = 0; offset < 3 && offset <= index; offset++)
+    records[index - offset].handler = nullptr;
+}
+
+void  GBC::CentralProcessingUnit::fastPush(std::uint16_t value)
+{
+  // Push high then low byte
+  _rSP.u16 -= 1;
+  _gbc.write(_rSP.u16, (value >> 8) & 0b11111111);
+  _rSP.u16 -= 1;
+  _gbc.write(_rSP.u16, (value >> 0) & 0b11111111);
+}
+
+std::uint16_t GBC::CentralProcessingUnit::fastPop()
+{
+  std::uint16_t value;
+
+  // Pop low then high byte
+  value = _gbc.read(_rSP.u16);
+  _rSP.u16 += 1;
+  value |= (std::uint16_t)_gbc.read(_rSP.u16) << 8;
+  _rSP.u16 += 1;
+
+  return value;
+}
+
 void  GBC::CentralProcessingUnit::simulateFetch()
 {
   // Check for interrupt before fetching a new instruction
@@ -1178,6 +1910,10 @@ void  GBC::CentralProcessingUnit::simulateFetch()
 
   // Add instructions
   _opcodes[_opcode](*this);
+
+  // Count executed instructions
+  if (_gbc._profile.enabled == true)
+    _gbc._profile.instructions++;
 }
 
 void  GBC::CentralProcessingUnit::simulateInterrupt()
@@ -1219,46 +1955,46 @@ void  GBC::CentralProcessingUnit::simulateInterrupt()
   }
 }
 
-void  GBC::CentralProcessingUnit::save(std::ofstream& file) const
+void  GBC::CentralProcessingUnit::save(GBC::SaveState& state) const
 {
   // Save CPU variables
-  _gbc.save(file, "CPU_STATUS", _status);
-  _gbc.save(file, "CPU_OPCODE", _opcode);
-  _gbc.save(file, "CPU_SET", _set);
-  _gbc.save(file, "CPU_STEP", _instructions.size());
-  _gbc.save(file, "CPU_IME", _ime);
-  _gbc.save(file, "CPU_RAF", _rAF);
-  _gbc.save(file, "CPU_RBC", _rBC);
-  _gbc.save(file, "CPU_RDE", _rDE);
-  _gbc.save(file, "CPU_RHL", _rHL);
-  _gbc.save(file, "CPU_RSP", _rSP);
-  _gbc.save(file, "CPU_RPC", _rPC);
-  _gbc.save(file, "CPU_RW", _rW);
+  _gbc.save(state, "CPU_STATUS", _status);
+  _gbc.save(state, "CPU_OPCODE", _opcode);
+  _gbc.save(state, "CPU_SET", _set);
+  _gbc.save(state, "CPU_STEP", _instructions.size());
+  _gbc.save(state, "CPU_IME", _ime);
+  _gbc.save(state, "CPU_RAF", _rAF);
+  _gbc.save(state, "CPU_RBC", _rBC);
+  _gbc.save(state, "CPU_RDE", _rDE);
+  _gbc.save(state, "CPU_RHL", _rHL);
+  _gbc.save(state, "CPU_RSP", _rSP);
+  _gbc.save(state, "CPU_RPC", _rPC);
+  _gbc.save(state, "CPU_RW", _rW);
 
   // Save memory BUS
-  _bus.save(file);
+  _bus.save(state);
 }
 
-void  GBC::CentralProcessingUnit::load(std::ifstream& file)
+void  GBC::CentralProcessingUnit::load(GBC::LoadState& state)
 {
   std::size_t step = 0;
   
   // Load CPU variable
-  _gbc.load(file, "CPU_STATUS", _status);
-  _gbc.load(file, "CPU_OPCODE", _opcode);
-  _gbc.load(file, "CPU_SET", _set);
-  _gbc.load(file, "CPU_STEP", step);
-  _gbc.load(file, "CPU_IME", _ime);
-  _gbc.load(file, "CPU_RAF", _rAF);
-  _gbc.load(file, "CPU_RBC", _rBC);
-  _gbc.load(file, "CPU_RDE", _rDE);
-  _gbc.load(file, "CPU_RHL", _rHL);
-  _gbc.load(file, "CPU_RSP", _rSP);
-  _gbc.load(file, "CPU_RPC", _rPC);
-  _gbc.load(file, "CPU_RW", _rW);
+  _gbc.load(state, "CPU_STATUS", _status);
+  _gbc.load(state, "CPU_OPCODE", _opcode);
+  _gbc.load(state, "CPU_SET", _set);
+  _gbc.load(state, "CPU_STEP", step);
+  _gbc.load(state, "CPU_IME", _ime);
+  _gbc.load(state, "CPU_RAF", _rAF);
+  _gbc.load(state, "CPU_RBC", _rBC);
+  _gbc.load(state, "CPU_RDE", _rDE);
+  _gbc.load(state, "CPU_RHL", _rHL);
+  _gbc.load(state, "CPU_RSP", _rSP);
+  _gbc.load(state, "CPU_RPC", _rPC);
+  _gbc.load(state, "CPU_RW", _rW);
 
   // Load memory BUS
-  _bus.load(file);
+  _bus.load(state);
 
   // Clear instruction queue
   while (_instructions.empty() == false)
@@ -1275,6 +2011,8 @@ void  GBC::CentralProcessingUnit::load(std::ifstream& file)
   // Pop already executed sub-instructions
   while (_instructions.size() > step)
     _instructions.pop();
+
+  // Decoded instructions of ROM are kept, WRAM and HRAM ones are invalidated by GBC
 }
 
 GBC::CentralProcessingUnit::Instructions::Instructions() :
@@ -1378,20 +2116,26 @@ void  GBC::CentralProcessingUnit::Bus::write(std::uint16_t address, std::uint8_t
   this->data = data;
 }
 
-void  GBC::CentralProcessingUnit::Bus::save(std::ofstream& file) const
+void  GBC::CentralProcessingUnit::Bus::cancel()
+{
+  // Drop pending operation
+  _operation = Operation::None;
+}
+
+void  GBC::CentralProcessingUnit::Bus::save(GBC::SaveState& state) const
 {
   // Save BUS variables
-  _gbc.save(file, "BUS_OPERATION", _operation);
-  _gbc.save(file, "BUS_ADDRESS", _address);
-  _gbc.save(file, "BUS_DATA", data);
+  _gbc.save(state, "BUS_OPERATION", _operation);
+  _gbc.save(state, "BUS_ADDRESS", _address);
+  _gbc.save(state, "BUS_DATA", data);
 }
 
-void  GBC::CentralProcessingUnit::Bus::load(std::ifstream& file)
+void  GBC::CentralProcessingUnit::Bus::load(GBC::LoadState& state)
 {
   // Load BUS variables
-  _gbc.load(file, "BUS_OPERATION", _operation);
-  _gbc.load(file, "BUS_ADDRESS", _address);
-  _gbc.load(file, "BUS_DATA", data);
+  _gbc.load(state, "BUS_OPERATION", _operation);
+  _gbc.load(state, "BUS_ADDRESS", _address);
+  _gbc.load(state, "BUS_DATA", data);
 }
 
 void  GBC::CentralProcessingUnit::instruction_NOP()
@@ -1406,7 +2150,7 @@ void  GBC::CentralProcessingUnit::instruction_STOP()
     });
   _instructions.push([](GBC::CentralProcessingUnit& cpu) {
     if (cpu._gbc._io[GBC::GameBoyColor::IO::KEY1] & 0b00000001)
-      cpu._gbc._io[GBC::GameBoyColor::IO::KEY1] ^= 0b10000001;
+      cpu._gbc.switchSpeed();
     else
       cpu._status = Status::StatusStop;
     // TODO: 8200 cycle wait
@@ -3064,4 +3808,562 @@ void  GBC::CentralProcessingUnit::instruction_POP_AF()
   _instructions.push([](GBC::CentralProcessingUnit& cpu) {
     cpu._rAF.u8.high = cpu._bus.data;
     });
+}
+
+void  GBC::CentralProcessingUnit::fast_STOP()
+{
+  // Switch speed if prepared
+  if (_gbc._io[GBC::GameBoyColor::IO::KEY1] & 0b00000001)
+    _gbc.switchSpeed();
+  else
+    _status = Status::StatusStop;
+}
+
+void  GBC::CentralProcessingUnit::fast_HALT()
+{
+  _status = Status::StatusHalt;
+}
+
+void  GBC::CentralProcessingUnit::fast_DI()
+{
+  _ime = InterruptMasterEnable::IMEDisabled;
+}
+
+void  GBC::CentralProcessingUnit::fast_EI()
+{
+  _ime = InterruptMasterEnable::IMEScheduled;
+}
+
+void  GBC::CentralProcessingUnit::fast_JR_n(const Record& record)
+{
+  _rPC.u16 += (std::int8_t)record.operand;
+}
+
+void  GBC::CentralProcessingUnit::fast_JR_c0_n(Register::Flag flag, const Record& record)
+{
+  if (!(_rAF.u8.low & flag)) {
+    _rPC.u16 += (std::int8_t)record.operand;
+    _cycles += 1;
+  }
+}
+
+void  GBC::CentralProcessingUnit::fast_JR_c1_n(Register::Flag flag, const Record& record)
+{
+  if (_rAF.u8.low & flag) {
+    _rPC.u16 += (std::int8_t)record.operand;
+    _cycles += 1;
+  }
+}
+
+void  GBC::CentralProcessingUnit::fast_JP_nn(const Record& record)
+{
+  _rPC.u16 = record.operand;
+}
+
+void  GBC::CentralProcessingUnit::fast_JP_c0_nn(Register::Flag flag, const Record& record)
+{
+  if (!(_rAF.u8.low & flag)) {
+    _rPC.u16 = record.operand;
+    _cycles += 1;
+  }
+}
+
+void  GBC::CentralProcessingUnit::fast_JP_c1_nn(Register::Flag flag, const Record& record)
+{
+  if (_rAF.u8.low & flag) {
+    _rPC.u16 = record.operand;
+    _cycles += 1;
+  }
+}
+
+void  GBC::CentralProcessingUnit::fast_JP_HL()
+{
+  _rPC.u16 = _rHL.u16;
+}
+
+void  GBC::CentralProcessingUnit::fast_CALL_nn(const Record& record)
+{
+  fastPush(_rPC.u16);
+  _rPC.u16 = record.operand;
+}
+
+void  GBC::CentralProcessingUnit::fast_CALL_c0_nn(Register::Flag flag, const Record& record)
+{
+  if (!(_rAF.u8.low & flag)) {
+    fastPush(_rPC.u16);
+    _rPC.u16 = record.operand;
+    _cycles += 3;
+  }
+}
+
+void  GBC::CentralProcessingUnit::fast_CALL_c1_nn(Register::Flag flag, const Record& record)
+{
+  if (_rAF.u8.low & flag) {
+    fastPush(_rPC.u16);
+    _rPC.u16 = record.operand;
+    _cycles += 3;
+  }
+}
+
+void  GBC::CentralProcessingUnit::fast_RST(std::uint16_t address)
+{
+  fastPush(_rPC.u16);
+  _rPC.u16 = address;
+}
+
+void  GBC::CentralProcessingUnit::fast_RET()
+{
+  _rPC.u16 = fastPop();
+}
+
+void  GBC::CentralProcessingUnit::fast_RET_c0(Register::Flag flag)
+{
+  if (!(_rAF.u8.low & flag)) {
+    _rPC.u16 = fastPop();
+    _cycles += 3;
+  }
+}
+
+void  GBC::CentralProcessingUnit::fast_RET_c1(Register::Flag flag)
+{
+  if (_rAF.u8.low & flag) {
+    _rPC.u16 = fastPop();
+    _cycles += 3;
+  }
+}
+
+void  GBC::CentralProcessingUnit::fast_RETI()
+{
+  _rPC.u16 = fastPop();
+  _ime = InterruptMasterEnable::IMEEnabled;
+}
+
+void  GBC::CentralProcessingUnit::fast_INC_r(std::uint8_t& reg8)
+{
+  reg8 += 1;
+  setFlag<Register::Z>(reg8 == 0);
+  setFlag<Register::N>(false);
+  setFlag<Register::H>((reg8 & 0b00001111) == 0b00000000);
+}
+
+void  GBC::CentralProcessingUnit::fast_DEC_r(std::uint8_t& reg8)
+{
+  reg8 -= 1;
+  setFlag<Register::Z>(reg8 == 0);
+  setFlag<Register::N>(true);
+  setFlag<Register::H>((reg8 & 0b00001111) == 0b00001111);
+}
+
+void  GBC::CentralProcessingUnit::fast_INC_rr(Register& reg16)
+{
+  reg16.u16 += 1;
+}
+
+void  GBC::CentralProcessingUnit::fast_DEC_rr(Register& reg16)
+{
+  reg16.u16 -= 1;
+}
+
+void  GBC::CentralProcessingUnit::fast_RLC(std::uint8_t& reg8)
+{
+  setFlag<Register::Z>(reg8 == 0);
+  setFlag<Register::N>(false);
+  setFlag<Register::H>(false);
+  setFlag<Register::C>(reg8 & 0b10000000);
+  reg8 = (reg8 << 1) | (reg8 >> 7);
+}
+
+void  GBC::CentralProcessingUnit::fast_RLCA()
+{
+  fast_RLC(_rAF.u8.high);
+  setFlag<Register::Z>(false);
+}
+
+void  GBC::CentralProcessingUnit::fast_RRC(std::uint8_t& reg8)
+{
+  setFlag<Register::Z>(reg8 == 0);
+  setFlag<Register::N>(false);
+  setFlag<Register::H>(false);
+  setFlag<Register::C>(reg8 & 0b00000001);
+  reg8 = (reg8 >> 1) | (reg8 << 7);
+}
+
+void  GBC::CentralProcessingUnit::fast_RRCA()
+{
+  fast_RRC(_rAF.u8.high);
+  setFlag<Register::Z>(false);
+}
+
+void  GBC::CentralProcessingUnit::fast_RL(std::uint8_t& reg8)
+{
+  std::uint8_t  carry = getFlag<Register::C>() ? 0b00000001 : 0b00000000;
+
+  setFlag<Register::Z>((reg8 & 0b01111111) == 0 && carry == 0);
+  setFlag<Register::N>(false);
+  setFlag<Register::H>(false);
+  setFlag<Register::C>(reg8 & 0b10000000);
+  reg8 = (reg8 << 1) | carry;
+}
+
+void  GBC::CentralProcessingUnit::fast_RLA()
+{
+  fast_RL(_rAF.u8.high);
+  setFlag<Register::Z>(false);
+}
+
+void  GBC::CentralProcessingUnit::fast_RR(std::uint8_t& reg8)
+{
+  std::uint8_t  carry = getFlag<Register::C>() ? 0b10000000 : 0b00000000;
+
+  setFlag<Register::Z>((reg8 & 0b11111110) == 0 && carry == 0);
+  setFlag<Register::N>(false);
+  setFlag<Register::H>(false);
+  setFlag<Register::C>(reg8 & 0b00000001);
+  reg8 = (reg8 >> 1) | carry;
+}
+
+void  GBC::CentralProcessingUnit::fast_RRA()
+{
+  fast_RR(_rAF.u8.high);
+  setFlag<Register::Z>(false);
+}
+
+void  GBC::CentralProcessingUnit::fast_SLA(std::uint8_t& reg8)
+{
+  setFlag<Register::Z>((reg8 & 0b01111111) == 0);
+  setFlag<Register::N>(false);
+  setFlag<Register::H>(false);
+  setFlag<Register::C>(reg8 & 0b10000000);
+  reg8 <<= 1;
+}
+
+void  GBC::CentralProcessingUnit::fast_SRA(std::uint8_t& reg8)
+{
+  setFlag<Register::Z>((reg8 & 0b11111110) == 0);
+  setFlag<Register::N>(false);
+  setFlag<Register::H>(false);
+  setFlag<Register::C>(reg8 & 0b00000001);
+  reg8 = (reg8 >> 1) | (reg8 & 0b10000000);
+}
+
+void  GBC::CentralProcessingUnit::fast_SWAP(std::uint8_t& reg8)
+{
+  setFlag<Register::Z>(reg8 == 0);
+  setFlag<Register::N>(false);
+  setFlag<Register::H>(false);
+  setFlag<Register::C>(false);
+  reg8 = (reg8 >> 4) | (reg8 << 4);
+}
+
+void  GBC::CentralProcessingUnit::fast_SRL(std::uint8_t& reg8)
+{
+  setFlag<Register::Z>((reg8 & 0b11111110) == 0);
+  setFlag<Register::N>(false);
+  setFlag<Register::H>(false);
+  setFlag<Register::C>(reg8 & 0b00000001);
+  reg8 >>= 1;
+}
+
+void  GBC::CentralProcessingUnit::fast_DAA()
+{
+  if (getFlag<Register::N>() == true) {
+    if (getFlag<Register::H>() == true)
+      _rAF.u8.high += 0xFA;
+    if (getFlag<Register::C>() == true)
+      _rAF.u8.high += 0xA0;
+  }
+  else {
+    std::uint16_t a = _rAF.u8.high;
+
+    if ((a & 0b0000000000001111) > 0b00001001 || getFlag<Register::H>() == true)
+      a += 0b00000110;
+    if ((a & 0b0000000111110000) > 0b10010000 || getFlag<Register::C>() == true) {
+      a += 0b01100000;
+      setFlag<Register::C>(true);
+    }
+    else
+      setFlag<Register::C>(false);
+    _rAF.u8.high = (std::uint8_t)a;
+  }
+  setFlag<Register::H>(false);
+  setFlag<Register::Z>(_rAF.u8.high == 0);
+}
+
+void  GBC::CentralProcessingUnit::fast_CPL()
+{
+  _rAF.u8.high = ~_rAF.u8.high;
+  setFlag<Register::N>(true);
+  setFlag<Register::H>(true);
+}
+
+void  GBC::CentralProcessingUnit::fast_SCF()
+{
+  setFlag<Register::N>(false);
+  setFlag<Register::H>(false);
+  setFlag<Register::C>(true);
+}
+
+void  GBC::CentralProcessingUnit::fast_CCF()
+{
+  setFlag<Register::N>(false);
+  setFlag<Register::H>(false);
+  setFlag<Register::C>(!getFlag<Register::C>());
+}
+
+template <unsigned int Bit>
+void  GBC::CentralProcessingUnit::fast_BIT(std::uint8_t reg8)
+{
+  setFlag<Register::Z>(!(reg8 & (0b00000001 << Bit)));
+  setFlag<Register::N>(false);
+  setFlag<Register::H>(true);
+}
+
+template <unsigned int Bit>
+void  GBC::CentralProcessingUnit::fast_RES(std::uint8_t& reg8)
+{
+  reg8 &= ~(0b00000001 << Bit);
+}
+
+template <unsigned int Bit>
+void  GBC::CentralProcessingUnit::fast_SET(std::uint8_t& reg8)
+{
+  reg8 |= 0b00000001 << Bit;
+}
+
+template <void (GBC::CentralProcessingUnit::* Operation)(std::uint8_t&)>
+void  GBC::CentralProcessingUnit::fast_pHL()
+{
+  std::uint8_t  value = _gbc.read(_rHL.u16);
+
+  // Read, modify and write back (HL)
+  (this->*Operation)(value);
+  _gbc.write(_rHL.u16, value);
+}
+
+void  GBC::CentralProcessingUnit::fast_ADD(std::uint8_t value)
+{
+  std::uint8_t  left = _rAF.u8.high;
+  std::uint8_t  right = value;
+
+  _rAF.u8.high = left + right;
+  setFlag<Register::Z>(_rAF.u8.high == 0);
+  setFlag<Register::N>(false);
+  setFlag<Register::H>((left & 0b00001111) + (right & 0b00001111) > 0b00001111);
+  setFlag<Register::C>((std::uint16_t)left + (std::uint16_t)right > 0b11111111);
+}
+
+void  GBC::CentralProcessingUnit::fast_ADC(std::uint8_t value)
+{
+  std::uint8_t  left = _rAF.u8.high;
+  std::uint8_t  right = value;
+  std::uint8_t  carry = getFlag<Register::C>() ? 1 : 0;
+
+  _rAF.u8.high = left + right + carry;
+  setFlag<Register::Z>(_rAF.u8.high == 0);
+  setFlag<Register::N>(false);
+  setFlag<Register::H>((left & 0b00001111) + (right & 0b00001111) + carry > 0b00001111);
+  setFlag<Register::C>((std::uint16_t)left + (std::uint16_t)right + (std::uint16_t)carry > 0b11111111);
+}
+
+void  GBC::CentralProcessingUnit::fast_SUB(std::uint8_t value)
+{
+  std::uint8_t  left = _rAF.u8.high;
+  std::uint8_t  right = value;
+
+  _rAF.u8.high = left - right;
+  setFlag<Register::Z>(_rAF.u8.high == 0);
+  setFlag<Register::N>(true);
+  setFlag<Register::H>((left & 0b00001111) < (right & 0b00001111));
+  setFlag<Register::C>(left < right);
+}
+
+void  GBC::CentralProcessingUnit::fast_SBC(std::uint8_t value)
+{
+  std::uint8_t  left = _rAF.u8.high;
+  std::uint8_t  right = value;
+  std::uint8_t  carry = getFlag<Register::C>() ? 1 : 0;
+
+  _rAF.u8.high = left - right - carry;
+  setFlag<Register::Z>(_rAF.u8.high == 0);
+  setFlag<Register::N>(true);
+  setFlag<Register::H>((std::uint16_t)(left & 0b00001111) < (std::uint16_t)(right & 0b00001111) + (std::uint16_t)carry);
+  setFlag<Register::C>((std::uint16_t)left < (std::uint16_t)right + (std::uint16_t)carry);
+}
+
+void  GBC::CentralProcessingUnit::fast_AND(std::uint8_t value)
+{
+  _rAF.u8.high &= value;
+  setFlag<Register::Z>(_rAF.u8.high == 0);
+  setFlag<Register::N>(false);
+  setFlag<Register::H>(true);
+  setFlag<Register::C>(false);
+}
+
+void  GBC::CentralProcessingUnit::fast_XOR(std::uint8_t value)
+{
+  _rAF.u8.high ^= value;
+  setFlag<Register::Z>(_rAF.u8.high == 0);
+  setFlag<Register::N>(false);
+  setFlag<Register::H>(false);
+  setFlag<Register::C>(false);
+}
+
+void  GBC::CentralProcessingUnit::fast_OR(std::uint8_t value)
+{
+  _rAF.u8.high |= value;
+  setFlag<Register::Z>(_rAF.u8.high == 0);
+  setFlag<Register::N>(false);
+  setFlag<Register::H>(false);
+  setFlag<Register::C>(false);
+}
+
+void  GBC::CentralProcessingUnit::fast_CP(std::uint8_t value)
+{
+  std::uint8_t  left = _rAF.u8.high;
+  std::uint8_t  right = value;
+
+  setFlag<Register::Z>(left == right);
+  setFlag<Register::N>(true);
+  setFlag<Register::H>((left & 0b00001111) < (right & 0b00001111));
+  setFlag<Register::C>(left < right);
+}
+
+void  GBC::CentralProcessingUnit::fast_LD_r_r(std::uint8_t& reg8_destination, std::uint8_t reg8_source)
+{
+  reg8_destination = reg8_source;
+}
+
+void  GBC::CentralProcessingUnit::fast_LD_pHL_r(std::uint8_t reg8)
+{
+  _gbc.write(_rHL.u16, reg8);
+}
+
+void  GBC::CentralProcessingUnit::fast_LD_A_prr(Register reg16)
+{
+  _rAF.u8.high = _gbc.read(reg16.u16);
+}
+
+void  GBC::CentralProcessingUnit::fast_LD_prr_A(Register reg16)
+{
+  _gbc.write(reg16.u16, _rAF.u8.high);
+}
+
+void  GBC::CentralProcessingUnit::fast_LD_A_pnn(const Record& record)
+{
+  _rAF.u8.high = _gbc.read(record.operand);
+}
+
+void  GBC::CentralProcessingUnit::fast_LD_pnn_A(const Record& record)
+{
+  _gbc.write(record.operand, _rAF.u8.high);
+}
+
+void  GBC::CentralProcessingUnit::fast_LDH_A_pC()
+{
+  _rAF.u8.high = _gbc.read(0xFF00 + _rBC.u8.low);
+}
+
+void  GBC::CentralProcessingUnit::fast_LDH_pC_A()
+{
+  _gbc.write(0xFF00 + _rBC.u8.low, _rAF.u8.high);
+}
+
+void  GBC::CentralProcessingUnit::fast_LDH_A_pn(const Record& record)
+{
+  _rAF.u8.high = _gbc.read(0xFF00 + record.operand);
+}
+
+void  GBC::CentralProcessingUnit::fast_LDH_pn_A(const Record& record)
+{
+  _gbc.write(0xFF00 + record.operand, _rAF.u8.high);
+}
+
+void  GBC::CentralProcessingUnit::fast_LD_A_HLd()
+{
+  _rAF.u8.high = _gbc.read(_rHL.u16);
+  _rHL.u16 -= 1;
+}
+
+void  GBC::CentralProcessingUnit::fast_LD_HLd_A()
+{
+  _gbc.write(_rHL.u16, _rAF.u8.high);
+  _rHL.u16 -= 1;
+}
+
+void  GBC::CentralProcessingUnit::fast_LD_A_HLi()
+{
+  _rAF.u8.high = _gbc.read(_rHL.u16);
+  _rHL.u16 += 1;
+}
+
+void  GBC::CentralProcessingUnit::fast_LD_HLi_A()
+{
+  _gbc.write(_rHL.u16, _rAF.u8.high);
+  _rHL.u16 += 1;
+}
+
+void  GBC::CentralProcessingUnit::fast_ADD_HL_rr(Register reg16)
+{
+  std::uint16_t left = _rHL.u16;
+  std::uint16_t right = reg16.u16;
+
+  _rHL.u16 = left + right;
+  setFlag<Register::N>(false);
+  setFlag<Register::H>((left & 0b0000111111111111) + (right & 0b0000111111111111) > 0b0000111111111111);
+  setFlag<Register::C>((std::uint32_t)left + (std::uint32_t)right > 0b1111111111111111);
+}
+
+void  GBC::CentralProcessingUnit::fast_ADD_SP_n(const Record& record)
+{
+  std::int32_t  n = (std::int8_t)record.operand;
+  std::int32_t  sp = _rSP.u16;
+
+  _rSP.u16 = sp + n;
+  setFlag<Register::Z>(false);
+  setFlag<Register::N>(false);
+  setFlag<Register::H>((sp & 0b00001111) + (n & 0b00001111) > 0b00001111);
+  setFlag<Register::C>((sp & 0b11111111) + (n & 0b11111111) > 0b11111111);
+}
+
+void  GBC::CentralProcessingUnit::fast_LD_rr_nn(Register& reg16, const Record& record)
+{
+  reg16.u16 = record.operand;
+}
+
+void  GBC::CentralProcessingUnit::fast_LD_pnn_SP(const Record& record)
+{
+  _gbc.write(record.operand + 0, _rSP.u8.low);
+  _gbc.write(record.operand + 1, _rSP.u8.high);
+}
+
+void  GBC::CentralProcessingUnit::fast_LD_HL_SPn(const Record& record)
+{
+  std::int32_t  n = (std::int8_t)record.operand;
+  std::int32_t  sp = _rSP.u16;
+
+  _rHL.u16 = sp + n;
+  setFlag<Register::Z>(false);
+  setFlag<Register::N>(false);
+  setFlag<Register::H>((sp & 0b00001111) + (n & 0b00001111) > 0b00001111);
+  setFlag<Register::C>((sp & 0b11111111) + (n & 0b11111111) > 0b11111111);
+}
+
+void  GBC::CentralProcessingUnit::fast_LD_SP_HL()
+{
+  _rSP.u16 = _rHL.u16;
+}
+
+void  GBC::CentralProcessingUnit::fast_PUSH_rr(Register reg16)
+{
+  fastPush(reg16.u16);
+}
+
+void  GBC::CentralProcessingUnit::fast_POP_rr(Register& reg16)
+{
+  reg16.u16 = fastPop();
+}
+
+void  GBC::CentralProcessingUnit::fast_POP_AF()
+{
+  _rAF.u16 = fastPop() & 0b1111111111110000;
 }
\ No newline at end of file
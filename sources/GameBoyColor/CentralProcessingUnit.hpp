@@ -4,16 +4,25 @@
 #include <cstdint>
 #include <functional>
 #include <queue>
+#include <vector>
 
 namespace GBC
 {
   class GameBoyColor;
+  struct LoadState;
+  struct SaveState;
 
   class CentralProcessingUnit
   {
   public:
     static constexpr  std::size_t  Frequency = 4 * 1024 * 1024; // Number of CPU ticks per second
 
+    enum Mode
+    {
+      ModeAccurate, // Execute instructions as micro-operations, one per M-cycle
+      ModeFast      // Execute whole pre-decoded instructions at once
+    };
+
   private:
     union Register
     {
@@ -94,9 +103,10 @@ namespace GBC
 
       void  read(std::uint16_t address);                      // Read one byte at given address, available next cycle in data
       void  write(std::uint16_t address, std::uint8_t data);  // Read one byte at given address, available next cycle in data
+      void  cancel();                                         // Cancel pending operation
 
-      void  save(std::ofstream& file) const;  // Save memory BUS to file
-      void  load(std::ifstream& file);        // Load memory BUS from file
+      void  save(GBC::SaveState& state) const;  // Save memory BUS
+      void  load(GBC::LoadState& state);        // Load memory BUS
     };
 
     union Parameter
@@ -147,6 +157,26 @@ namespace GBC
     static const std::array<Opcode, 256>  _opcodesCb;       // CPU CB sub-instruction set
     static const std::array<Opcode, 5>    _opcodesSpecial;  // CPU special sub-instruction set
 
+    struct Record
+    {
+      using Handler = void(*)(GBC::CentralProcessingUnit&, const GBC::CentralProcessingUnit::Record&);
+
+      Handler       handler;  // Whole-instruction handler, nullptr when not decoded
+      std::uint16_t operand;  // Immediate operand (n or nn)
+      std::uint8_t  length;   // Size of instruction in bytes
+      std::uint8_t  cycles;   // Number of M-cycles (condition not met for conditional instructions)
+    };
+
+    static const std::array<Record, 256>  _records;   // Pre-decoded instruction set, without operand
+    static const std::array<Record, 256>  _recordsCb; // Pre-decoded CB sub-instruction set
+
+    Mode                              _mode;          // Execution mode
+    std::vector<std::vector<Record>>  _recordsRom;    // Decoded instructions of each ROM bank, allocated on first execution
+    std::vector<Record>               _recordsWRam;   // Decoded instructions of WRAM
+    std::vector<Record>               _recordsHRam;   // Decoded instructions of HRAM
+    Record                            _recordScratch; // Decoded instruction not cached (boot, VRAM, external RAM, bank boundaries)
+    unsigned int                      _cycles;        // Number of M-cycles of current fast instruction
+
     template<Register::Flag F>
     void  setFlag(bool value) // Set flag bit in register AF
     {
@@ -286,16 +316,116 @@ namespace GBC
     void  instruction_POP_rr(Register& reg16);
     void  instruction_POP_AF();
 
+    void  fast_STOP();
+    void  fast_HALT();
+    void  fast_DI();
+    void  fast_EI();
+
+    void  fast_JR_n(const Record& record);
+    void  fast_JR_c0_n(Register::Flag flag, const Record& record);
+    void  fast_JR_c1_n(Register::Flag flag, const Record& record);
+    void  fast_JP_nn(const Record& record);
+    void  fast_JP_c0_nn(Register::Flag flag, const Record& record);
+    void  fast_JP_c1_nn(Register::Flag flag, const Record& record);
+    void  fast_JP_HL();
+    void  fast_CALL_nn(const Record& record);
+    void  fast_CALL_c0_nn(Register::Flag flag, const Record& record);
+    void  fast_CALL_c1_nn(Register::Flag flag, const Record& record);
+    void  fast_RST(std::uint16_t address);
+    void  fast_RET();
+    void  fast_RET_c0(Register::Flag flag);
+    void  fast_RET_c1(Register::Flag flag);
+    void  fast_RETI();
+
+    void  fast_INC_r(std::uint8_t& reg8);
+    void  fast_DEC_r(std::uint8_t& reg8);
+    void  fast_INC_rr(Register& reg16);
+    void  fast_DEC_rr(Register& reg16);
+
+    void  fast_RLC(std::uint8_t& reg8);
+    void  fast_RLCA();
+    void  fast_RRC(std::uint8_t& reg8);
+    void  fast_RRCA();
+    void  fast_RL(std::uint8_t& reg8);
+    void  fast_RLA();
+    void  fast_RR(std::uint8_t& reg8);
+    void  fast_RRA();
+    void  fast_SLA(std::uint8_t& reg8);
+    void  fast_SRA(std::uint8_t& reg8);
+    void  fast_SWAP(std::uint8_t& reg8);
+    void  fast_SRL(std::uint8_t& reg8);
+    void  fast_DAA();
+    void  fast_CPL();
+    void  fast_SCF();
+    void  fast_CCF();
+
+    template <unsigned int Bit> void  fast_BIT(std::uint8_t reg8);
+    template <unsigned int Bit> void  fast_RES(std::uint8_t& reg8);
+    template <unsigned int Bit> void  fast_SET(std::uint8_t& reg8);
+
+    template <void (GBC::CentralProcessingUnit::* Operation)(std::uint8_t&)>
+    void  fast_pHL(); // Apply read-modify-write operation to (HL)
+
+    void  fast_ADD(std::uint8_t value);
+    void  fast_ADC(std::uint8_t value);
+    void  fast_SUB(std::uint8_t value);
+    void  fast_SBC(std::uint8_t value);
+    void  fast_AND(std::uint8_t value);
+    void  fast_XOR(std::uint8_t value);
+    void  fast_OR(std::uint8_t value);
+    void  fast_CP(std::uint8_t value);
+
+    void  fast_LD_r_r(std::uint8_t& reg8_destination, std::uint8_t reg8_source);
+    void  fast_LD_pHL_r(std::uint8_t reg8);
+    void  fast_LD_A_prr(Register reg16);
+    void  fast_LD_prr_A(Register reg16);
+    void  fast_LD_A_pnn(const Record& record);
+    void  fast_LD_pnn_A(const Record& record);
+    void  fast_LDH_A_pC();
+    void  fast_LDH_pC_A();
+    void  fast_LDH_A_pn(const Record& record);
+    void  fast_LDH_pn_A(const Record& record);
+    void  fast_LD_A_HLd();
+    void  fast_LD_HLd_A();
+    void  fast_LD_A_HLi();
+    void  fast_LD_HLi_A();
+
+    void  fast_ADD_HL_rr(Register reg16);
+    void  fast_ADD_SP_n(const Record& record);
+    void  fast_LD_rr_nn(Register& reg16, const Record& record);
+    void  fast_LD_pnn_SP(const Record& record);
+    void  fast_LD_HL_SPn(const Record& record);
+    void  fast_LD_SP_HL();
+    void  fast_PUSH_rr(Register reg16);
+    void  fast_POP_rr(Register& reg16);
+    void  fast_POP_AF();
+
     void  simulateFetch();      // Fetch next instruction or interrupt to execute
     void  simulateInterrupt();  // CPU interrupt handling
 
+    const Record& fastRecord(std::uint16_t address);              // Get decoded instruction at address, decode it if not cached
+    void          fastDecode(std::uint16_t address, Record& record);  // Decode instruction at address
+    void          fastInvalidate(std::vector<Record>& records, std::size_t index);  // Invalidate decoded instructions overlapping byte at index
+    void          fastPush(std::uint16_t value);                  // Push 16 bits value on stack
+    std::uint16_t fastPop();                                      // Pop 16 bits value from stack
+
   public:
     CentralProcessingUnit(GBC::GameBoyColor& gbc);
     ~CentralProcessingUnit() = default;
 
-    void  simulate(); // Simulate 4 clock ticks / 1 CPU tick of the CPU
+    void          simulate();             // Simulate 4 clock ticks / 1 CPU tick of the CPU
+    unsigned int  simulateInstruction();  // Simulate a whole instruction in fast mode, return number of CPU ticks
+    bool          halted() const;         // Check if CPU is halted until next interrupt
+
+    std::array<std::uint8_t, 6> registers() const;  // Get B, C, D, E, H and L registers
+
+    GBC::CentralProcessingUnit::Mode  mode() const;                             // Get execution mode
+    void                              mode(GBC::CentralProcessingUnit::Mode mode);  // Set execution mode
+
+    void  invalidateWRam(std::size_t index);  // Invalidate decoded instructions overlapping WRAM byte
+    void  invalidateHRam(std::size_t index);  // Invalidate decoded instructions overlapping HRAM byte
 
-    void  save(std::ofstream& file) const;  // Save state to file
-    void  load(std::ifstream& file);        // Load state from file
+    void  save(GBC::SaveState& state) const;  // Save state
+    void  load(GBC::LoadState& state);        // Load state
   };
 }
\ No newline at end of file
@@ -1,10 +1,14 @@
+#include <algorithm>
 #include <fstream>
 #include <filesystem>
+#include <iostream>
 
 #include "GameBoyColor/EmulationScene.hpp"
 #include "GameBoyColor/MenuScene.hpp"
 #include "Math/Math.hpp"
+#include "System/Config.hpp"
 #include "System/Window.hpp"
+#include "System/Library/FontLibrary.hpp"
 
 GBC::EmulationScene::EmulationScene(Game::SceneMachine& machine, const std::filesystem::path& filename) :
   Game::AbstractScene(machine),
@@ -12,7 +16,16 @@ GBC::EmulationScene::EmulationScene(Game::SceneMachine& machine, const std::file
   _gbc(filename, _texture, Math::Vector<2, unsigned int>((unsigned int)0, (unsigned int)0)),
   _fps(-0.42f),
   _stream(),
-  _vsync(Game::Window::Instance().getVerticalSync())
+  _vsync(Game::Window::Instance().getVerticalSync()),
+  _rewind(RewindCapacity),
+  _snapshot(),
+  _rewindFrame(0),
+  _runAhead(0),
+  _frameSkip(FrameSkipAuto),
+  _skipped(0),
+  _profile(false),
+  _profileLast(),
+  _profileReport()
 {
   // Texture is not filtered
   _texture.setSmooth(false);
@@ -30,16 +43,31 @@ GBC::EmulationScene::~EmulationScene()
   // Stop the stream before destroying the class
   _stream.stop();
 
+  // Report sound stream health
+  std::cout << "[GBC::EmulationScene] Sound stream: " << _stream.underruns() << " under-runs, " << (int)(_stream.fill() * 100.f) << "% filled." << std::endl;
+
+  // Report frame-skip
+  std::cout << "[GBC::EmulationScene] Frames: " << _gbc.emulated() << " emulated, " << _gbc.presented() << " presented." << std::endl;
+
+  // Report profile since overlay was enabled
+  if (_profile == true)
+    std::cout << "[GBC::EmulationScene] Profile:" << std::endl << _gbc.profile().report(GBC::Profile());
+
   // Restore vertical sync
   Game::Window::Instance().setVerticalSync(_vsync);
 }
 
 bool  GBC::EmulationScene::update(float elapsed)
 {
-  auto& window = Game::Window::Instance();
+  auto&       window = Game::Window::Instance();
+  const float duration = (float)GBC::PixelProcessingUnit::FrameDuration / (float)GBC::CentralProcessingUnit::Frequency;
+
+  // Maximum number of frames simulated per call, late frames are caught up only with automatic frame-skip
+  // NOTE: bounded to avoid exponential delay
+  const std::size_t limit = (_frameSkip == FrameSkipAuto) ? FrameSkipLimit + 1 : 1;
 
-  // Update timers
-  _fps = std::min(_fps + elapsed, 2.f * (float)GBC::PixelProcessingUnit::FrameDuration / (float)GBC::CentralProcessingUnit::Frequency);
+  // Update timers, nudged by sound stream to keep its buffer stable
+  _fps = std::min(_fps + elapsed * _stream.rate(), (float)(limit + 1) * duration);
 
   // Sound volume control
   if (window.keyboard().keyDown(Game::Window::Key::Subtract) == true)
@@ -47,33 +75,98 @@ bool  GBC::EmulationScene::update(float elapsed)
   if (window.keyboard().keyDown(Game::Window::Key::Add) == true)
     _stream.setVolume(std::clamp(_stream.getVolume() + elapsed * 64.f, 0.f, 100.f));
 
+  // Toggle fast CPU mode
+  if (window.keyboard().keyPressed(Game::Window::Key::Tab) == true)
+    _gbc.mode((_gbc.mode() == GBC::CentralProcessingUnit::Mode::ModeFast) ? GBC::CentralProcessingUnit::Mode::ModeAccurate : GBC::CentralProcessingUnit::Mode::ModeFast);
+
+  // Run-ahead frames control
+  if (window.keyboard().keyPressed(Game::Window::Key::PageUp) == true)
+    _runAhead = std::min(_runAhead + 1, RunAheadLimit);
+  if (window.keyboard().keyPressed(Game::Window::Key::PageDown) == true)
+    _runAhead = (_runAhead > 0) ? _runAhead - 1 : 0;
+
+  // Frame-skip control, cycle from automatic to fixed number of skipped frames
+  if (window.keyboard().keyPressed(Game::Window::Key::Home) == true) {
+    _frameSkip = (_frameSkip == FrameSkipAuto) ? 0 : ((_frameSkip < FrameSkipLimit) ? _frameSkip + 1 : FrameSkipAuto);
+    _skipped = 0;
+  }
+
+  // Toggle profile overlay, counters are only collected when displayed
+  if (window.keyboard().keyPressed(Game::Window::Key::Insert) == true) {
+    _profile = !_profile;
+    _gbc.profile(_profile);
+    _profileLast = _gbc.profile();
+    _profileReport = "";
+  }
+
   const std::array<Game::Window::Key, 12> save_slots = {
     Game::Window::Key::F1, Game::Window::Key::F2, Game::Window::Key::F3, Game::Window::Key::F4,
     Game::Window::Key::F5, Game::Window::Key::F6, Game::Window::Key::F7, Game::Window::Key::F8,
     Game::Window::Key::F9, Game::Window::Key::F10, Game::Window::Key::F11, Game::Window::Key::F12
   };
   
-  // Save/load states
+  // Save/load states, Alt exports save in text format
   for (std::size_t index = 0; index < save_slots.size(); index++) {
     if (window.keyboard().keyPressed(save_slots[index]) == true) {
       if (window.keyboard().keyDown(Game::Window::Key::LShift) == true ||
         window.keyboard().keyDown(Game::Window::Key::RShift) == true)
-        _gbc.save(index + 1);
+        _gbc.save(index + 1, (window.keyboard().keyDown(Game::Window::Key::LAlt) == true) ? GBC::SaveState::Format::FormatText : GBC::SaveState::Format::FormatBinary);
       else
         _gbc.load(index + 1);
     }
   }
 
-  // Simulate frames at 59.72 fps
-  // NOTE: simulate at most one frame per call to avoid exponential delay
-  if (_fps >= (float)GBC::PixelProcessingUnit::FrameDuration / (float)GBC::CentralProcessingUnit::Frequency ||
+  // Simulate frames at 59.72 fps, at least one when fast-forwarding
+  std::size_t frames = std::min((std::size_t)(_fps / duration), limit);
+
+  if (frames == 0 && (
     window.keyboard().keyDown(Game::Window::Key::LControl) == true ||
-    window.joystick().position(0, Game::Window::JoystickAxis::Z) < -64.f) {
-    _gbc.simulate();
-    _fps = std::max(_fps - (float)GBC::PixelProcessingUnit::FrameDuration / (float)GBC::CentralProcessingUnit::Frequency, 0.f);
+    window.joystick().position(0, Game::Window::JoystickAxis::Z) < -64.f))
+    frames = 1;
 
-    // Push sound buffer to sound stream queue
-    _stream.push(_gbc.sound());
+  if (frames > 0) {
+    _fps = std::max(_fps - (float)frames * duration, 0.f);
+
+    // Rewind one snapshot per frame, then simulate a frame to refresh screen
+    if (window.keyboard().keyDown(Game::Window::Key::Backspace) == true) {
+      if (_rewind.pop(_snapshot) == true) {
+        _gbc.skip(false);
+        _gbc.load(_snapshot);
+        _gbc.simulate();
+      }
+      _rewindFrame = 0;
+    }
+
+    else {
+      for (std::size_t frame = 0; frame < frames; frame++) {
+        // Automatic frame-skip only draws end of a late burst, fixed frame-skip one frame out of N + 1
+        // NOTE: PPU applies request at next VBlank, so displayed frame is requested one simulation earlier
+        bool  skip = (_frameSkip == FrameSkipAuto) ? (frame + 2 < frames) : (_skipped < _frameSkip);
+
+        _skipped = (skip == true) ? _skipped + 1 : 0;
+        _gbc.skip(skip);
+        _gbc.simulate();
+
+        // Record a snapshot every few frames
+        if (++_rewindFrame >= RewindInterval) {
+          _gbc.save(_snapshot);
+          _rewind.push(_snapshot);
+          _rewindFrame = 0;
+        }
+
+        // Push sound buffer to sound stream queue
+        _stream.push(_gbc.sound());
+      }
+
+      // Display a frame ahead to hide input latency
+      _gbc.simulateAhead(_runAhead);
+    }
+
+    // Refresh profile overlay with averages of last frames
+    if (_profile == true && _gbc.profile().frames >= _profileLast.frames + ProfileInterval) {
+      _profileReport = _gbc.profile().report(_profileLast);
+      _profileLast = _gbc.profile();
+    }
   }
 
   // Go to menu
@@ -88,13 +181,23 @@ void  GBC::EmulationScene::draw()
 {
   // Draw GBC rendering target
   Game::Window::Instance().draw(_gbc.lcd());
+
+  // Draw profile overlay
+  if (_profile == true) {
+    sf::Text  text(Game::FontLibrary::Instance().get(Game::Config::ExecutablePath / "assets" / "fonts" / "04b03.ttf"), _profileReport.empty() == true ? "profiling..." : _profileReport, 16);
+
+    text.setOutlineThickness(2.f);
+    text.setPosition({ 8.f, 8.f });
+    Game::Window::Instance().draw(text);
+  }
 }
 
 GBC::EmulationScene::SoundStream::SoundStream() :
-  _sounds(),
-  _lock(),
+  _ring(),
+  _write(0),
+  _read(0),
+  _underruns(0),
   _buffer(),
-  _index(0),
   _status(GBC::EmulationScene::SoundStream::Buffering)
 {
   initialize(2, GBC::AudioProcessingUnit::SampleRate, { sf::SoundChannel::FrontLeft, sf::SoundChannel::FrontRight });
@@ -103,42 +206,37 @@ GBC::EmulationScene::SoundStream::SoundStream() :
 
 bool  GBC::EmulationScene::SoundStream::onGetData(sf::SoundStream::Chunk& chunk)
 {
-  // Set chunk data
-  chunk.sampleCount = _buffer.size() / 1;
-  chunk.samples = _buffer.data();
-  
-  // Fill chunk buffer
-  for (std::size_t index = 0; index < chunk.sampleCount / 2; index++)
-  {
-    // Change status
-    if (_sounds.size() > 1)
-      _status = Playing;
-    else if (_sounds.empty() == true)
-      _status = Buffering;
+  const std::size_t read = _read.load(std::memory_order_relaxed);
+  const std::size_t available = _write.load(std::memory_order_acquire) - read;
 
-    // Get sample from queue
-    if (_status == Playing) {
-      _buffer[index * 2 + 0] = _sounds.front()[_index * 2 + 0];
-      _buffer[index * 2 + 1] = _sounds.front()[_index * 2 + 1];
-      _index++;
+  // Start playing once enough samples are buffered
+  if (_status == Buffering && available >= Target)
+    _status = Playing;
 
-      // Finished sound
-      if (_index >= _buffer.size() / 2) {
-        _index = 0;
+  std::size_t count = (_status == Playing) ? std::min(available, _buffer.size()) : 0;
 
-        // Pop sounds from queue
-        std::unique_lock<std::mutex>  lock(_lock);
-        _sounds.pop();
-      }
-    }
+  // Copy samples from ring, in two parts when wrapping around
+  std::size_t first = std::min(count, _ring.size() - read % _ring.size());
 
-    // Empty buffer, silent
-    else {
-      _buffer[index * 2 + 0] = 0;
-      _buffer[index * 2 + 1] = 0;
+  std::copy(_ring.begin() + read % _ring.size(), _ring.begin() + read % _ring.size() + first, _buffer.begin());
+  std::copy(_ring.begin(), _ring.begin() + (count - first), _buffer.begin() + first);
+
+  // Missing samples, pad with silence and buffer again
+  if (count < _buffer.size()) {
+    std::fill(_buffer.begin() + count, _buffer.end(), 0);
+    if (_status == Playing) {
+      _underruns.fetch_add(1, std::memory_order_relaxed);
+      _status = Buffering;
     }
   }
 
+  // Release samples to emulation thread
+  _read.store(read + count, std::memory_order_release);
+
+  // Set chunk data
+  chunk.sampleCount = _buffer.size();
+  chunk.samples = _buffer.data();
+
   return true;
 }
 
@@ -149,14 +247,36 @@ void  GBC::EmulationScene::SoundStream::onSeek(sf::Time)
 
 void  GBC::EmulationScene::SoundStream::push(const std::array<std::int16_t, GBC::AudioProcessingUnit::BufferSize>& sound)
 {
-  std::unique_lock<std::mutex>  lock(_lock);
+  const std::size_t write = _write.load(std::memory_order_relaxed);
 
-  // Push buffer to queue
-  _sounds.push(sound);
+  // Ring is full, drop sound
+  if (write - _read.load(std::memory_order_acquire) + sound.size() > _ring.size())
+    return;
 
-  // Limit number of sounds in queue
-  if (_sounds.size() > 3) {
-    _sounds.pop();
-    _index = 0;
-  }
+  // Copy samples to ring, in two parts when wrapping around
+  std::size_t first = std::min(sound.size(), _ring.size() - write % _ring.size());
+
+  std::copy(sound.begin(), sound.begin() + first, _ring.begin() + write % _ring.size());
+  std::copy(sound.begin() + first, sound.end(), _ring.begin());
+
+  // Publish samples to audio thread
+  _write.store(write + sound.size(), std::memory_order_release);
+}
+
+float GBC::EmulationScene::SoundStream::fill() const
+{
+  // Samples waiting to be played
+  return (float)(_write.load(std::memory_order_acquire) - _read.load(std::memory_order_acquire)) / (float)_ring.size();
+}
+
+float GBC::EmulationScene::SoundStream::rate() const
+{
+  // Speed up when below target, slow down when above, pitch change is inaudible
+  return 1.f + Correction * std::clamp(((float)Target / (float)_ring.size() - fill()) / ((float)Target / (float)_ring.size()), -1.f, +1.f);
+}
+
+std::size_t GBC::EmulationScene::SoundStream::underruns() const
+{
+  // Chunks played with missing samples
+  return _underruns.load(std::memory_order_relaxed);
 }
\ No newline at end of file
@@ -1,17 +1,18 @@
 #pragma once
 
 #include <array>
+#include <atomic>
 #include <cstdint>
 #include <filesystem>
 #include <string>
 #include <vector>
-#include <queue>
 
 #include <SFML/Graphics.hpp>
 #include <SFML/System.hpp>
 #include <SFML/Audio.hpp>
 
 #include "GameBoyColor/GameBoyColor.hpp"
+#include "GameBoyColor/Rewind.hpp"
 #include "Scenes/AbstractScene.hpp"
 
 namespace GBC
@@ -19,6 +20,13 @@ namespace GBC
   class EmulationScene : public Game::AbstractScene
   {
   private:
+    static constexpr std::size_t  RewindInterval = 8;                 // Frames between rewind snapshots
+    static constexpr std::size_t  RewindCapacity = 32 * 1024 * 1024;  // Memory of rewind ring buffer
+    static constexpr std::size_t  RunAheadLimit = 4;                  // Maximum number of frames simulated ahead
+    static constexpr std::size_t  FrameSkipLimit = 4;                 // Maximum number of consecutive frames not displayed
+    static constexpr std::size_t  FrameSkipAuto = (std::size_t)-1;    // Frame-skip only when emulation is late
+    static constexpr std::size_t  ProfileInterval = 60;               // Frames averaged by profile overlay
+
     sf::Texture         _texture; // Rendering target
     GBC::GameBoyColor   _gbc;     // Game Boy emulator
     float               _fps;     // Timer for FPS control
@@ -26,10 +34,17 @@ namespace GBC
 
     class SoundStream : public sf::SoundStream
     {
-      std::queue<std::array<std::int16_t, GBC::AudioProcessingUnit::BufferSize>>  _sounds;  // Sound buffer
-      std::array<std::int16_t, GBC::AudioProcessingUnit::BufferSize>              _buffer;  // Buffer sent to play
-      std::mutex                                                                  _lock;    // Sounds buffer lock
-      std::size_t                                                                 _index;   // Currently played index
+    public:
+      static constexpr std::size_t  Capacity = GBC::AudioProcessingUnit::BufferSize * 8; // Number of samples in ring buffer
+      static constexpr std::size_t  Target = GBC::AudioProcessingUnit::BufferSize * 2;   // Number of samples buffered before playing, fill level kept by rate control
+      static constexpr float        Correction = 0.005f;                                 // Maximum emulation speed correction of rate control
+
+    private:
+      std::array<std::int16_t, Capacity>                              _ring;      // Single-producer/single-consumer ring buffer of samples
+      std::atomic<std::size_t>                                        _write;     // Total number of samples written to ring, only modified by emulation thread
+      std::atomic<std::size_t>                                        _read;      // Total number of samples read from ring, only modified by audio thread
+      std::atomic<std::size_t>                                        _underruns; // Number of chunks played with missing samples
+      std::array<std::int16_t, GBC::AudioProcessingUnit::BufferSize>  _buffer;    // Buffer sent to play
 
       enum {
         Playing,
@@ -43,11 +58,26 @@ namespace GBC
       SoundStream();
       ~SoundStream() = default;
 
-      void  push(const std::array<std::int16_t, GBC::AudioProcessingUnit::BufferSize>& sound);  // Feed a new sound buffer to stream
+      void  push(const std::array<std::int16_t, GBC::AudioProcessingUnit::BufferSize>& sound);  // Feed a new sound buffer to stream, dropped if ring is full
+
+      float       fill() const;       // Fill level of ring buffer (0-1)
+      float       rate() const;       // Emulation speed factor to keep fill level around target
+      std::size_t underruns() const;  // Number of chunks played with missing samples
     };
 
     GBC::EmulationScene::SoundStream  _stream;  // Sound stream of Game Boy Color
 
+    GBC::Rewind               _rewind;      // Ring buffer of past states
+    std::vector<std::uint8_t> _snapshot;    // Binary snapshot buffer, reused between frames
+    std::size_t               _rewindFrame; // Frames since last rewind snapshot
+    std::size_t               _runAhead;    // Frames simulated ahead of displayed one, 0 to disable
+    std::size_t               _frameSkip;   // Frames skipped between displayed ones, FrameSkipAuto to skip only when late
+    std::size_t               _skipped;     // Frames skipped since last displayed one
+
+    bool          _profile;         // Display profile overlay
+    GBC::Profile  _profileLast;     // Copy of emulator profile at last overlay refresh
+    std::string   _profileReport;   // Text of profile overlay
+
   public:
     EmulationScene(Game::SceneMachine& machine, const std::filesystem::path& filename);
     ~EmulationScene();
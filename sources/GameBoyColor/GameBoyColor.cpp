@@ -11,16 +11,38 @@
 #include "System/Config.hpp"
 #include "System/Window.hpp"
 
+#include <atomic>
+#include <iomanip>
 #include <iostream>
+#include <map>
+#include <sstream>
 #include <thread>
+#include <tuple>
 #include <chrono>
+#include <unordered_map>
 
 const std::string_view GBC::GameBoyColor::SaveStateBase = "0123456789ABCDEF";
 
 GBC::GameBoyColor::GameBoyColor(const std::filesystem::path& filename, sf::Texture& texture, Math::Vector<2, unsigned int> origin) :
+  GBC::GameBoyColor(filename, &texture, origin)
+{}
+
+GBC::GameBoyColor::GameBoyColor(const std::filesystem::path& filename) :
+  GBC::GameBoyColor(filename, nullptr, Math::Vector<2, unsigned int>((unsigned int)0, (unsigned int)0))
+{}
+
+GBC::GameBoyColor::GameBoyColor(const std::filesystem::path& filename, sf::Texture* texture, Math::Vector<2, unsigned int> origin) :
   _header(),
   _path(filename),
   _boot(),
+  _headless(texture == nullptr),
+  _serial(),
+  _ahead(),
+  _discard(false),
+  _link(nullptr),
+  _linkBytes(0),
+  _linkSkew(0),
+  _profile(),
   _cycles(0),
   _cpu(*this),
   _ppu(*this, texture, origin),
@@ -30,9 +52,18 @@ GBC::GameBoyColor::GameBoyColor(const std::filesystem::path& filename, sf::Textu
   _io(),
   _hRam(),
   _ie(0),
+  _readPages(),
+  _writePages(),
   _keys{0},
   _bindings(),
-  _transferMode(Transfer::TransferNone)
+  _input(),
+  _transferMode(Transfer::TransferNone),
+  _transferIndex(0),
+  _transferTrigger(false),
+  _events(),
+  _eventCycles(),
+  _timerCycles(0),
+  _ppuCycles(0)
 {
   // Initialize bindings
   loadBindings();
@@ -48,12 +79,22 @@ GBC::GameBoyColor::GameBoyColor(const std::filesystem::path& filename, sf::Textu
   // Initialize registers
   _io[IO::JOYP] = 0b11111111;
   _io[IO::HDMA5] = 0b11111111;
+
+  // No event scheduled
+  _eventCycles.fill(GBC::GameBoyColor::EventNever);
+
+  // Map boot, ROM and RAM banks
+  updatePages();
 }
 
 GBC::GameBoyColor::~GameBoyColor()
 {
-  // Save key bindings to file
-  saveBindings();
+  // Disconnect link cable
+  unlink();
+
+  // Save key bindings to file, headless instances leave user configuration untouched
+  if (_headless == false)
+    saveBindings();
 }
 
 void  GBC::GameBoyColor::load(const std::filesystem::path& filename)
@@ -90,8 +131,10 @@ void  GBC::GameBoyColor::loadFile(const std::filesystem::path& filename, std::ve
     throw std::runtime_error((std::string(__FILE__) + ": l." + std::to_string(__LINE__)).c_str());
 }
 
-void  GBC::GameBoyColor::loadHeader(const std::vector<uint8_t>& rom)
+GBC::GameBoyColor::Header  GBC::GameBoyColor::parseHeader(std::span<const std::uint8_t> rom)
 {
+  GBC::GameBoyColor::Header header;
+
   // Too small game
   if (rom.size() < 0x0150)
     throw std::runtime_error((std::string(__FILE__) + ": l." + std::to_string(__LINE__)).c_str());
@@ -104,31 +147,31 @@ void  GBC::GameBoyColor::loadHeader(const std::vector<uint8_t>& rom)
   };
 
   // Logo should be identical
-  _header.logo = (std::memcmp(nintendo, rom.data() + 0x0104, sizeof(nintendo)) == 0);
+  header.logo = (std::memcmp(nintendo, rom.data() + 0x0104, sizeof(nintendo)) == 0);
 
   // Game title
-  _header.title.clear();
+  header.title.clear();
   for (unsigned int index = 0x0134; index <= 0x0143 && rom[index] != '\0'; index++)
-    _header.title += rom[index];
+    header.title += rom[index];
 
   // CGB format (we don't handle intermediary format between GB & CGB)
   if (rom[0x0143] & 0b10000000)
   {
     // 11 characters title
-    _header.title = _header.title.substr(0, 11);
+    header.title = header.title.substr(0, 11);
 
     // 4 characters manufacturer
-    _header.manufacturer.clear();
+    header.manufacturer.clear();
     for (unsigned int index = 0x013F; index <= 0x0142 && rom[index] != '\0'; index++)
-      _header.manufacturer += rom[index];
+      header.manufacturer += rom[index];
 
     // CGB flag
     switch (rom[0x0143] & 0b11000000) {
     case 0x80:
-      _header.cgb = Header::CGBFlag::CGBSupport;
+      header.cgb = Header::CGBFlag::CGBSupport;
       break;
     case 0xC0:
-      _header.cgb = Header::CGBFlag::CGBOnly;
+      header.cgb = Header::CGBFlag::CGBOnly;
       break;
     default:
       throw std::runtime_error((std::string(__FILE__) + ": l." + std::to_string(__LINE__)).c_str());
@@ -137,26 +180,26 @@ void  GBC::GameBoyColor::loadHeader(const std::vector<uint8_t>& rom)
 
   // GB format
   else {
-    _header.manufacturer = "";
-    _header.cgb = Header::CGBFlag::CGBNone;
+    header.manufacturer = "";
+    header.cgb = Header::CGBFlag::CGBNone;
   }
 
   // Old licensee code
   if (rom[0x0144] == 0x01 && rom[0x0145] == 0x4B)
-    _header.licensee = rom[0x014B];
+    header.licensee = rom[0x014B];
   // New Lecensee code
   else {
-    ((uint8_t*)&_header.licensee)[0] = rom[0x0144];
-    ((uint8_t*)&_header.licensee)[1] = rom[0x0145];
+    ((uint8_t*)&header.licensee)[0] = rom[0x0144];
+    ((uint8_t*)&header.licensee)[1] = rom[0x0145];
   }
 
   // SGB flag
   switch (rom[0x0146]) {
   case 0x00:
-    _header.sgb = Header::SGBFlag::SGBNone;
+    header.sgb = Header::SGBFlag::SGBNone;
     break;
   case 0x03:
-    _header.sgb = Header::SGBFlag::SGBSupport;
+    header.sgb = Header::SGBFlag::SGBSupport;
     break;
   default:
     throw std::runtime_error((std::string(__FILE__) + ": l." + std::to_string(__LINE__)).c_str());
@@ -166,16 +209,16 @@ void  GBC::GameBoyColor::loadHeader(const std::vector<uint8_t>& rom)
   switch (rom[0x0148])
   {
   case 0x52:
-    _header.rom_size = 72 * 16384;
+    header.rom_size = 72 * 16384;
     break;
   case 0x53:
-    _header.rom_size = 80 * 16384;
+    header.rom_size = 80 * 16384;
     break;
   case 0x54:
-    _header.rom_size = 96 * 16384;
+    header.rom_size = 96 * 16384;
     break;
   default:
-    _header.rom_size = (0b00000010 << rom[0x0148]) * 16384;
+    header.rom_size = (0b00000010 << rom[0x0148]) * 16384;
     break;
   }
 
@@ -183,101 +226,58 @@ void  GBC::GameBoyColor::loadHeader(const std::vector<uint8_t>& rom)
   switch (rom[0x0149])
   {
   case 0x00:
-    _header.ram_size = 0;
+    header.ram_size = 0;
     break;
   case 0x01:
-    _header.ram_size = 2 * 1024;
+    header.ram_size = 2 * 1024;
     break;
   case 0x02:
-    _header.ram_size = 8 * 1024;
+    header.ram_size = 8 * 1024;
     break;
   case 0x03:
-    _header.ram_size = 32 * 1024;
+    header.ram_size = 32 * 1024;
     break;
   case 0x04:
-    _header.ram_size = 128 * 1024;
+    header.ram_size = 128 * 1024;
     break;
   case 0x05:
-    _header.ram_size = 64 * 1024;
+    header.ram_size = 64 * 1024;
     break;
   default:
     throw std::runtime_error((std::string(__FILE__) + ": l." + std::to_string(__LINE__)).c_str());
   }
 
-  // Cartridge Type
+  // Cartridge type
   switch (rom[0x0147]) {
   case 0x00:  // ROM only
-    _mbc = std::make_unique<GBC::MemoryBankController>(*this, rom);
-    _header.mbc = Header::MBC::MBCNone;
-    break;
   case 0x08:  // ROM+RAM, never used
-    _mbc = std::make_unique<GBC::MemoryBankController>(*this, rom, _header.ram_size);
-    _header.mbc = Header::MBC::MBCNone;
-    break;
   case 0x09:  // ROM+RAM+BATTERY, never used
-    _mbc = std::make_unique<GBC::MemoryBankController>(*this, rom, _header.ram_size, std::filesystem::path(_path).replace_extension(".gbs"));
-    _header.mbc = Header::MBC::MBCNone;
+    header.mbc = Header::MBC::MBCNone;
     break;
-
   case 0x01:  // MBC1
-    _mbc = std::make_unique<GBC::MemoryBankController1>(*this, rom);
-    _header.mbc = Header::MBC::MBC1;
-    break;
   case 0x02:  // MBC1+RAM
-    _mbc = std::make_unique<GBC::MemoryBankController1>(*this, rom, _header.ram_size);
-    _header.mbc = Header::MBC::MBC1;
-    break;
   case 0x03:  // MBC1+RAM+BATTERY
-    _mbc = std::make_unique<GBC::MemoryBankController1>(*this, rom, _header.ram_size, std::filesystem::path(_path).replace_extension(".gbs"));
-    _header.mbc = Header::MBC::MBC1;
+    header.mbc = Header::MBC::MBC1;
     break;
-
   case 0x05:  // MBC2
-    _mbc = std::make_unique<GBC::MemoryBankController2>(*this, rom);
-    _header.mbc = Header::MBC::MBC2;
-    break;
   case 0x06:  // MBC2+BATTERY
-    _mbc = std::make_unique<GBC::MemoryBankController2>(*this, rom, std::filesystem::path(_path).replace_extension(".gbs"));
-    _header.mbc = Header::MBC::MBC2;
+    header.mbc = Header::MBC::MBC2;
     break;
-
   case 0x0F:  // MBC3+TIMER+BATTERY
-    _mbc = std::make_unique<GBC::MemoryBankController3>(*this, rom, 0, "", std::filesystem::path(_path).replace_extension(".rtc"));
-    _header.mbc = Header::MBC::MBC3;
-    break;
   case 0x10:  // MBC3+TIMER+RAM+BATTERY
-    _mbc = std::make_unique<GBC::MemoryBankController3>(*this, rom, _header.ram_size, std::filesystem::path(_path).replace_extension(".gbs"), std::filesystem::path(_path).replace_extension(".rtc"));
-    _header.mbc = Header::MBC::MBC3;
-    break;
   case 0x11:  // MBC3
-    _mbc = std::make_unique<GBC::MemoryBankController3>(*this, rom);
-    _header.mbc = Header::MBC::MBC3;
-    break;
   case 0x12:  // MBC3+RAM
-    _mbc = std::make_unique<GBC::MemoryBankController3>(*this, rom, _header.ram_size);
-    _header.mbc = Header::MBC::MBC3;
-    break;
   case 0x13:  // MBC3+RAM+BATTERY
-    _mbc = std::make_unique<GBC::MemoryBankController3>(*this, rom, _header.ram_size, std::filesystem::path(_path).replace_extension(".gbs"));
-    _header.mbc = Header::MBC::MBC3;
+    header.mbc = Header::MBC::MBC3;
     break;
-
   case 0x19:  // MBC5
-  case 0x1C:  // MBC5+RUMBLE
-    _mbc = std::make_unique<GBC::MemoryBankController5>(*this, rom);
-    _header.mbc = Header::MBC::MBC5;
-    break;
   case 0x1A:  // MBC5+RAM
-  case 0x1D:  // MBC5+RUMBLE+RAM
-    _mbc = std::make_unique<GBC::MemoryBankController5>(*this, rom, _header.ram_size);
-    _header.mbc = Header::MBC::MBC5;
-    break;
   case 0x1B:  // MBC5+RAM+BATTERY
+  case 0x1C:  // MBC5+RUMBLE
+  case 0x1D:  // MBC5+RUMBLE+RAM
   case 0x1E:  // MBC5+RUMBLE+RAM+BATTERY
-    _mbc = std::make_unique<GBC::MemoryBankController5>(*this, rom, _header.ram_size, std::filesystem::path(_path).replace_extension(".gbs"));
-    _header.mbc = Header::MBC::MBC5;
+    header.mbc = Header::MBC::MBC5;
     break;
-
   default:
     throw std::runtime_error((std::string(__FILE__) + ": l." + std::to_string(__LINE__)).c_str());
   }
@@ -285,18 +285,18 @@ void  GBC::GameBoyColor::loadHeader(const std::vector<uint8_t>& rom)
   // Region
   switch (rom[0x014A]) {
   case 0x00:
-    _header.region = Header::Region::RegionJP;
+    header.region = Header::Region::RegionJP;
     break;
   case 0x01:
-    _header.region = Header::Region::RegionUSEU;
+    header.region = Header::Region::RegionUSEU;
     break;
   default:
-    _header.region = Header::Region::RegionUnknow;
+    header.region = Header::Region::RegionUnknow;
     break;
   }
 
   // Game ROM version
-  _header.version = rom[0x014C];
+  header.version = rom[0x014C];
 
   std::uint8_t  header_checksum = 0;
 
@@ -305,7 +305,7 @@ void  GBC::GameBoyColor::loadHeader(const std::vector<uint8_t>& rom)
     header_checksum = header_checksum - rom[index] - 1;
 
   // Check header checksum
-  _header.header_checksum = (header_checksum == rom[0x014D]);
+  header.header_checksum = (header_checksum == rom[0x014D]);
 
   std::uint16_t global_checksum = 0;
 
@@ -315,7 +315,82 @@ void  GBC::GameBoyColor::loadHeader(const std::vector<uint8_t>& rom)
       global_checksum += rom[index];
 
   // Check global checksum
-  _header.global_checksum = (global_checksum == rom[0x014E] * 256 + rom[0x014F]);
+  header.global_checksum = (global_checksum == rom[0x014E] * 256 + rom[0x014F]);
+
+  return header;
+}
+
+void  GBC::GameBoyColor::loadHeader(const std::vector<uint8_t>& rom)
+{
+  // Cartridge header, global checksum on whole ROM
+  _header = parseHeader(rom);
+
+  // Battery save files, headless runs are reproducible and never touch them
+  auto  battery = [this](const char* extension) {
+    return (_headless == true) ? std::filesystem::path() : std::filesystem::path(_path).replace_extension(extension);
+    };
+
+  // Cartridge Type
+  switch (rom[0x0147]) {
+  case 0x00:  // ROM only
+    _mbc = std::make_unique<GBC::MemoryBankController>(*this, rom);
+    break;
+  case 0x08:  // ROM+RAM, never used
+    _mbc = std::make_unique<GBC::MemoryBankController>(*this, rom, _header.ram_size);
+    break;
+  case 0x09:  // ROM+RAM+BATTERY, never used
+    _mbc = std::make_unique<GBC::MemoryBankController>(*this, rom, _header.ram_size, battery(".gbs"));
+    break;
+
+  case 0x01:  // MBC1
+    _mbc = std::make_unique<GBC::MemoryBankController1>(*this, rom);
+    break;
+  case 0x02:  // MBC1+RAM
+    _mbc = std::make_unique<GBC::MemoryBankController1>(*this, rom, _header.ram_size);
+    break;
+  case 0x03:  // MBC1+RAM+BATTERY
+    _mbc = std::make_unique<GBC::MemoryBankController1>(*this, rom, _header.ram_size, battery(".gbs"));
+    break;
+
+  case 0x05:  // MBC2
+    _mbc = std::make_unique<GBC::MemoryBankController2>(*this, rom);
+    break;
+  case 0x06:  // MBC2+BATTERY
+    _mbc = std::make_unique<GBC::MemoryBankController2>(*this, rom, battery(".gbs"));
+    break;
+
+  case 0x0F:  // MBC3+TIMER+BATTERY
+    _mbc = std::make_unique<GBC::MemoryBankController3>(*this, rom, 0, "", battery(".rtc"));
+    break;
+  case 0x10:  // MBC3+TIMER+RAM+BATTERY
+    _mbc = std::make_unique<GBC::MemoryBankController3>(*this, rom, _header.ram_size, battery(".gbs"), battery(".rtc"));
+    break;
+  case 0x11:  // MBC3
+    _mbc = std::make_unique<GBC::MemoryBankController3>(*this, rom);
+    break;
+  case 0x12:  // MBC3+RAM
+    _mbc = std::make_unique<GBC::MemoryBankController3>(*this, rom, _header.ram_size);
+    break;
+  case 0x13:  // MBC3+RAM+BATTERY
+    _mbc = std::make_unique<GBC::MemoryBankController3>(*this, rom, _header.ram_size, battery(".gbs"));
+    break;
+
+  case 0x19:  // MBC5
+  case 0x1C:  // MBC5+RUMBLE
+    _mbc = std::make_unique<GBC::MemoryBankController5>(*this, rom);
+    break;
+  case 0x1A:  // MBC5+RAM
+  case 0x1D:  // MBC5+RUMBLE+RAM
+    _mbc = std::make_unique<GBC::MemoryBankController5>(*this, rom, _header.ram_size);
+    break;
+  case 0x1B:  // MBC5+RAM+BATTERY
+  case 0x1E:  // MBC5+RUMBLE+RAM+BATTERY
+    _mbc = std::make_unique<GBC::MemoryBankController5>(*this, rom, _header.ram_size, battery(".gbs"));
+    break;
+
+  default:
+    throw std::runtime_error((std::string(__FILE__) + ": l." + std::to_string(__LINE__)).c_str());
+  }
 }
 
 void  GBC::GameBoyColor::loadBindings()
@@ -378,388 +453,1304 @@ void  GBC::GameBoyColor::simulate()
   while (frame == _cycles / GBC::PixelProcessingUnit::FrameDuration)
     simulateCycle();
 
-  // Post-simulation
-  simulatePost();
+  // Post-simulation
+  simulatePost();
+}
+
+void  GBC::GameBoyColor::simulateAhead(std::size_t frames)
+{
+  std::size_t serial = _serial.size();
+
+  // Nothing to simulate
+  if (frames == 0)
+    return;
+
+  // Snapshot current state
+  save(_ahead);
+
+  // Simulate frames ahead, last one is displayed
+  _discard = true;
+  for (std::size_t frame = 0; frame < frames; frame++)
+    simulate();
+  _discard = false;
+
+  // Restore state, serial output of frames ahead is discarded
+  load(_ahead);
+  _serial.resize(serial);
+}
+
+void  GBC::GameBoyColor::simulateLink()
+{
+  // No linked emulator
+  if (_link == nullptr)
+    throw std::runtime_error((std::string(__FILE__) + ": l." + std::to_string(__LINE__)).c_str());
+
+  GBC::GameBoyColor&  other = *_link;
+  std::uint64_t       frame = _cycles / GBC::PixelProcessingUnit::FrameDuration;
+  std::uint64_t       otherFrame = other._cycles / GBC::PixelProcessingUnit::FrameDuration;
+
+  // Pre-simulation
+  simulatePre();
+  other.simulatePre();
+
+  // Execution loop, emulator behind runs up to a slice ahead of the other one,
+  // so it never passes the end of a transfer the other one is running or could start,
+  // which catches it up when exchanging bytes
+  // NOTE: pending transfer always ends after current cycle, as due events are handled at end of each step
+  while (frame == _cycles / GBC::PixelProcessingUnit::FrameDuration || otherFrame == other._cycles / GBC::PixelProcessingUnit::FrameDuration) {
+    if (otherFrame != other._cycles / GBC::PixelProcessingUnit::FrameDuration || (frame == _cycles / GBC::PixelProcessingUnit::FrameDuration && _cycles <= other._cycles))
+      simulateUntil(std::min(other._cycles + GBC::GameBoyColor::LinkSlice / ((other._io[IO::KEY1] & 0b10000000) ? 2 : 1), other._eventCycles[Event::EventSerial]));
+    else
+      other.simulateUntil(std::min(_cycles + GBC::GameBoyColor::LinkSlice / ((_io[IO::KEY1] & 0b10000000) ? 2 : 1), _eventCycles[Event::EventSerial]));
+  }
+
+  // Post-simulation
+  simulatePost();
+  other.simulatePost();
+}
+
+void  GBC::GameBoyColor::simulateUntil(std::size_t cycles)
+{
+  std::uint64_t frame = _cycles / GBC::PixelProcessingUnit::FrameDuration;
+
+  // Already there
+  if (_cycles >= cycles)
+    return;
+
+  // Stop execution loop at requested cycle
+  schedule(Event::EventLink, cycles);
+
+  // Execution loop
+  while (_cycles < cycles && frame == _cycles / GBC::PixelProcessingUnit::FrameDuration)
+    simulateCycle();
+}
+
+void  GBC::GameBoyColor::link(GBC::GameBoyColor& other)
+{
+  // Can't link to itself
+  if (&other == this)
+    throw std::runtime_error((std::string(__FILE__) + ": l." + std::to_string(__LINE__)).c_str());
+
+  // Disconnect previous cables
+  unlink();
+  other.unlink();
+
+  // Connect both sides
+  _link = &other;
+  other._link = this;
+}
+
+void  GBC::GameBoyColor::unlink()
+{
+  // Disconnect both sides
+  if (_link != nullptr)
+    _link->_link = nullptr;
+  _link = nullptr;
+}
+
+void  GBC::GameBoyColor::simulatePre()
+{
+  GBC::Profile::Scope scope(_profile, GBC::Profile::Subsystem::SubsystemOther);
+
+  // Stop execution loop at end of frame
+  schedule(Event::EventFrame, (_cycles / GBC::PixelProcessingUnit::FrameDuration + 1) * GBC::PixelProcessingUnit::FrameDuration);
+
+  // Simulate Joypad
+  simulateKeys();
+}
+
+void  GBC::GameBoyColor::simulateCycle()
+{
+  GBC::Profile::Scope scope(_profile, GBC::Profile::Subsystem::SubsystemCpu);
+
+  // Simulate CPU
+  switch (_transferMode)
+  {
+    // Run CPU up to next event, by whole instructions in fast mode, by ticks otherwise
+  case Transfer::TransferNone:
+    simulateCpu(_cpu.mode() == GBC::CentralProcessingUnit::Mode::ModeFast);
+    break;
+
+    // DMA transfer
+  case Transfer::TransferDma:
+    // Transfer 4 bytes to OAM, as a block from directly mapped memory
+    if (_profile.enabled == true)
+      _profile.dma += 4;
+    if (const std::uint8_t* block = readBlock(((std::uint16_t)_io[IO::DMA] << 8) + (std::uint16_t)_transferIndex, 4); block != nullptr)
+      _ppu.writeDma((std::uint16_t)_transferIndex, std::span<const std::uint8_t>(block, 4));
+    else
+      for (std::uint16_t index = 0; index < 4; index++)
+        _ppu.writeDma((std::uint16_t)_transferIndex + index, read(((std::uint16_t)_io[IO::DMA] << 8) + (std::uint16_t)_transferIndex + index));
+    _transferIndex += 4;
+
+    // Simulate a tick of the CPU
+    _cpu.simulate();
+    _cycles += (_io[IO::KEY1] & 0b10000000) ? 2 : 4;
+
+    // End of DMA transfer
+    if (_transferIndex == 160)
+      _transferMode = Transfer::TransferNone;
+
+    // TODO: restrict memory access to HRAM during DMA transfer
+    break;
+
+    // General purpose DMA
+  case Transfer::TransferHdma0:
+  {
+    // CPU is stopped and PPU mode can't change before next event, run every tick up to it at once
+    std::size_t ticks = (_events.top().cycles - _cycles + 3) / 4;
+
+    for (std::size_t tick = 0; tick < ticks && _transferMode == Transfer::TransferHdma0; tick++)
+    {
+      std::uint16_t source = ((((std::uint16_t)_io[IO::HDMA1] << 8) + (std::uint16_t)_io[IO::HDMA2]) & 0b1111111111110000) + (std::uint16_t)_transferIndex;
+      std::uint16_t destination = (((((std::uint16_t)_io[IO::HDMA3] << 8) + (std::uint16_t)_io[IO::HDMA4]) & 0b0001111111110000) | 0b1000000000000000) + (std::uint16_t)_transferIndex;
+      bool          end = false;
+
+      // Transfer 8 bytes per tick, as a block from directly mapped memory
+      // NOTE: blocks are aligned, so they never cross a memory region
+      if (const std::uint8_t* block = readBlock(source, 8); block != nullptr && transferValid(source, destination) == true) {
+        _ppu.writeRam(destination - 0x8000, std::span<const std::uint8_t>(block, 8));
+        source += 8;
+        destination += 8;
+      }
+      else {
+        for (std::size_t index = 0; index < 8 && end == false; index++)
+        {
+          // Check transfer adress
+          if (transferValid(source, destination) == true)
+            _ppu.writeRam(destination - 0x8000, read(source));
+          else {
+            end = true;
+            break;
+          }
+
+          source += 1;
+          destination += 1;
+        }
+      }
+
+      // Increment transfer index
+      _transferIndex += 8;
+      if (_profile.enabled == true)
+        _profile.hdma += 8;
+
+      // End of HDMA transfer
+      if (_transferIndex == ((std::size_t)_io[IO::HDMA5] + 1) * 0x10 || end == true) {
+        _transferMode = Transfer::TransferNone;
+        _io[IO::HDMA5] = 0xFF;
+
+        // Increment source and destination
+        _io[IO::HDMA1] = (source >> 8) & 0b11111111;
+        _io[IO::HDMA2] = (source >> 0) & 0b11111111;
+        _io[IO::HDMA3] = (destination >> 8) & 0b11111111;
+        _io[IO::HDMA4] = (destination >> 0) & 0b11111111;
+      }
+
+      // CPU is not executed
+      _cycles += 4;
+    }
+    break;
+  }
+
+  case Transfer::TransferHdma1:
+  {
+    bool trigger = (_io[GBC::PixelProcessingUnit::IO::STAT] & GBC::PixelProcessingUnit::LcdStatus::LcdStatusModeMask) == GBC::PixelProcessingUnit::LcdMode::LcdMode0;
+
+    // Trigger when entering mode 0
+    if (_transferTrigger == false && trigger == true)
+      _transferIndex = 16;
+
+    // Save current mode
+    _transferTrigger = trigger;
+
+    // HDMA Transfer at start of HBlank
+    if (_transferIndex > 0)
+    {
+      std::uint16_t source = ((((std::uint16_t)_io[IO::HDMA1] << 8) + (std::uint16_t)_io[IO::HDMA2]) & 0b1111111111110000) + (std::uint16_t)(16 - _transferIndex);
+      std::uint16_t destination = (((((std::uint16_t)_io[IO::HDMA3] << 8) + (std::uint16_t)_io[IO::HDMA4]) & 0b00011111111110000) | 0b1000000000000000) + (std::uint16_t)(16 - _transferIndex);
+      bool          end = false;
+
+      // Transfer 8 bytes per tick, as a block from directly mapped memory
+      if (const std::uint8_t* block = readBlock(source, 8); block != nullptr && transferValid(source, destination) == true) {
+        _ppu.writeRam(destination - 0x8000, std::span<const std::uint8_t>(block, 8));
+        source += 8;
+        destination += 8;
+      }
+      else {
+        for (std::size_t index = 0; index < 8 && end == false; index++)
+        {
+          // Check transfer adress
+          if (transferValid(source, destination) == true)
+            _ppu.writeRam(destination - 0x8000, read(source));
+          else
+            end = true;
+
+          source += 1;
+          destination += 1;
+        }
+      }
+
+      // Update transfer index
+      _transferIndex -= 8;
+      if (_profile.enabled == true)
+        _profile.hdma += 8;
+
+      // End of data chunk transfer
+      if (_transferIndex == 0) {
+        _io[IO::HDMA5] -= 1;
+
+        // Increment source and destination
+        _io[IO::HDMA1] = (source >> 8) & 0b11111111;
+        _io[IO::HDMA2] = (source >> 0) & 0b11111111;
+        _io[IO::HDMA3] = (destination >> 8) & 0b11111111;
+        _io[IO::HDMA4] = (destination >> 0) & 0b11111111;
+      }
+
+      // End of HDMA transfer
+      if (_io[IO::HDMA5] == 0xFF || end == true) {
+        _transferMode = Transfer::TransferNone;
+        _io[IO::HDMA5] = 0xFF;
+      }
+
+      // CPU is not executed
+      _cycles += 4;
+    }
+
+    // Run CPU up to next event when no transfer, HBlank is a PPU event
+    else
+      simulateCpu(false);
+
+    break;
+  }
+
+  default:
+    throw std::runtime_error((std::string(__FILE__) + ": l." + std::to_string(__LINE__)).c_str());
+  }
+
+  // Update components and handle events
+  synchronize();
+}
+
+const std::uint8_t* GBC::GameBoyColor::readBlock(std::uint16_t addr, std::size_t size) const
+{
+  const std::uint8_t* page = _readPages[addr >> 8];
+
+  // Block must be in a single directly mapped page
+  if (page == nullptr || (addr & 0xFF) + size > 0x0100)
+    return nullptr;
+
+  return page + (addr & 0xFF);
+}
+
+bool  GBC::GameBoyColor::transferValid(std::uint16_t source, std::uint16_t destination)
+{
+  // Source from ROM, external RAM or WRAM, destination in VRAM
+  return ((source >= 0x0000 && source < 0x8000) ||
+    (source >= 0xA000 && source < 0xC000) ||
+    (source >= 0xC000 && source < 0xE000)) &&
+    (destination >= 0x8000 && destination < 0xA000);
+}
+
+void  GBC::GameBoyColor::simulateCpu(bool instruction)
+{
+  Transfer  transfer = _transferMode;
+
+  do {
+    unsigned int  ticks = 1;
+
+    // Nothing happens until next event when CPU is halted, skip to it
+    if (_cpu.halted() == true) {
+      std::size_t speed = (_io[IO::KEY1] & 0b10000000) ? 2 : 4;
+
+      _cycles += (_events.top().cycles - _cycles + speed - 1) / speed * speed;
+      break;
+    }
+
+    // Simulate a whole instruction or a tick of the CPU
+    if (instruction == true)
+      ticks = _cpu.simulateInstruction();
+    else
+      _cpu.simulate();
+    _cycles += ticks * ((_io[IO::KEY1] & 0b10000000) ? 2 : 4);
+  } while (_transferMode == transfer && _cycles < _events.top().cycles);
+}
+
+void  GBC::GameBoyColor::simulateSerial()
+{
+  std::uint8_t  received = 0b11111111;
+
+  // Record sent byte for test ROMs
+  if (_headless == true)
+    _serial.push_back((char)_io[IO::SB]);
+
+  // Exchange bytes with linked emulator
+  if (_link != nullptr) {
+    // Catch up linked emulator to end of transfer, it never runs past it by more than an instruction
+    _link->simulateUntil(_cycles);
+    _linkSkew = std::max(_linkSkew, _link->_cycles - std::min(_link->_cycles, _cycles));
+
+    // Other side waiting for a transfer on external clock
+    if ((_link->_io[IO::SC] & 0b10000001) == 0b10000000) {
+      if (_link->_headless == true)
+        _link->_serial.push_back((char)_link->_io[IO::SB]);
+
+      received = _link->_io[IO::SB];
+      _link->_io[IO::IF] |= Interrupt::InterruptSerial;
+      _link->_io[IO::SB] = _io[IO::SB];
+      _link->_io[IO::SC] &= 0b00000011;
+      _linkBytes++;
+      _link->_linkBytes++;
+    }
+  }
+
+  // Transfer completed
+  // NOTE: no byte received when not linked or other side is not ready, received bit set to 0b11111111
+  _io[IO::IF] |= Interrupt::InterruptSerial;
+  _io[IO::SB] = received;
+  _io[IO::SC] &= 0b00000011;
+}
+
+void  GBC::GameBoyColor::schedule(GBC::GameBoyColor::Event event, std::size_t cycles)
+{
+  // Event already scheduled
+  if (_eventCycles[event] == cycles)
+    return;
+
+  // Previous entry in heap becomes outdated
+  _eventCycles[event] = cycles;
+
+  // Push new entry
+  if (cycles != GBC::GameBoyColor::EventNever)
+    _events.push({ .cycles = cycles, .event = event });
+}
+
+void  GBC::GameBoyColor::synchronize()
+{
+  // Update components, rescheduling their events
+  synchronizeTimer();
+  synchronizePpu();
+
+  // Handle due events
+  while (_events.empty() == false && _events.top().cycles <= _cycles)
+  {
+    Schedule  event = _events.top();
+
+    _events.pop();
+
+    // Skip outdated entries
+    if (_eventCycles[event.event] != event.cycles)
+      continue;
+
+    _eventCycles[event.event] = GBC::GameBoyColor::EventNever;
+
+    switch (event.event)
+    {
+    case Event::EventSerial:
+      simulateSerial();
+      break;
+
+      // Timer and PPU are already up to date, end of frame is handled by execution loop
+    default:
+      break;
+    }
+  }
+}
+
+void  GBC::GameBoyColor::simulatePost()
+{
+  GBC::Profile::Scope scope(_profile, GBC::Profile::Subsystem::SubsystemOther);
+
+  // Update audio for one frame
+  // NOTE: we could do this every CPU cycles,
+  // but we don't need that much precision
+  {
+    GBC::Profile::Scope audio(_profile, GBC::Profile::Subsystem::SubsystemApu);
+
+    _apu.simulate();
+  }
+  if (_profile.enabled == true) {
+    _profile.samples += _apu.sound().size();
+    _profile.frames += 1;
+  }
+
+  // Update MBC clock
+  // NOTE: we could do this every CPU cycles,
+  // but we don't need that much precision
+  _mbc->update(GBC::PixelProcessingUnit::FrameDuration);
+}
+
+void  GBC::GameBoyColor::simulateKeys()
+{
+  std::array<bool, Key::KeyCount> keys = { false };
+
+  // Keys from injected source
+  if (_input)
+    keys = _input(_cycles / GBC::PixelProcessingUnit::FrameDuration);
+
+  // Keys from keyboard bindings
+  else if (_headless == false) {
+    const auto& keyboard = Game::Window::Instance().keyboard();
+
+    keys = {
+      keyboard.keyDown(_bindings[GBC::GameBoyColor::Key::KeyDown]),
+      keyboard.keyDown(_bindings[GBC::GameBoyColor::Key::KeyUp]),
+      keyboard.keyDown(_bindings[GBC::GameBoyColor::Key::KeyLeft]),
+      keyboard.keyDown(_bindings[GBC::GameBoyColor::Key::KeyRight]),
+      keyboard.keyDown(_bindings[GBC::GameBoyColor::Key::KeyStart]),
+      keyboard.keyDown(_bindings[GBC::GameBoyColor::Key::KeySelect]),
+      keyboard.keyDown(_bindings[GBC::GameBoyColor::Key::KeyB]),
+      keyboard.keyDown(_bindings[GBC::GameBoyColor::Key::KeyA])
+    };
+  }
+
+  // Joypad interrupt when a selected key is pressed
+  if ((!(_io[IO::JOYP] & 0b00010000) &&
+    (_keys[Key::KeyDown] == false && keys[Key::KeyDown] == true ||
+      _keys[Key::KeyUp] == false && keys[Key::KeyUp] == true ||
+      _keys[Key::KeyLeft] == false && keys[Key::KeyLeft] == true ||
+      _keys[Key::KeyRight] == false && keys[Key::KeyRight] == true))
+    ||
+    (!(_io[IO::JOYP] & 0b00100000) &&
+      (_keys[Key::KeyStart] == false && keys[Key::KeyStart] == true ||
+        _keys[Key::KeySelect] == false && keys[Key::KeySelect] == true ||
+        _keys[Key::KeyB] == false && keys[Key::KeyB] == true ||
+        _keys[Key::KeyA] == false && keys[Key::KeyA] == true)))
+    _io[IO::IF] |= Interrupt::InterruptJoypad;
+
+  // Save new key map
+  _keys = keys;
+}
+
+void  GBC::GameBoyColor::synchronizeTimer()
+{
+  const std::array<std::size_t, 4>  modulo = { 1024, 16, 64, 256 };
+
+  std::size_t speed = (_io[IO::KEY1] & 0b10000000) ? 2 : 4;
+  std::size_t ticks = (_cycles - _timerCycles) / speed;
+  std::size_t div = ((std::size_t)_io[IO::DIVHi] << 8) + (std::size_t)_io[IO::DIVLo];
+
+  _timerCycles += ticks * speed;
+
+  // DIV is incremented by 4 each CPU tick
+  std::size_t end = div + ticks * 4;
+
+  // Update DIV timer
+  _io[IO::DIVHi] = (end >> 8) & 0b11111111;
+  _io[IO::DIVLo] = end & 0b11111111;
+
+  // Timer disabled, no overflow to schedule
+  if (!(_io[IO::TAC] & 0b00000100)) {
+    schedule(Event::EventTimer, GBC::GameBoyColor::EventNever);
+    return;
+  }
+
+  std::size_t period = modulo[_io[IO::TAC] & 0b11];
+
+  // TIMA is incremented each time DIV reaches a multiple of the period
+  std::size_t increments = end / period - div / period;
+  std::size_t overflow = 256 - _io[IO::TIMA];
+
+  // Tick the timer
+  if (increments < overflow)
+    _io[IO::TIMA] += (std::uint8_t)increments;
+
+  // Interrupt when overflow, reset timer as many times as needed
+  else {
+    _io[IO::IF] |= Interrupt::InterruptTimer;
+    _io[IO::TIMA] = _io[IO::TMA] + (std::uint8_t)((increments - overflow) % (256 - _io[IO::TMA]));
+  }
+
+  // Schedule next overflow
+  schedule(Event::EventTimer, _timerCycles + ((256 - _io[IO::TIMA]) * period - end % period) / 4 * speed);
+}
+
+void  GBC::GameBoyColor::synchronizePpu()
+{
+  std::size_t next;
+
+  // Update PPU, only timed when there is something to simulate
+  if (_cycles != _ppuCycles) {
+    GBC::Profile::Scope scope(_profile, GBC::Profile::Subsystem::SubsystemPpu);
+
+    // PPU mode only changes on PPU events, so elapsed cycles were all spent in current mode
+    if (_profile.enabled == true)
+      _profile.modes[_io[GBC::PixelProcessingUnit::IO::STAT] & GBC::PixelProcessingUnit::LcdStatus::LcdStatusModeMask] += _cycles - _ppuCycles;
+
+    _ppu.simulate(_cycles - _ppuCycles);
+    _ppuCycles = _cycles;
+  }
+
+  // Schedule next mode or line change
+  next = _ppu.next();
+  schedule(Event::EventPpu, (next == std::numeric_limits<std::size_t>::max()) ? GBC::GameBoyColor::EventNever : _cycles + next);
+}
+
+void  GBC::GameBoyColor::switchSpeed()
+{
+  // Update timer with current speed
+  synchronizeTimer();
+
+  // Switch speed and reset prepare bit
+  _io[IO::KEY1] ^= 0b10000001;
+
+  // Reschedule timer overflow with new speed
+  synchronizeTimer();
+}
+
+std::size_t GBC::GameBoyColor::cycles() const
+{
+  // Get cycle count
+  return _cycles;
+}
+
+const sf::Texture& GBC::GameBoyColor::lcd() const
+{
+  // Get rendering target from PPU
+  return _ppu.lcd();
+}
+
+const std::array<std::int16_t, GBC::AudioProcessingUnit::BufferSize>& GBC::GameBoyColor::sound() const
+{
+  // Get current sound buffer
+  return _apu.sound();
+}
+
+const GBC::GameBoyColor::Header& GBC::GameBoyColor::header() const
+{
+  // Get cartridge header
+  return _header;
+}
+
+const std::string&  GBC::GameBoyColor::serial() const
+{
+  // Get bytes sent through serial port
+  return _serial;
+}
+
+void  GBC::GameBoyColor::input(const GBC::GameBoyColor::Input& input)
+{
+  // Set source of pressed keys
+  _input = input;
+}
+
+std::uint64_t GBC::GameBoyColor::framebuffer() const
+{
+  std::uint64_t hash = 14695981039346656037ULL;
+
+  // FNV-1a hash of last frame
+  for (std::uint8_t pixel : _ppu.pixels())
+    hash = (hash ^ pixel) * 1099511628211ULL;
+
+  return hash;
+}
+
+GBC::CentralProcessingUnit::Mode  GBC::GameBoyColor::mode() const
+{
+  // Get CPU execution mode
+  return _cpu.mode();
+}
+
+void  GBC::GameBoyColor::mode(GBC::CentralProcessingUnit::Mode mode)
+{
+  // Set CPU execution mode
+  _cpu.mode(mode);
+}
+
+GBC::PixelProcessingUnit::Renderer  GBC::GameBoyColor::renderer() const
+{
+  // Get PPU rendering method
+  return _ppu.renderer();
+}
+
+void  GBC::GameBoyColor::renderer(GBC::PixelProcessingUnit::Renderer renderer)
+{
+  // Set PPU rendering method, end of mode 3 might change
+  synchronizePpu();
+  _ppu.renderer(renderer);
+  synchronizePpu();
+}
+
+bool  GBC::GameBoyColor::skip() const
+{
+  // Get PPU frame-skip request
+  return _ppu.skip();
+}
+
+void  GBC::GameBoyColor::skip(bool skip)
+{
+  // Set PPU frame-skip request, applied at next VBlank
+  _ppu.skip(skip);
+}
+
+const GBC::Profile& GBC::GameBoyColor::profile() const
+{
+  // Get per-subsystem counters and timings
+  return _profile;
+}
+
+void  GBC::GameBoyColor::profile(bool enable)
+{
+  // Restart collection from zero
+  _profile.reset(enable);
+}
+
+std::size_t GBC::GameBoyColor::emulated() const
+{
+  // Get number of frames emulated by PPU
+  return _ppu.emulated();
+}
+
+std::size_t GBC::GameBoyColor::presented() const
+{
+  // Get number of frames sent to rendering target
+  return _ppu.presented();
+}
+
+Game::Window::Key GBC::GameBoyColor::bind(GBC::GameBoyColor::Key key) const
+{
+  // Get key binding
+  return _bindings.at(key);
+}
+
+void  GBC::GameBoyColor::bind(GBC::GameBoyColor::Key key, Game::Window::Key bind)
+{
+  // Bind a new key
+  _bindings.at(key) = bind;
+}
+
+void  GBC::GameBoyColor::load(std::size_t id)
+{
+  std::filesystem::path     path(std::filesystem::path(_path).replace_extension(".gbs").concat("." + std::to_string(id)));
+  std::vector<std::uint8_t> buffer;
+
+  // Read whole save state
+  try {
+    loadFile(path, buffer);
+  }
+  catch (const std::exception&) {
+    std::cerr << "[GBC::GameBoyColor::load] Warning, failed to load '" << path << "' save state." << std::endl;
+    return;
+  }
+
+  std::vector<std::uint8_t> backup;
+
+  // Keep current state, restored if save state is rejected while loading
+  save(backup);
+
+  try {
+    loadState(buffer);
+  }
+  catch (const std::exception&) {
+    std::cerr << "[GBC::GameBoyColor::load] Warning, invalid save state '" << path << "', current state kept." << std::endl;
+    load(backup);
+  }
+}
+
+void  GBC::GameBoyColor::loadState(std::span<const std::uint8_t> buffer)
+{
+  // Binary snapshot
+  if (buffer.size() >= GBC::SaveState::Magic.size() && std::string_view((const char*)buffer.data(), GBC::SaveState::Magic.size()) == GBC::SaveState::Magic) {
+    load(buffer);
+    return;
+  }
+
+  GBC::LoadState  state{ GBC::SaveState::Format::FormatText, buffer, 0, {} };
+
+  // Index text variables once, loading is then linear in number of variables
+  for (std::string_view text((const char*)buffer.data(), buffer.size()); text.empty() == false;) {
+    std::string_view  line = text.substr(0, text.find('\n'));
+    auto              varSeparator = line.find('=');
+
+    // Next line
+    text.remove_prefix(std::min(line.size() + 1, text.size()));
+
+    // Ignore carriage return of Windows files
+    if (line.empty() == false && line.back() == '\r')
+      line.remove_suffix(1);
+
+    // Invalid format
+    if (varSeparator == std::string_view::npos)
+      continue;
+
+    // Keep first occurrence of variable
+    state.variables.emplace(line.substr(0, varSeparator), line.substr(varSeparator + 1));
+  }
+
+  // Load state from text export
+  load(state);
+}
+
+void  GBC::GameBoyColor::save(std::size_t id, GBC::SaveState::Format format) const
+{
+  std::filesystem::path     path(std::filesystem::path(_path).replace_extension(".gbs").concat("." + std::to_string(id)));
+  std::ofstream             file(path, std::ofstream::binary | std::ofstream::trunc);
+  std::vector<std::uint8_t> buffer;
+  GBC::SaveState            state{ format, buffer };
+
+  // Check valid file
+  if (file.good() == false) {
+    std::cerr << "[GBC::GameBoyColor::save] Warning, failed to save state to '" << path << "'." << std::endl;
+    return;
+  }
+
+  // Serialize state and write it to file
+  save(state);
+  file.write((const char*)buffer.data(), buffer.size());
+}
+
+void  GBC::GameBoyColor::load(std::span<const std::uint8_t> snapshot)
+{
+  GBC::LoadState  state{ GBC::SaveState::Format::FormatBinary, snapshot, 0, {} };
+  std::uint32_t   version = 0;
+
+  // Check signature
+  if (snapshot.size() < GBC::SaveState::Magic.size() + sizeof(version) || std::string_view((const char*)snapshot.data(), GBC::SaveState::Magic.size()) != GBC::SaveState::Magic) {
+    std::cerr << "[GBC::GameBoyColor::load] Warning, invalid save state." << std::endl;
+    return;
+  }
+
+  // Check version
+  std::memcpy(&version, snapshot.data() + GBC::SaveState::Magic.size(), sizeof(version));
+  if (version != GBC::SaveState::Version) {
+    std::cerr << "[GBC::GameBoyColor::load] Warning, unsupported save state version " << version << "." << std::endl;
+    return;
+  }
+
+  // Variables start after header
+  state.offset = GBC::SaveState::Magic.size() + sizeof(version);
+
+  // Load state from binary snapshot
+  load(state);
+}
+
+void  GBC::GameBoyColor::save(std::vector<std::uint8_t>& snapshot) const
+{
+  GBC::SaveState  state{ GBC::SaveState::Format::FormatBinary, snapshot };
+
+  // Reuse snapshot memory
+  snapshot.clear();
+
+  // Serialize state
+  save(state);
+}
+
+void  GBC::GameBoyColor::load(GBC::LoadState& state)
+{
+  std::size_t                                 serial = GBC::GameBoyColor::EventNever;
+  const std::array<std::uint8_t, 32 * 1024>   wRam = _wRam;
+  const std::array<std::uint8_t, 127>         hRam = _hRam;
+
+  // Load GBC variables
+  load(state, "GBC_CYCLES", _cycles);
+  load(state, "GBC_WRAM", _wRam);
+  load(state, "GBC_IO", _io);
+  load(state, "GBC_HRAM", _hRam);
+  load(state, "GBC_IE", _ie);
+  load(state, "GBC_KEYS", _keys);
+  load(state, "GBC_TRANSFERMODE", _transferMode);
+  load(state, "GBC_TRANSFERINDEX", _transferIndex);
+  load(state, "GBC_TRANSFERTRIGGER", _transferTrigger);
+
+  // Missing in text states older than event scheduler, no serial transfer pending
+  if (loadExists(state, "GBC_SERIAL") == true)
+    load(state, "GBC_SERIAL", serial);
+
+  // Load hardware state
+  _cpu.load(state);
+  _apu.load(state);
+  _ppu.load(state);
+  _mbc->load(state);
+
+  // Map loaded banks
+  updatePages();
+
+  // Invalidate decoded instructions of memory changed by state, ROM never changes
+  for (std::size_t index = 0; index < _wRam.size(); index++)
+    if (_wRam[index] != wRam[index])
+      _cpu.invalidateWRam(index);
+  for (std::size_t index = 0; index < _hRam.size(); index++)
+    if (_hRam[index] != hRam[index])
+      _cpu.invalidateHRam(index);
+
+  // Rebuild event scheduler, components are up to date in save state
+  _events = {};
+  _eventCycles.fill(GBC::GameBoyColor::EventNever);
+  _timerCycles = _cycles;
+  _ppuCycles = _cycles;
+  schedule(Event::EventSerial, serial);
+  synchronize();
 }
 
-void  GBC::GameBoyColor::simulatePre()
+void  GBC::GameBoyColor::save(GBC::SaveState& state) const
 {
-  // Simulate Joypad
-  simulateKeys();
+  // Binary header
+  if (state.format == GBC::SaveState::Format::FormatBinary) {
+    state.buffer.insert(state.buffer.end(), GBC::SaveState::Magic.begin(), GBC::SaveState::Magic.end());
+    state.buffer.insert(state.buffer.end(), (const std::uint8_t*)&GBC::SaveState::Version, (const std::uint8_t*)&GBC::SaveState::Version + sizeof(GBC::SaveState::Version));
+  }
+
+  // Save GBC variables
+  save(state, "GBC_CYCLES", _cycles);
+  save(state, "GBC_WRAM", _wRam);
+  save(state, "GBC_IO", _io);
+  save(state, "GBC_HRAM", _hRam);
+  save(state, "GBC_IE", _ie);
+  save(state, "GBC_KEYS", _keys);
+  save(state, "GBC_TRANSFERMODE", _transferMode);
+  save(state, "GBC_TRANSFERINDEX", _transferIndex);
+  save(state, "GBC_TRANSFERTRIGGER", _transferTrigger);
+  save(state, "GBC_SERIAL", _eventCycles[Event::EventSerial]);
+
+  // Save hardware state
+  _cpu.save(state);
+  _apu.save(state);
+  _ppu.save(state);
+  _mbc->save(state);
 }
 
-void  GBC::GameBoyColor::simulateCycle()
+void  GBC::GameBoyColor::benchmark(const std::filesystem::path& filename, std::size_t frames)
 {
-  std::uint64_t cycles = _cycles;
+  double  reference = 0.;
 
-  // Simulate CPU
-  switch (_transferMode)
+  const std::array<std::tuple<GBC::CentralProcessingUnit::Mode, GBC::PixelProcessingUnit::Renderer, bool>, 4> configurations = {
+    std::tuple{ GBC::CentralProcessingUnit::Mode::ModeAccurate, GBC::PixelProcessingUnit::Renderer::RendererFifo, false },
+    std::tuple{ GBC::CentralProcessingUnit::Mode::ModeAccurate, GBC::PixelProcessingUnit::Renderer::RendererScanline, false },
+    std::tuple{ GBC::CentralProcessingUnit::Mode::ModeFast, GBC::PixelProcessingUnit::Renderer::RendererScanline, false },
+    std::tuple{ GBC::CentralProcessingUnit::Mode::ModeFast, GBC::PixelProcessingUnit::Renderer::RendererScanline, true }
+  };
+
+  // Simulate the same ROM from boot in each CPU mode and PPU renderer, with or without pixel output
+  for (const auto& [mode, renderer, skip] : configurations)
   {
-    // Simulate a tick of the CPU
-  case Transfer::TransferNone:
-    _cpu.simulate();
-    _cycles += (_io[IO::KEY1] & 0b10000000) ? 2 : 4;
-    break;
+    std::unique_ptr<GBC::GameBoyColor>  gbc = std::make_unique<GBC::GameBoyColor>(filename);
 
-    // DMA transfer
-  case Transfer::TransferDma:
-    // Transfer 4 bytes to OAM
-    for (std::uint16_t index = 0; index < 4; index++)
-      _ppu.writeDma((std::uint16_t)_transferIndex + index, read(((std::uint16_t)_io[IO::DMA] << 8) + (std::uint16_t)_transferIndex + index));
-    _transferIndex += 4;
+    gbc->mode(mode);
+    gbc->renderer(renderer);
+    gbc->skip(skip);
 
-    // Simulate a tick of the CPU
-    _cpu.simulate();
-    _cycles += (_io[IO::KEY1] & 0b10000000) ? 2 : 4;
+    auto  start = std::chrono::steady_clock::now();
 
-    // End of DMA transfer
-    if (_transferIndex == 160)
-      _transferMode = Transfer::TransferNone;
+    // Simulate frames as fast as possible
+    for (std::size_t frame = 0; frame < frames; frame++)
+      gbc->simulate();
 
-    // TODO: restrict memory access to HRAM during DMA transfer
-    break;
+    auto  duration = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    auto  fps = (duration > 0.) ? frames / duration : 0.;
 
-    // General purpose DMA
-  case Transfer::TransferHdma0:
+    // Keep first configuration as reference
+    if (reference == 0.)
+      reference = fps;
+
+    // Report emulation throughput
+    std::cout
+      << "[GBC::GameBoyColor] " << filename.filename().string() << ": "
+      << ((mode == GBC::CentralProcessingUnit::Mode::ModeAccurate) ? "accurate" : "fast") << " mode, "
+      << ((renderer == GBC::PixelProcessingUnit::Renderer::RendererFifo) ? "fifo" : "scanline") << " renderer, "
+      << ((skip == true) ? "frame-skip, " : "")
+      << frames << " frames in " << duration << "s, "
+      << fps << " fps (x" << ((reference > 0.) ? fps / reference : 0.) << ")." << std::endl;
+  }
+
+  // Run-ahead, each displayed frame simulates extra frames then restores state
+  for (std::size_t ahead = 1; ahead <= 3; ahead++)
   {
-    std::uint16_t source = ((((std::uint16_t)_io[IO::HDMA1] << 8) + (std::uint16_t)_io[IO::HDMA2]) & 0b1111111111110000) + (std::uint16_t)_transferIndex;
-    std::uint16_t destination = (((((std::uint16_t)_io[IO::HDMA3] << 8) + (std::uint16_t)_io[IO::HDMA4]) & 0b0001111111110000) | 0b1000000000000000) + (std::uint16_t)_transferIndex;
-    bool          end = false;
+    std::unique_ptr<GBC::GameBoyColor>  gbc = std::make_unique<GBC::GameBoyColor>(filename);
+    double                              snapshot = 0.;
 
-    // Transfer 8 bytes per tick
-    for (std::size_t index = 0; index < 8 && end == false; index++)
-    {
-      // Check transfer adress
-      if (((source >= 0x0000 && source < 0x8000) ||
-        (source >= 0xA000 && source < 0xC000) ||
-        (source >= 0xC000 && source < 0xE000)) &&
-        (destination >= 0x8000 && destination < 0xA000))
-        _ppu.writeRam(destination - 0x8000, read(source));
-      else {
-        end = true;
-        break;
-      }
+    gbc->mode(GBC::CentralProcessingUnit::Mode::ModeFast);
+    gbc->renderer(GBC::PixelProcessingUnit::Renderer::RendererScanline);
 
-      source += 1;
-      destination += 1;
-    }
+    auto  start = std::chrono::steady_clock::now();
 
-    // Increment transfer index
-    _transferIndex += 8;
+    for (std::size_t frame = 0; frame < frames; frame++) {
+      gbc->simulate();
+      gbc->simulateAhead(ahead);
 
-    // End of HDMA transfer
-    if (_transferIndex == ((std::size_t)_io[IO::HDMA5] + 1) * 0x10 || end == true) {
-      _transferMode = Transfer::TransferNone;
-      _io[IO::HDMA5] = 0xFF;
+      auto  snapshotStart = std::chrono::steady_clock::now();
 
-      // Increment source and destination
-      _io[IO::HDMA1] = (source >> 8) & 0b11111111;
-      _io[IO::HDMA2] = (source >> 0) & 0b11111111;
-      _io[IO::HDMA3] = (destination >> 8) & 0b11111111;
-      _io[IO::HDMA4] = (destination >> 0) & 0b11111111;
+      // Measure snapshot and restore alone
+      gbc->save(gbc->_ahead);
+      gbc->load(gbc->_ahead);
+      snapshot += std::chrono::duration<double>(std::chrono::steady_clock::now() - snapshotStart).count();
     }
 
-    // CPU is not executed
-    _cycles += 4;
-    break;
+    auto  duration = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() - snapshot;
+    auto  fps = (duration > 0.) ? frames / duration : 0.;
+
+    // Report displayed frames throughput, compared to real-time
+    std::cout
+      << "[GBC::GameBoyColor] " << filename.filename().string() << ": "
+      << "run-ahead " << ahead << ", " << frames << " frames in " << duration << "s, "
+      << fps << " fps (x" << fps * GBC::PixelProcessingUnit::FrameDuration / GBC::CentralProcessingUnit::Frequency << " real-time), "
+      << ((frames > 0) ? snapshot / frames * 1000000. : 0.) << "us per snapshot and restore." << std::endl;
   }
 
-  case Transfer::TransferHdma1:
+  // Audio synthesis alone, from state reached after simulated frames
   {
-    bool trigger = (_io[GBC::PixelProcessingUnit::IO::STAT] & GBC::PixelProcessingUnit::LcdStatus::LcdStatusModeMask) == GBC::PixelProcessingUnit::LcdMode::LcdMode0;
+    std::unique_ptr<GBC::GameBoyColor>  gbc = std::make_unique<GBC::GameBoyColor>(filename);
 
-    // Trigger when entering mode 0
-    if (_transferTrigger == false && trigger == true)
-      _transferIndex = 16;
+    for (std::size_t frame = 0; frame < frames; frame++)
+      gbc->simulate();
 
-    // Save current mode
-    _transferTrigger = trigger;
+    auto  start = std::chrono::steady_clock::now();
 
-    // HDMA Transfer at start of HBlank
-    if (_transferIndex > 0)
-    {
-      std::uint16_t source = ((((std::uint16_t)_io[IO::HDMA1] << 8) + (std::uint16_t)_io[IO::HDMA2]) & 0b1111111111110000) + (std::uint16_t)(16 - _transferIndex);
-      std::uint16_t destination = (((((std::uint16_t)_io[IO::HDMA3] << 8) + (std::uint16_t)_io[IO::HDMA4]) & 0b00011111111110000) | 0b1000000000000000) + (std::uint16_t)(16 - _transferIndex);
-      bool          end = false;
+    for (std::size_t frame = 0; frame < frames; frame++)
+      gbc->_apu.simulate();
 
-      // Transfer 8 bytes per tick
-      for (std::size_t index = 0; index < 8 && end == false; index++)
-      {
-        // Check transfer adress
-        if (((source >= 0x0000 && source < 0x8000) ||
-          (source >= 0xA000 && source < 0xC000) ||
-          (source >= 0xC000 && source < 0xE000)) &&
-          (destination >= 0x8000 && destination < 0xA000))
-          _ppu.writeRam(destination - 0x8000, read(source));
-        else
-          end = true;
-
-        source += 1;
-        destination += 1;
-      }
+    auto  duration = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
 
-      // Update transfer index
-      _transferIndex -= 8;
+    // Report audio cost per frame
+    std::cout
+      << "[GBC::GameBoyColor] " << filename.filename().string() << ": audio, "
+      << frames << " frames in " << duration << "s, "
+      << ((frames > 0) ? duration / frames * 1000000. : 0.) << "us per frame." << std::endl;
+  }
+}
 
-      // End of data chunk transfer
-      if (_transferIndex == 0) {
-        _io[IO::HDMA5] -= 1;
+bool  GBC::GameBoyColor::headless(const std::filesystem::path& filename, std::size_t frames, GBC::CentralProcessingUnit::Mode mode, bool profile)
+{
+  std::unique_ptr<GBC::GameBoyColor>  gbc = std::make_unique<GBC::GameBoyColor>(filename);
+  GBC::GameBoyColor::Result           result = GBC::GameBoyColor::Result::ResultNone;
+  std::size_t                         frame = 0;
 
-        // Increment source and destination
-        _io[IO::HDMA1] = (source >> 8) & 0b11111111;
-        _io[IO::HDMA2] = (source >> 0) & 0b11111111;
-        _io[IO::HDMA3] = (destination >> 8) & 0b11111111;
-        _io[IO::HDMA4] = (destination >> 0) & 0b11111111;
-      }
+  gbc->mode(mode);
+  gbc->profile(profile);
 
-      // End of HDMA transfer
-      if (_io[IO::HDMA5] == 0xFF || end == true) {
-        _transferMode = Transfer::TransferNone;
-        _io[IO::HDMA5] = 0xFF;
-      }
+  auto  start = std::chrono::steady_clock::now();
 
-      // CPU is not executed
-      _cycles += 4;
-    }
+  // Simulate frames as fast as possible, until test ROM reports a result
+  while (frame < frames && result == GBC::GameBoyColor::Result::ResultNone) {
+    gbc->simulate();
+    result = gbc->result();
+    frame++;
+  }
 
-    // Simulate CPU when no transfer
-    else {
-      _cpu.simulate();
-      _cycles += (_io[IO::KEY1] & 0b10000000) ? 2 : 4;
-    }
+  auto  duration = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  auto  fps = (duration > 0.) ? frame / duration : 0.;
 
-    break;
-  }
+  // Report result, throughput and framebuffer
+  std::cout
+    << "[GBC::GameBoyColor] " << filename.filename().string() << ": "
+    << ((result == GBC::GameBoyColor::Result::ResultPassed) ? "passed" : ((result == GBC::GameBoyColor::Result::ResultFailed) ? "failed" : "no result")) << " after "
+    << frame << " frames in " << duration << "s, "
+    << fps << " fps, framebuffer " << std::hex << gbc->framebuffer() << std::dec << "." << std::endl;
 
-  default:
-    throw std::runtime_error((std::string(__FILE__) + ": l." + std::to_string(__LINE__)).c_str());
-  }
+  // Report per-frame profile, throughput above includes its overhead
+  if (profile == true)
+    std::cout << gbc->_profile.report(GBC::Profile());
 
-  // Update timer
-  simulateTimer();
+  // Report serial output
+  if (gbc->_serial.empty() == false)
+    std::cout << gbc->_serial << std::endl;
 
-  // Update Pixel Processing Unit
-  for (; cycles < _cycles; cycles += 1)
-    _ppu.simulate();
+  return result != GBC::GameBoyColor::Result::ResultFailed;
 }
 
-void  GBC::GameBoyColor::simulatePost()
+bool  GBC::GameBoyColor::link(const std::filesystem::path& first, const std::filesystem::path& second, std::size_t frames)
 {
-  // Update audio for one frame
-  // NOTE: we could do this every CPU cycles,
-  // but we don't need that much precision
-  _apu.simulate();
+  std::unique_ptr<GBC::GameBoyColor>  gbc1 = std::make_unique<GBC::GameBoyColor>(first);
+  std::unique_ptr<GBC::GameBoyColor>  gbc2 = std::make_unique<GBC::GameBoyColor>(second);
 
-  // Update MBC clock
-  // NOTE: we could do this every CPU cycles,
-  // but we don't need that much precision
-  _mbc->update(GBC::PixelProcessingUnit::FrameDuration);
+  gbc1->mode(GBC::CentralProcessingUnit::Mode::ModeFast);
+  gbc1->renderer(GBC::PixelProcessingUnit::Renderer::RendererScanline);
+  gbc2->mode(GBC::CentralProcessingUnit::Mode::ModeFast);
+  gbc2->renderer(GBC::PixelProcessingUnit::Renderer::RendererScanline);
+
+  // Reference throughput, both emulators unlinked
+  auto  start = std::chrono::steady_clock::now();
+
+  for (std::size_t frame = 0; frame < frames; frame++) {
+    gbc1->simulate();
+    gbc2->simulate();
+  }
+
+  auto  reference = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  // Fresh emulators connected through link cable
+  gbc1 = std::make_unique<GBC::GameBoyColor>(first);
+  gbc2 = std::make_unique<GBC::GameBoyColor>(second);
+  gbc1->mode(GBC::CentralProcessingUnit::Mode::ModeFast);
+  gbc1->renderer(GBC::PixelProcessingUnit::Renderer::RendererScanline);
+  gbc2->mode(GBC::CentralProcessingUnit::Mode::ModeFast);
+  gbc2->renderer(GBC::PixelProcessingUnit::Renderer::RendererScanline);
+  gbc1->link(*gbc2);
+
+  start = std::chrono::steady_clock::now();
+
+  // Second emulator runs first, so it is a slice ahead when first one starts a transfer
+  for (std::size_t frame = 0; frame < frames; frame++)
+    gbc2->simulateLink();
+
+  auto  duration = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  // Report throughput of frame pairs, link overhead and framebuffers
+  std::cout
+    << "[GBC::GameBoyColor] Link: " << first.filename().string() << " <-> " << second.filename().string() << ", "
+    << frames << " frames in " << duration << "s, "
+    << ((duration > 0.) ? frames / duration : 0.) << " fps (" << ((reference > 0.) ? frames / reference : 0.) << " fps unlinked), "
+    << gbc1->_linkBytes << " bytes exchanged, framebuffers " << std::hex << gbc1->framebuffer() << " " << gbc2->framebuffer() << std::dec << ", "
+    << std::max(gbc1->_linkSkew, gbc2->_linkSkew) << " cycles max transfer skew." << std::endl;
+
+  // Linked emulator should receive bytes and interrupt within an instruction of end of transfer
+  return std::max(gbc1->_linkSkew, gbc2->_linkSkew) <= GBC::GameBoyColor::LinkSkew;
 }
 
-void  GBC::GameBoyColor::simulateKeys()
+void  GBC::GameBoyColor::batch(const std::filesystem::path& filename, std::size_t frames)
 {
-  const auto& keyboard = Game::Window::Instance().keyboard();
-  std::array<bool, Key::KeyCount> keys = {
-    keyboard.keyDown(_bindings[GBC::GameBoyColor::Key::KeyDown]),
-    keyboard.keyDown(_bindings[GBC::GameBoyColor::Key::KeyUp]),
-    keyboard.keyDown(_bindings[GBC::GameBoyColor::Key::KeyLeft]),
-    keyboard.keyDown(_bindings[GBC::GameBoyColor::Key::KeyRight]),
-    keyboard.keyDown(_bindings[GBC::GameBoyColor::Key::KeyStart]),
-    keyboard.keyDown(_bindings[GBC::GameBoyColor::Key::KeySelect]),
-    keyboard.keyDown(_bindings[GBC::GameBoyColor::Key::KeyB]),
-    keyboard.keyDown(_bindings[GBC::GameBoyColor::Key::KeyA])
+  struct Run
+  {
+    std::filesystem::path rom;        // ROM to simulate
+    std::filesystem::path script;     // Input script, empty for no input
+    double                duration;   // Simulation time (seconds)
+    std::uint64_t         hash;       // Framebuffer hash after last frame
+    std::string           error;      // Error message, empty if simulation succeeded
   };
 
-  // Joypad interrupt when a selected key is pressed
-  if ((!(_io[IO::JOYP] & 0b00010000) &&
-    (_keys[Key::KeyDown] == false && keys[Key::KeyDown] == true ||
-      _keys[Key::KeyUp] == false && keys[Key::KeyUp] == true ||
-      _keys[Key::KeyLeft] == false && keys[Key::KeyLeft] == true ||
-      _keys[Key::KeyRight] == false && keys[Key::KeyRight] == true))
-    ||
-    (!(_io[IO::JOYP] & 0b00100000) &&
-      (_keys[Key::KeyStart] == false && keys[Key::KeyStart] == true ||
-        _keys[Key::KeySelect] == false && keys[Key::KeySelect] == true ||
-        _keys[Key::KeyB] == false && keys[Key::KeyB] == true ||
-        _keys[Key::KeyA] == false && keys[Key::KeyA] == true)))
-    _io[IO::IF] |= Interrupt::InterruptJoypad;
+  std::vector<Run>  runs;
+  std::ifstream     file(filename);
+  std::string       line;
 
-  // Save new key map
-  _keys = keys;
-}
+  // List of ROMs, each line "<rom> [script]", paths relative to list file
+  if (file.good() == false)
+    throw std::runtime_error((std::string(__FILE__) + ": l." + std::to_string(__LINE__)).c_str());
+  while (std::getline(file, line)) {
+    std::istringstream  stream(line);
+    std::string         rom, script;
 
-void  GBC::GameBoyColor::simulateTimer()
-{
-  std::uint16_t div = ((std::uint16_t)_io[IO::DIVHi] << 8) + (std::uint16_t)_io[IO::DIVLo] + 4;
+    // Skip empty lines and comments
+    if (!(stream >> std::quoted(rom)) || rom.front() == '#')
+      continue;
+    stream >> std::quoted(script);
+
+    runs.push_back({
+      .rom = filename.parent_path() / rom,
+      .script = script.empty() ? std::filesystem::path() : filename.parent_path() / script,
+      .duration = 0.,
+      .hash = 0,
+      .error = ""
+      });
+  }
 
-  // Update DIV timer
-  _io[IO::DIVHi] = (div >> 8) & 0b11111111;
-  _io[IO::DIVLo] = div & 0b11111111;
+  std::atomic<std::size_t>  next = 0;
+  std::vector<std::thread>  threads;
 
-  // Update Timer only when enabled
-  if (_io[IO::TAC] & 0b00000100) {
-    const std::array<int, 4>  modulo = { 1024, 16, 64, 256 };
+  auto  start = std::chrono::steady_clock::now();
 
-    // Tick the timer
-    if (div % modulo[_io[IO::TAC] & 0b11] == 0) {
-      _io[IO::TIMA] += 1;
+  // One instance per core, each thread takes next run in list
+  for (std::size_t thread = 0; thread < std::min<std::size_t>(std::max(std::thread::hardware_concurrency(), 1u), runs.size()); thread++) {
+    threads.emplace_back([&runs, &next, frames]() {
+      for (std::size_t index = next++; index < runs.size(); index = next++) {
+        Run&  run = runs[index];
 
-      // Interrupt when overflow
-      if (_io[IO::TIMA] == 0) {
-        // Set interrupt flags
-        _io[IO::IF] |= Interrupt::InterruptTimer;
+        try {
+          std::unique_ptr<GBC::GameBoyColor>  gbc = std::make_unique<GBC::GameBoyColor>(run.rom);
 
-        // Reset timer
-        _io[IO::TIMA] = _io[IO::TMA];
+          gbc->mode(GBC::CentralProcessingUnit::Mode::ModeFast);
+          gbc->renderer(GBC::PixelProcessingUnit::Renderer::RendererScanline);
+          if (run.script.empty() == false)
+            gbc->input(GBC::GameBoyColor::script(run.script));
+
+          auto  runStart = std::chrono::steady_clock::now();
+
+          for (std::size_t frame = 0; frame < frames; frame++)
+            gbc->simulate();
+
+          run.duration = std::chrono::duration<double>(std::chrono::steady_clock::now() - runStart).count();
+          run.hash = gbc->framebuffer();
+        }
+        catch (const std::exception& exception) {
+          run.error = exception.what();
+        }
       }
+      });
+  }
+
+  // Wait for every run to complete
+  for (auto& thread : threads)
+    thread.join();
+
+  auto        duration = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  std::size_t completed = 0;
+
+  // Report each run in list order
+  for (const auto& run : runs) {
+    if (run.error.empty() == true) {
+      completed++;
+      std::cout
+        << "[GBC::GameBoyColor] " << run.rom.filename().string() << ": "
+        << frames << " frames in " << run.duration << "s, "
+        << ((run.duration > 0.) ? frames / run.duration : 0.) << " fps, framebuffer " << std::hex << run.hash << std::dec << "." << std::endl;
     }
+    else
+      std::cerr << "[GBC::GameBoyColor] " << run.rom.filename().string() << ": error, " << run.error << "." << std::endl;
   }
-}
 
-std::size_t GBC::GameBoyColor::cycles() const
-{
-  // Get cycle count
-  return _cycles;
+  // Report aggregate throughput
+  std::cout
+    << "[GBC::GameBoyColor] Batch: " << completed << "/" << runs.size() << " runs on " << threads.size() << " threads, "
+    << completed * frames << " frames in " << duration << "s, "
+    << ((duration > 0.) ? completed * frames / duration : 0.) << " fps." << std::endl;
 }
 
-const sf::Texture& GBC::GameBoyColor::lcd() const
+GBC::GameBoyColor::Input  GBC::GameBoyColor::script(const std::filesystem::path& filename)
 {
-  // Get rendering target from PPU
-  return _ppu.lcd();
-}
+  const std::unordered_map<std::string, GBC::GameBoyColor::Key> names = {
+    { "down", GBC::GameBoyColor::Key::KeyDown },
+    { "up", GBC::GameBoyColor::Key::KeyUp },
+    { "left", GBC::GameBoyColor::Key::KeyLeft },
+    { "right", GBC::GameBoyColor::Key::KeyRight },
+    { "start", GBC::GameBoyColor::Key::KeyStart },
+    { "select", GBC::GameBoyColor::Key::KeySelect },
+    { "b", GBC::GameBoyColor::Key::KeyB },
+    { "a", GBC::GameBoyColor::Key::KeyA }
+  };
 
-const std::array<std::int16_t, GBC::AudioProcessingUnit::BufferSize>& GBC::GameBoyColor::sound() const
-{
-  // Get current sound buffer
-  return _apu.sound();
-}
+  std::map<std::size_t, std::array<bool, GBC::GameBoyColor::Key::KeyCount>> steps;
+  std::ifstream                                                               file(filename);
+  std::string                                                                 line;
 
-const GBC::GameBoyColor::Header& GBC::GameBoyColor::header() const
-{
-  // Get cartridge header
-  return _header;
-}
+  // Each line is a frame number followed by keys held from that frame
+  if (file.good() == false)
+    throw std::runtime_error((std::string(__FILE__) + ": l." + std::to_string(__LINE__)).c_str());
+  while (std::getline(file, line)) {
+    std::istringstream                                  stream(line);
+    std::size_t                                         frame = 0;
+    std::array<bool, GBC::GameBoyColor::Key::KeyCount>  keys = { false };
 
-Game::Window::Key GBC::GameBoyColor::bind(GBC::GameBoyColor::Key key) const
-{
-  // Get key binding
-  return _bindings.at(key);
-}
+    // Skip empty lines and comments
+    if (!(stream >> frame))
+      continue;
 
-void  GBC::GameBoyColor::bind(GBC::GameBoyColor::Key key, Game::Window::Key bind)
-{
-  // Bind a new key
-  _bindings.at(key) = bind;
-}
+    for (std::string name; stream >> name;) {
+      auto  iterator = names.find(name);
 
-void  GBC::GameBoyColor::load(std::size_t id)
-{
-  std::filesystem::path path(std::filesystem::path(_path).replace_extension(".gbs").concat("." + std::to_string(id)));
-  std::ifstream         file(path);
+      // Unknown key name
+      if (iterator == names.end())
+        throw std::runtime_error((std::string(__FILE__) + ": l." + std::to_string(__LINE__)).c_str());
+      keys[iterator->second] = true;
+    }
 
-  // Check valid file
-  if (file.good() == false) {
-    std::cerr << "[GBC::GameBoyColor::load] Warning, failed to load '" << path << "' save state." << std::endl;
-    return;
+    steps[frame] = keys;
   }
 
-  // Load GBC variables
-  load(file, "GBC_CYCLES", _cycles);
-  load(file, "GBC_WRAM", _wRam);
-  load(file, "GBC_IO", _io);
-  load(file, "GBC_HRAM", _hRam);
-  load(file, "GBC_IE", _ie);
-  load(file, "GBC_KEYS", _keys);
-  load(file, "GBC_TRANSFERMODE", _transferMode);
-  load(file, "GBC_TRANSFERINDEX", _transferIndex);
-  load(file, "GBC_TRANSFERTRIGGER", _transferTrigger);
+  // Keys of last step at or before frame
+  return [steps](std::size_t frame) {
+    auto  iterator = steps.upper_bound(frame);
 
-  // Load hardware state
-  _cpu.load(file);
-  _apu.load(file);
-  _ppu.load(file);
-  _mbc->load(file);
+    return (iterator == steps.begin()) ? std::array<bool, GBC::GameBoyColor::Key::KeyCount>{ false } : std::prev(iterator)->second;
+    };
 }
 
-void  GBC::GameBoyColor::save(std::size_t id) const
+GBC::GameBoyColor::Result GBC::GameBoyColor::result()
 {
-  std::filesystem::path path(std::filesystem::path(_path).replace_extension(".gbs").concat("." + std::to_string(id)));
-  std::ofstream         file(path);
+  // Blargg, result printed to serial port
+  if (_serial.find("Passed") != std::string::npos)
+    return GBC::GameBoyColor::Result::ResultPassed;
+  if (_serial.find("Failed") != std::string::npos)
+    return GBC::GameBoyColor::Result::ResultFailed;
 
-  // Check valid file
-  if (file.good() == false) {
-    std::cerr << "[GBC::GameBoyColor::save] Warning, failed to save state to '" << path << "'." << std::endl;
-    return;
-  }
+  // Blargg, signature in external RAM followed by status code (0x80 while running)
+  if (read(0xA001) == 0xDE && read(0xA002) == 0xB0 && read(0xA003) == 0x61 && read(0xA000) != 0x80)
+    return (read(0xA000) == 0x00) ? GBC::GameBoyColor::Result::ResultPassed : GBC::GameBoyColor::Result::ResultFailed;
 
-  // Save GBC variables
-  save(file, "GBC_CYCLES", _cycles);
-  save(file, "GBC_WRAM", _wRam);
-  save(file, "GBC_IO", _io);
-  save(file, "GBC_HRAM", _hRam);
-  save(file, "GBC_IE", _ie);
-  save(file, "GBC_KEYS", _keys);
-  save(file, "GBC_TRANSFERMODE", _transferMode);
-  save(file, "GBC_TRANSFERINDEX", _transferIndex);
-  save(file, "GBC_TRANSFERTRIGGER", _transferTrigger);
+  auto  registers = _cpu.registers();
 
-  // Save hardware state
-  _cpu.save(file);
-  _apu.save(file);
-  _ppu.save(file);
-  _mbc->save(file);
+  // Mooneye, Fibonacci sequence in registers on success, 0x42 on failure
+  if (registers == std::array<std::uint8_t, 6>{ 3, 5, 8, 13, 21, 34 })
+    return GBC::GameBoyColor::Result::ResultPassed;
+  if (registers == std::array<std::uint8_t, 6>{ 0x42, 0x42, 0x42, 0x42, 0x42, 0x42 })
+    return GBC::GameBoyColor::Result::ResultFailed;
+
+  return GBC::GameBoyColor::Result::ResultNone;
 }
 
-void  GBC::GameBoyColor::save(std::ofstream& file, const std::string& name, const void* data, std::size_t size) const
+void  GBC::GameBoyColor::save(GBC::SaveState& state, std::string_view name, const void* data, std::size_t size) const
 {
+  // Binary snapshot, size followed by raw bytes
+  if (state.format == GBC::SaveState::Format::FormatBinary) {
+    std::uint32_t length = (std::uint32_t)size;
+
+    state.buffer.insert(state.buffer.end(), (const std::uint8_t*)&length, (const std::uint8_t*)&length + sizeof(length));
+    state.buffer.insert(state.buffer.end(), (const std::uint8_t*)data, (const std::uint8_t*)data + size);
+    return;
+  }
+
   // Variable name
-  file << name << "=";
+  state.buffer.insert(state.buffer.end(), name.begin(), name.end());
+  state.buffer.push_back('=');
 
   // Byte array
-  for (std::size_t index = 0; index < size; index++)
-    file << SaveStateBase[((const std::uint8_t*)data)[index] / SaveStateBase.length()] << SaveStateBase[((const std::uint8_t*)data)[index] % SaveStateBase.length()];
+  for (std::size_t index = 0; index < size; index++) {
+    state.buffer.push_back(SaveStateBase[((const std::uint8_t*)data)[index] / SaveStateBase.length()]);
+    state.buffer.push_back(SaveStateBase[((const std::uint8_t*)data)[index] % SaveStateBase.length()]);
+  }
 
   // End of line
-  file << std::endl;
+  state.buffer.push_back('\n');
 }
 
-void  GBC::GameBoyColor::save(std::ofstream& file, const std::string& name, const std::string& data) const
+void  GBC::GameBoyColor::save(GBC::SaveState& state, std::string_view name, const std::string& data) const
 {
   // Convert string to char vector
-  save(file, name, std::vector<char>(data.begin(), data.end()));
+  save(state, name, std::vector<char>(data.begin(), data.end()));
 }
 
-
-std::string GBC::GameBoyColor::loadVariable(std::ifstream& file, const std::string& name)
+std::string_view  GBC::GameBoyColor::loadVariable(GBC::LoadState& state, std::string_view name)
 {
-  // Go back to start of file
-  file.seekg(0, std::ios_base::beg);
+  // Binary snapshot, variables are stored in load order
+  if (state.format == GBC::SaveState::Format::FormatBinary) {
+    std::uint32_t length = 0;
 
-  std::string line;
+    // Truncated size
+    if (state.offset + sizeof(length) > state.buffer.size())
+      throw std::runtime_error((std::string(__FILE__) + ": l." + std::to_string(__LINE__)).c_str());
 
-  // Search for variable in file
-  while (std::getline(file, line))
-  {
-    auto varSeparator = line.find('=');
+    std::memcpy(&length, state.buffer.data() + state.offset, sizeof(length));
+    state.offset += sizeof(length);
 
-    // Invalid format
-    if (varSeparator == std::string::npos)
-      continue;
+    // Truncated data
+    if (state.offset + length > state.buffer.size())
+      throw std::runtime_error((std::string(__FILE__) + ": l." + std::to_string(__LINE__)).c_str());
 
-    std::string varName = line.substr(0, varSeparator);
-    std::string varValue = line.substr(varSeparator + 1);
+    std::string_view  value((const char*)state.buffer.data() + state.offset, length);
 
-    // Wrong variable
-    if (varName == name)
-      return varValue;
+    state.offset += length;
+    return value;
   }
 
+  auto  iterator = state.variables.find(name);
+
   // Variable not found
-  throw std::runtime_error((std::string(__FILE__) + ": l." + std::to_string(__LINE__)).c_str());
+  if (iterator == state.variables.end())
+    throw std::runtime_error((std::string(__FILE__) + ": l." + std::to_string(__LINE__)).c_str());
+
+  return iterator->second;
+}
+
+bool  GBC::GameBoyColor::loadExists(const GBC::LoadState& state, std::string_view name) const
+{
+  // Binary snapshots hold every variable of current version
+  return state.format == GBC::SaveState::Format::FormatBinary || state.variables.find(name) != state.variables.end();
+}
+
+std::size_t GBC::GameBoyColor::loadSize(const GBC::LoadState& state, std::string_view value) const
+{
+  // Raw bytes in binary snapshot, two characters per byte in text export
+  return (state.format == GBC::SaveState::Format::FormatBinary) ? value.size() : value.size() / 2;
 }
 
-void  GBC::GameBoyColor::loadValue(const std::string& value, void* data, std::size_t size)
+void  GBC::GameBoyColor::loadValue(const GBC::LoadState& state, std::string_view value, void* data, std::size_t size)
 {
+  // Binary snapshot, copy raw bytes
+  if (state.format == GBC::SaveState::Format::FormatBinary) {
+    // Invalid variable size
+    if (value.size() != size)
+      throw std::runtime_error((std::string(__FILE__) + ": l." + std::to_string(__LINE__)).c_str());
+
+    std::memcpy(data, value.data(), size);
+    return;
+  }
+
   // Invalid variable size
   if (value.length() % 2 != 0 || value.length() / 2 != size)
     throw std::runtime_error((std::string(__FILE__) + ": l." + std::to_string(__LINE__)).c_str());
@@ -778,12 +1769,12 @@ void  GBC::GameBoyColor::loadValue(const std::string& value, void* data, std::si
   }
 }
 
-void  GBC::GameBoyColor::load(std::ifstream& file, const std::string& name, std::string& data)
+void  GBC::GameBoyColor::load(GBC::LoadState& state, std::string_view name, std::string& data)
 {
   std::vector<char> raw;
 
   // Load variable as a vector of char
-  load(file, name, raw);
+  load(state, name, raw);
 
   // Convert vector to string
   data = std::string(raw.begin(), raw.end());
@@ -791,6 +1782,14 @@ void  GBC::GameBoyColor::load(std::ifstream& file, const std::string& name, std:
 
 std::uint8_t  GBC::GameBoyColor::read(std::uint16_t addr)
 {
+  // Count memory access by region
+  if (_profile.enabled == true)
+    _profile.reads[GBC::Profile::region(addr)]++;
+
+  // Directly mapped memory page
+  if (const std::uint8_t* page = _readPages[addr >> 8]; page != nullptr)
+    return page[addr & 0xFF];
+
   // 16 KiB ROM bank 00 from cartridge, usually a fixed bank
   // 16 KiB ROM Bank 01~NN Ffom cartridge, switchable bank via mapper (if any)
   // OR
@@ -807,8 +1806,10 @@ std::uint8_t  GBC::GameBoyColor::read(std::uint16_t addr)
 
   // 8 KiB Video RAM (VRAM)
   // In CGB mode, switchable bank 0/1
-  else if (addr < 0xA000)
+  else if (addr < 0xA000) {
+    synchronizePpu();
     return _ppu.readRam(addr - 0x8000);
+  }
 
   // 8 KiB External RAM
   // From cartridge, switchable bank if any
@@ -826,8 +1827,10 @@ std::uint8_t  GBC::GameBoyColor::read(std::uint16_t addr)
     return readWRam(addr - 0xE000);
 
   // Sprite attribute table (OAM)
-  else if (addr < 0xFEA0)
+  else if (addr < 0xFEA0) {
+    synchronizePpu();
     return _ppu.readOam(addr - 0xFE00);
+  }
 
   // Not Usable
   // Nintendo says use of this area is prohibited
@@ -937,6 +1940,8 @@ std::uint8_t  GBC::GameBoyColor::readIo(std::uint16_t addr)
   case GBC::PixelProcessingUnit::IO::OCPI:
   case GBC::PixelProcessingUnit::IO::OCPD:
   case GBC::PixelProcessingUnit::IO::OPRI:
+    // Update PPU before reading its state
+    synchronizePpu();
     return _ppu.readIo(addr);
 
   case IO::JOYP:  // Joypad, R/W
@@ -944,7 +1949,8 @@ std::uint8_t  GBC::GameBoyColor::readIo(std::uint16_t addr)
     return _io[IO::JOYP] | 0b11000000;
 
   case IO::SC:    // Serial transfer Control
-    return _io[IO::SC] | 0b10000011;
+    // Bits 6-5-4-3-2 are always set
+    return _io[IO::SC] | 0b01111100;
 
   case IO::RP:    // Infared communication
     return _io[IO::RP] & ((_io[IO::RP] & 0b11000000) == 0b11000000 ? 0b11000011 : 0b11000001);
@@ -955,7 +1961,12 @@ std::uint8_t  GBC::GameBoyColor::readIo(std::uint16_t addr)
 
   case IO::DIVHi: // High byte of DIV
   case IO::TIMA:  // Timer Counter, R/W
+    // Update timer before reading it
+    synchronizeTimer();
+    return _io[addr];
+
   case IO::TMA:   // Timer Modulo, R/W
+  case IO::SB:    // Serial transfer Data, R/W
   case IO::TAC:   // Time Control, R/W of bits 2-1-0
   case IO::IF:    // Interrupt Flags, R/W
   case IO::DMA:   // DMA Transfer and Start Address, R/W
@@ -970,7 +1981,6 @@ std::uint8_t  GBC::GameBoyColor::readIo(std::uint16_t addr)
 
 
 
-  case IO::SB:    // Serial transfer Data, R/W
   case IO::DIVLo: // Low byte of DIV, not accessible
   case IO::BANK:  // Boot Bank Controller, W, 0 to enable Boot mapping in ROM
   case IO::HDMA1: // New DMA Transfers source high byte, W, CGB mode only
@@ -997,17 +2007,35 @@ std::uint8_t  GBC::GameBoyColor::readHRam(std::uint16_t addr)
 
 void  GBC::GameBoyColor::write(std::uint16_t addr, std::uint8_t value)
 {
+  // Count memory access by region
+  if (_profile.enabled == true)
+    _profile.writes[GBC::Profile::region(addr)]++;
+
+  // Directly mapped memory page
+  if (std::uint8_t* page = _writePages[addr >> 8]; page != nullptr) {
+    page[addr & 0xFF] = value;
+
+    // Only WRAM is mapped above external RAM, invalidate decoded instructions
+    if (addr >= 0xC000)
+      _cpu.invalidateWRam((page - _wRam.data()) + (addr & 0xFF));
+    return;
+  }
+
   // 16 KiB ROM bank 00 from cartridge, usually a fixed bank
   // 16 KiB ROM Bank 01~NN Ffom cartridge, switchable bank via mapper (if any)
   // OR
   // Bootstrap sequence
-  if (addr < 0x8000)
+  if (addr < 0x8000) {
     _mbc->writeRom(addr - 0x0000, value);
+    updatePages();
+  }
 
   // 8 KiB Video RAM (VRAM)
   // In CGB mode, switchable bank 0/1
-  else if (addr < 0xA000)
+  else if (addr < 0xA000) {
+    synchronizePpu();
     _ppu.writeRam(addr - 0x8000, value);
+  }
 
   // 8 KiB External RAM
   // From cartridge, switchable bank if any
@@ -1025,8 +2053,10 @@ void  GBC::GameBoyColor::write(std::uint16_t addr, std::uint8_t value)
     writeWRam(addr - 0xE000, value);
 
   // Sprite attribute table (OAM)
-  else if (addr < 0xFEA0)
+  else if (addr < 0xFEA0) {
+    synchronizePpu();
     _ppu.writeOam(addr - 0xFE00, value);
+  }
 
   // Not Usable
   // Nintendo says use of this area is prohibited
@@ -1055,12 +2085,14 @@ void  GBC::GameBoyColor::writeWRam(std::uint16_t addr, std::uint8_t value)
 #endif
 
   // First half is alway bank 0
-  if (addr < 0x1000)
-    _wRam[addr] = value;
-
   // Second half is a WRAM bank
-  else
-    _wRam[(std::clamp(_io[IO::SVBK] & 0b00000111, 1, 7) * 0x1000) + (addr - 0x1000)] = value;
+  std::size_t index = (addr < 0x1000) ? addr : ((std::clamp(_io[IO::SVBK] & 0b00000111, 1, 7) * 0x1000) + (addr - 0x1000));
+
+  // Write data to WRAM
+  _wRam[index] = value;
+
+  // Invalidate decoded instructions
+  _cpu.invalidateWRam(index);
 }
 
 void  GBC::GameBoyColor::writeIo(std::uint16_t addr, std::uint8_t value)
@@ -1132,7 +2164,12 @@ void  GBC::GameBoyColor::writeIo(std::uint16_t addr, std::uint8_t value)
   case GBC::PixelProcessingUnit::IO::OCPI:
   case GBC::PixelProcessingUnit::IO::OCPD:
   case GBC::PixelProcessingUnit::IO::OPRI:
+    // Update PPU before changing its state
+    synchronizePpu();
     _ppu.writeIo(addr, value);
+
+    // Mode might have changed, stop CPU to handle it
+    schedule(Event::EventPpu, _cycles);
     break;
 
   case IO::JOYP:  // Joypad, R/W
@@ -1167,22 +2204,35 @@ void  GBC::GameBoyColor::writeIo(std::uint16_t addr, std::uint8_t value)
   case IO::SC:    // Serial transfer Control
     _io[IO::SC] = value & 0b10000011;
 
-    // Handle transfer
-    // NOTE: transfer not supported, received bit set to 0b11111111
-    if ((_io[IO::SC] & 0b10000001) == 0b10000001) {
-      _io[IO::IF] |= Interrupt::InterruptSerial;
-      _io[IO::SB] = 0b11111111;
-      _io[IO::SC] &= 0b00000011;
-    }
+    // Start transfer with internal clock, 8 bits at 8192Hz (262144Hz in fast mode), twice faster in double speed
+    if ((_io[IO::SC] & 0b10000001) == 0b10000001)
+      schedule(Event::EventSerial, _cycles + ((_io[IO::SC] & 0b00000010) ? 128 : 4096) / ((_io[IO::KEY1] & 0b10000000) ? 2 : 1));
+
+    // Cancel transfer
+    else
+      schedule(Event::EventSerial, GBC::GameBoyColor::EventNever);
     break;
 
   case IO::DIVHi: // High byte of DIV, R/W (always set to zero when written)
-    // Always set to 0
+    // Always set to 0, update timer before and reschedule overflow after
+    synchronizeTimer();
     _io[IO::DIVHi] = 0;
+    synchronizeTimer();
+    break;
+
+  case IO::TIMA:  // Timer Counter, R/W
+  case IO::TMA:   // Timer Modulo, R/W
+    // Update timer before and reschedule overflow after
+    synchronizeTimer();
+    _io[addr] = value;
+    synchronizeTimer();
     break;
 
   case IO::TAC:     // Time Control, R/W of bit 2-1-0
+    // Update timer before and reschedule overflow after
+    synchronizeTimer();
     _io[IO::TAC] = value & 0b00000111;
+    synchronizeTimer();
     break;
 
   case IO::IF:    // Interrupt Flags, R/W
@@ -1212,8 +2262,10 @@ void  GBC::GameBoyColor::writeIo(std::uint16_t addr, std::uint8_t value)
 
   case IO::BANK:  // Boot Bank Controller, W, 0 to enable Boot mapping in ROM
     // Active only during boot mapping
-    if (_io[IO::BANK] == 0)
+    if (_io[IO::BANK] == 0) {
       _io[IO::BANK] = value;
+      updatePages();
+    }
     break;
 
   case IO::HDMA5: // Start New DMA Transfer, R/W, CGB mode only
@@ -1221,6 +2273,8 @@ void  GBC::GameBoyColor::writeIo(std::uint16_t addr, std::uint8_t value)
     // HBlank DMA
     if (value & 0b10000000)
     {
+      // Update PPU mode before checking for HBlank
+      synchronizePpu();
       _transferMode = Transfer::TransferHdma1;
       _transferIndex = 0;
       _transferTrigger = (_io[GBC::PixelProcessingUnit::IO::STAT] & GBC::PixelProcessingUnit::LcdStatus::LcdStatusModeMask) == GBC::PixelProcessingUnit::LcdMode::LcdMode0;
@@ -1248,13 +2302,13 @@ void  GBC::GameBoyColor::writeIo(std::uint16_t addr, std::uint8_t value)
     break;
 
   case IO::SVBK:  // Work Ram Bank, R/W, CGB mode only
-    if ((_io[IO::KEY0] & 0b00001100) != CpuMode::CpuModeDmg)
+    if ((_io[IO::KEY0] & 0b00001100) != CpuMode::CpuModeDmg) {
       _io[IO::SVBK] = value & 0b00000111;
+      updatePages();
+    }
     break;
 
   case IO::SB:    // Serial transfer Data, R/W
-  case IO::TIMA:  // Timer Counter, R/W
-  case IO::TMA:   // Timer Modulo, R/W
   case IO::HDMA1: // New DMA Transfers source high byte, W, CGB mode only
   case IO::HDMA2: // New DMA Transfers source low byte, W, CGB mode only
   case IO::HDMA3: // New DMA Transfers destination high byte, W, CGB mode only
@@ -1286,4 +2340,36 @@ void  GBC::GameBoyColor::writeHRam(std::uint16_t addr, std::uint8_t value)
 
   // Write data to HRAM
   _hRam[addr] = value;
+
+  // Invalidate decoded instructions
+  _cpu.invalidateHRam(addr);
+}
+
+void  GBC::GameBoyColor::updatePages()
+{
+  // VRAM, OAM, IO and HRAM pages always use slow path (PPU synchronization, mode locking and side effects)
+  _readPages.fill(nullptr);
+  _writePages.fill(nullptr);
+
+  // ROM banks from MBC, read only
+  for (unsigned int page = 0x00; page < 0x80; page++)
+    _readPages[page] = _mbc->getRomPage(page << 8);
+
+  // Bootstrap overlay, header page is shared between boot and ROM
+  if (_io[IO::BANK] == 0)
+    for (unsigned int page = 0x00; page < 0x80 && page * 0x0100 < _boot.size(); page++)
+      _readPages[page] = (page != 0x01 && (page + 1) * 0x0100 <= _boot.size()) ? _boot.data() + page * 0x0100 : nullptr;
+
+  // External RAM from MBC, when enabled and plain memory, battery RAM writes use slow path to be tracked
+  for (unsigned int page = 0xA0; page < 0xC0; page++) {
+    _readPages[page] = _mbc->getRamPage((page << 8) - 0xA000, false);
+    _writePages[page] = _mbc->getRamPage((page << 8) - 0xA000, true);
+  }
+
+  // WRAM fixed bank, switchable bank and their echo
+  for (unsigned int page = 0xC0; page < 0xFE; page++) {
+    std::size_t addr = ((page << 8) - 0xC000) % 0x2000;
+
+    _readPages[page] = _writePages[page] = _wRam.data() + ((addr < 0x1000) ? addr : ((std::max(_io[IO::SVBK] & 0b00000111, 1) * 0x1000) + (addr - 0x1000)));
+  }
 }
\ No newline at end of file
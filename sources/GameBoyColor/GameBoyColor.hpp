@@ -3,9 +3,13 @@
 #include <array>
 #include <cstdint>
 #include <filesystem>
+#include <limits>
 #include <list>
 #include <memory>
+#include <queue>
+#include <span>
 #include <string>
+#include <string_view>
 #include <stdexcept>
 #include <vector>
 #include <functional>
@@ -18,6 +22,8 @@
 #include "GameBoyColor/CentralProcessingUnit.hpp"
 #include "GameBoyColor/MemoryBankController.hpp"
 #include "GameBoyColor/PixelProcessingUnit.hpp"
+#include "GameBoyColor/Profile.hpp"
+#include "GameBoyColor/SaveState.hpp"
 #include "Math/Vector.hpp"
 #include "System/JavaScriptObjectNotation.hpp"
 #include "System/Window.hpp"
@@ -51,6 +57,8 @@ namespace GBC
       KeyCount
     };
 
+    using Input = std::function<std::array<bool, GBC::GameBoyColor::Key::KeyCount>(std::size_t frame)>; // Source of pressed keys for a frame
+
   private:
     static const std::string_view SaveStateBase;
 
@@ -156,6 +164,14 @@ namespace GBC
     GBC::GameBoyColor::Header                   _header;    // Main info of the ROM
     std::filesystem::path                       _path;      // Path of the ROM
     std::vector<std::uint8_t>                   _boot;      // Bootstrap sequence memory
+    bool                                        _headless;  // No rendering target, serial output is recorded
+    std::string                                 _serial;    // Bytes sent through serial port when headless
+    std::vector<std::uint8_t>                   _ahead;     // Snapshot restored after run-ahead frames
+    bool                                        _discard;   // Frames simulated ahead, discarded so they don't flush battery RAM nor count as emulated
+    GBC::GameBoyColor*                          _link;      // Emulator connected through link cable, nullptr if none
+    std::size_t                                 _linkBytes; // Number of bytes exchanged through link cable
+    std::size_t                                 _linkSkew;  // Largest lead of linked emulator past end of a transfer, in cycles
+    GBC::Profile                                _profile;   // Per-subsystem counters and timings, collected when enabled
     std::size_t                                 _cycles;    // Number of CPU cycle since boot
     GBC::CentralProcessingUnit                  _cpu;       // Central Processing Unit
     GBC::PixelProcessingUnit                    _ppu;       // Pixel Processing Unit
@@ -165,9 +181,12 @@ namespace GBC
     std::array<std::uint8_t, 128>               _io;        // IO registers
     std::array<std::uint8_t, 127>               _hRam;      // Raw High RAM memory
     std::uint8_t                                _ie;        // Interrupt Enable register
+    std::array<const std::uint8_t*, 256>        _readPages;   // Direct pointers to readable 256 bytes pages, nullptr for slow path
+    std::array<std::uint8_t*, 256>              _writePages;  // Direct pointers to writable 256 bytes pages, nullptr for slow path
     
     std::array<bool, Key::KeyCount>               _keys;      // Currently pressed keys
     std::array<Game::Window::Key, Key::KeyCount>  _bindings;  // Keys bindings
+    GBC::GameBoyColor::Input                      _input;     // Injected source of pressed keys, keyboard bindings when empty
 
     enum Transfer
     {
@@ -181,6 +200,51 @@ namespace GBC
     std::size_t _transferIndex;   // Index of running transfer
     bool        _transferTrigger; // Trigger for HDMA1 transfer
 
+    enum Event
+    {
+      EventFrame,   // End of frame
+      EventTimer,   // TIMA overflow
+      EventPpu,     // PPU mode or line change, also triggers HDMA1 transfer
+      EventSerial,  // End of serial transfer
+      EventLink,    // Catch-up point requested by linked emulator
+
+      EventCount
+    };
+
+    static constexpr std::size_t  EventNever = std::numeric_limits<std::size_t>::max(); // Cycle of unscheduled events
+    static constexpr std::size_t  LinkSlice = 128;                                      // Maximum lead of a linked emulator, shortest transfer (fast clock, halved in double speed)
+    static constexpr std::size_t  LinkSkew = 64;                                        // Maximum lead of a linked emulator at end of a transfer, last CPU step run past catch-up point
+
+    struct Schedule
+    {
+      std::size_t               cycles; // Cycle of the event
+      GBC::GameBoyColor::Event  event;  // Type of event
+
+      bool  operator>(const Schedule& other) const  // Order by cycle in min-heap
+      {
+        return cycles > other.cycles;
+      }
+    };
+
+    std::priority_queue<Schedule, std::vector<Schedule>, std::greater<Schedule>>  _events;       // Min-heap of upcoming events, outdated entries are skipped
+    std::array<std::size_t, Event::EventCount>                                    _eventCycles;  // Cycle of next event of each type
+    std::size_t                                                                   _timerCycles;  // Cycle of last timer update
+    std::size_t                                                                   _ppuCycles;    // Cycle of last PPU update
+
+    GameBoyColor(const std::filesystem::path& filename, sf::Texture* texture, Math::Vector<2, unsigned int> origin);
+
+    enum Result
+    {
+      ResultNone,   // No test result reported yet
+      ResultPassed, // Test ROM reported success
+      ResultFailed  // Test ROM reported failure
+    };
+
+    GBC::GameBoyColor::Result result();             // Check serial output, memory and registers for a blargg/mooneye test result
+    std::uint64_t             framebuffer() const;  // FNV-1a hash of last frame
+
+    static GBC::GameBoyColor::Input script(const std::filesystem::path& filename);  // Load input script, each line "<frame> [keys]" holds keys from that frame
+
     void  load(const std::filesystem::path& filename);                                              // Load a new ROM in memory
     void  loadFile(const std::filesystem::path& filename, std::vector<std::uint8_t>& destination);  // Load file to vector
     void  loadHeader(const std::vector<uint8_t>& rom);                                              // Get header data
@@ -189,55 +253,74 @@ namespace GBC
     std::uint8_t  readWRam(std::uint16_t addr); // Read one byte from WRAM
     std::uint8_t  readIo(std::uint16_t addr);   // Read one byte from IO register
     std::uint8_t  readHRam(std::uint16_t addr); // Read one byte from HRAM
+
+    const std::uint8_t* readBlock(std::uint16_t addr, std::size_t size) const;        // Direct pointer to bytes of a mapped page, nullptr for slow path or when crossing a page
+    static bool         transferValid(std::uint16_t source, std::uint16_t destination); // Check HDMA source and destination addresses
     
     void  write(std::uint16_t addr, std::uint8_t value);      // Write one byte to memory
     void  writeWRam(std::uint16_t addr, std::uint8_t value);  // Write one byte to WRAM
     void  writeIo(std::uint16_t addr, std::uint8_t value);    // Write one byte to IO register
     void  writeHRam(std::uint16_t addr, std::uint8_t value);  // Write one byte to HRAM
 
-    void  simulateKeys();   // Handle keys
-    void  simulateTimer();  // Update 4 CPU cycle of TIMA/TMA/DIV timer registers
+    void  updatePages();  // Rebuild page tables after a bank switch
+
+    void  simulateKeys();                 // Handle keys
+    void  simulateCpu(bool instruction);  // Run CPU up to next event or transfer, by instructions or by ticks
+    void  simulateSerial();               // End serial transfer, exchanging bytes with linked emulator
+    void  simulateUntil(std::size_t cycles);  // Run execution loop up to a cycle, without going past end of current frame
+
+    void  schedule(Event event, std::size_t cycles);  // Schedule next event of a type, EventNever to cancel it
+    void  synchronize();                              // Update components up to current cycle and handle due events
+    void  synchronizeTimer();                         // Update TIMA/TMA/DIV timer registers up to current cycle
+    void  synchronizePpu();                           // Update PPU up to current cycle
+    void  switchSpeed();                              // Switch CPU speed, keeping timer in sync
 
-    void        save(std::ofstream& file, const std::string& name, const void* data, std::size_t size) const; // Save raw variable data to file
-    void        save(std::ofstream& file, const std::string& name, const std::string& data) const;            // Save string variable to file
+    void  save(GBC::SaveState& state) const;                  // Serialize whole emulator state
+    void  load(GBC::LoadState& state);                        // Deserialize whole emulator state
+    void  loadState(std::span<const std::uint8_t> buffer);    // Deserialize save state file content, binary snapshot or text export
+
+    void              save(GBC::SaveState& state, std::string_view name, const void* data, std::size_t size) const; // Save raw variable data to state
+    void              save(GBC::SaveState& state, std::string_view name, const std::string& data) const;            // Save string variable to state
 
     template<typename Type>
-    void        save(std::ofstream& file, const std::string& name, const std::vector<Type>& data) const       // Save vector variable to file
+    void              save(GBC::SaveState& state, std::string_view name, const std::vector<Type>& data) const       // Save vector variable to state
     {
-      save(file, name, data.data(), data.size() * sizeof(Type));
+      save(state, name, data.data(), data.size() * sizeof(Type));
     }
 
     template<typename Type>
-    void        save(std::ofstream& file, const std::string& name, const Type& data) const                    // Save variable to file
+    void              save(GBC::SaveState& state, std::string_view name, const Type& data) const                    // Save variable to state
     {
-      save(file, name, &data, sizeof(Type));
+      save(state, name, &data, sizeof(Type));
     }
 
-    std::string loadVariable(std::ifstream& file, const std::string& name);                                   // Load raw variable data from file
-    void        loadValue(const std::string& value, void* data, std::size_t size);                            // Load raw variable data from file
-    void        load(std::ifstream& file, const std::string& name, std::string& data);                        // Load string variable to file
+    std::string_view  loadVariable(GBC::LoadState& state, std::string_view name);                                   // Get encoded variable data from state
+    bool              loadExists(const GBC::LoadState& state, std::string_view name) const;                         // Check variable is in state, always true for binary snapshots
+    std::size_t       loadSize(const GBC::LoadState& state, std::string_view value) const;                          // Get size of encoded variable data
+    void              loadValue(const GBC::LoadState& state, std::string_view value, void* data, std::size_t size); // Decode raw variable data
+    void              load(GBC::LoadState& state, std::string_view name, std::string& data);                        // Load string variable from state
 
     template<typename Type>
-    void        load(std::ifstream& file, const std::string& name, std::vector<Type>& data)                   // Load vector variable to file
+    void              load(GBC::LoadState& state, std::string_view name, std::vector<Type>& data)                   // Load vector variable from state
     {
-      // Get value from file
-      std::string value = loadVariable(file, name);
+      // Get value from state
+      std::string_view value = loadVariable(state, name);
 
       // Resize target vector
-      data.resize(value.length() / 2 / sizeof(Type));
+      data.resize(loadSize(state, value) / sizeof(Type));
 
       // Load value to vector
-      loadValue(value, data.data(), data.size() * sizeof(Type));
+      loadValue(state, value, data.data(), data.size() * sizeof(Type));
     }
 
     template<typename Type>
-    void        load(std::ifstream& file, const std::string& name, Type& data)                                // Load variable from file
+    void              load(GBC::LoadState& state, std::string_view name, Type& data)                                // Load variable from state
     {
-      // Get value from file
-      std::string value = loadVariable(file, name);
+      // Get value from state
+      std::string_view value = loadVariable(state, name);
 
       // Load value to variable
-      loadValue(value, (void*)&data, sizeof(data));
+      loadValue(state, value, (void*)&data, sizeof(data));
     }
 
     void  loadBindings(); // Load bindings from JSON
@@ -245,6 +328,7 @@ namespace GBC
 
   public:
     GameBoyColor(const std::filesystem::path& filename, sf::Texture& texture, Math::Vector<2, unsigned int> origin);
+    GameBoyColor(const std::filesystem::path& filename);  // Headless emulator, without rendering target
     ~GameBoyColor();
 
     void  simulate();       // Simulate a frame
@@ -252,15 +336,49 @@ namespace GBC
     void  simulateCycle();  // Simulate a CPU tick
     void  simulatePost();   // Simulate a CPU tick
 
+    void  simulateAhead(std::size_t frames);  // Display result of frames simulated ahead with current inputs, then restore state
+    void  simulateLink();                     // Simulate a frame of this emulator and linked one, lock-stepped at serial transfers
+
+    void  link(GBC::GameBoyColor& other); // Connect link cable to another emulator, disconnecting previous ones
+    void  unlink();                       // Disconnect link cable
+
     std::size_t                                                           cycles() const; // Get cycle count
     const sf::Texture&                                                    lcd() const;    // Get rendering target
     const std::array<std::int16_t, GBC::AudioProcessingUnit::BufferSize>& sound() const;  // Get current sound frame
     const GBC::GameBoyColor::Header&                                      header() const; // Get game header
 
+    GBC::CentralProcessingUnit::Mode  mode() const;                             // Get CPU execution mode
+    void                              mode(GBC::CentralProcessingUnit::Mode mode);  // Set CPU execution mode
+
+    GBC::PixelProcessingUnit::Renderer  renderer() const;                                   // Get PPU rendering method
+    void                                renderer(GBC::PixelProcessingUnit::Renderer renderer);  // Set PPU rendering method
+
+    bool  skip() const;     // Get PPU frame-skip request
+    void  skip(bool skip);  // Skip pixel output of frames starting after next VBlank, STAT and LY timings are kept
+
+    const GBC::Profile& profile() const;      // Get per-subsystem counters and timings
+    void                profile(bool enable);  // Reset counters and timers, then enable or disable their collection
+
+    std::size_t emulated() const;   // Get number of frames emulated by PPU
+    std::size_t presented() const;  // Get number of frames sent to rendering target
+
     Game::Window::Key bind(GBC::GameBoyColor::Key key) const;                   // Get button binding
     void              bind(GBC::GameBoyColor::Key key, Game::Window::Key bind); // Set button binding
 
-    void  load(std::size_t id);       // Load saved state
-    void  save(std::size_t id) const; // Save state
+    void  input(const GBC::GameBoyColor::Input& input); // Set source of pressed keys, empty to use keyboard bindings
+
+    void  load(std::size_t id);                                                                             // Load saved state, binary snapshot or text export
+    void  save(std::size_t id, GBC::SaveState::Format format = GBC::SaveState::Format::FormatBinary) const; // Save state
+    void  load(std::span<const std::uint8_t> snapshot);                                                     // Load state from binary snapshot in memory
+    void  save(std::vector<std::uint8_t>& snapshot) const;                                                  // Save state to binary snapshot in memory
+
+    const std::string&  serial() const; // Get bytes sent through serial port, recorded only when headless
+
+    static GBC::GameBoyColor::Header  parseHeader(std::span<const std::uint8_t> rom); // Parse cartridge header from first 0x0150 bytes of ROM, global checksum is only meaningful on whole ROM
+
+    static void benchmark(const std::filesystem::path& filename, std::size_t frames);                                                         // Headless simulation of frames with each CPU mode and PPU renderer, report frames per second, audio and run-ahead cost
+    static bool headless(const std::filesystem::path& filename, std::size_t frames, GBC::CentralProcessingUnit::Mode mode, bool profile = false);  // Unthrottled simulation up to a test ROM result or a number of frames, report frames per second, framebuffer hash and optionally per-frame profile, false if test failed
+    static bool link(const std::filesystem::path& first, const std::filesystem::path& second, std::size_t frames);                           // Headless simulation of two linked emulators, report frames per second, bytes exchanged and framebuffer hashes, false if a transfer ended late on one side
+    static void batch(const std::filesystem::path& filename, std::size_t frames);                                                             // Parallel headless simulation of ROMs and input scripts listed in a file, report aggregate frames per second and framebuffer hashes
   };
 }
\ No newline at end of file
@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <chrono>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
@@ -15,23 +18,45 @@ GBC::MemoryBankController::MemoryBankController(GBC::GameBoyColor& gbc, const st
   _ramEnable(false),
   _ramBank(0),
   _ramSave(ramSave),
-  _ramSaved()
+  _ramSaved(),
+  _ramDirty((ramSize + RamPageSize - 1) / RamPageSize, false),
+  _ramPending((ramSize + RamPageSize - 1) / RamPageSize, false),
+  _ramFile(),
+  _ramStream(),
+  _ramFlush(),
+  _ramTicks(0),
+  _ramCopied(0),
+  _ramFlushed(0),
+  _ramFlushes(0),
+  _ramFlushTime(0)
 {
   // ROM cannot be empty
   if (_rom.empty() == true)
     throw std::runtime_error((std::string(__FILE__) + ": l." + std::to_string(__LINE__)).c_str());
 
   // Load RAM from memory
-  loadRam();
+  bool  loaded = loadRam();
 
   // Set saved RAM
   _ramSaved = _ram;
+
+  // Save file kept open for incremental writes
+  openRam(loaded);
 }
 
 GBC::MemoryBankController::~MemoryBankController()
 {
-  // Save RAM to file
-  saveRam();
+  // No save file
+  if (_ramSave.empty() == true)
+    return;
+
+  // Write remaining saved RAM pages and wait for completion
+  flushRam(true);
+  if (_ramFlush.valid() == true)
+    _ramFlush.get();
+
+  // Report battery RAM persistence cost
+  std::cout << "[GBC::MBC] Battery RAM: " << _ramCopied << " bytes copied, " << _ramFlushed << " bytes written in " << _ramFlushes << " flushes (" << _ramFlushTime.load() << "us)." << std::endl;
 }
 
 std::uint8_t  GBC::MemoryBankController::readRom(std::uint16_t address) const
@@ -42,11 +67,47 @@ std::uint8_t  GBC::MemoryBankController::readRom(std::uint16_t address) const
     throw std::runtime_error((std::string(__FILE__) + ": l." + std::to_string(__LINE__)).c_str());
 #endif
 
+  // Get byte from current banks
+  return _rom[getRomIndex(address)];
+}
+
+std::size_t GBC::MemoryBankController::getRomIndex(std::uint16_t address) const
+{
   // Get bank from address range
   std::size_t bank = address < 0x4000 ? _romBank0 : _romBank1;
 
   // Truncate address to ROM size
-  return _rom[(bank * 0x4000 + address % 0x4000) % _rom.size()];
+  return (bank * 0x4000 + address % 0x4000) % _rom.size();
+}
+
+std::size_t GBC::MemoryBankController::getRomSize() const
+{
+  // Get size of raw ROM
+  return _rom.size();
+}
+
+const std::uint8_t* GBC::MemoryBankController::getRomPage(std::uint16_t address) const
+{
+  // Page would wrap around end of ROM
+  if (_rom.size() % 0x0100 != 0)
+    return nullptr;
+
+  // Get start of page in current banks
+  return _rom.data() + getRomIndex(address & 0xFF00);
+}
+
+std::uint8_t* GBC::MemoryBankController::getRamPage(std::uint16_t address, bool write)
+{
+  // No direct access if no RAM, disabled or page would wrap around end of RAM
+  if (_ram.empty() == true || _ramEnable == false || _ram.size() % 0x0100 != 0)
+    return nullptr;
+
+  // Writes to battery RAM are tracked
+  if (write == true && _ramSave.empty() == false)
+    return nullptr;
+
+  // Get start of page in current bank
+  return _ram.data() + (_ramBank * 0x2000 + (address & 0xFF00)) % _ram.size();
 }
 
 std::uint8_t  GBC::MemoryBankController::readRam(std::uint16_t address) const
@@ -89,8 +150,13 @@ void  GBC::MemoryBankController::writeRam(std::uint16_t address, std::uint8_t va
   if (_ram.empty() == true || _ramEnable == false)
     return;
 
+  std::size_t index = (_ramBank * 0x2000 + address) % _ram.size();
+
   // Write to RAM, truncate address
-  _ram[(_ramBank * 0x2000 + address) % _ram.size()] = value;
+  _ram[index] = value;
+
+  // Mark page to be copied to saved RAM
+  _ramDirty[index / RamPageSize] = true;
 }
 
 std::pair<std::size_t, std::size_t> GBC::MemoryBankController::getRomBanks() const
@@ -128,30 +194,30 @@ void  GBC::MemoryBankController::setRamEnable(bool enable)
 {
   // Save RAM to buffer
   if (_ramEnable == true && enable == false)
-    _ramSaved = _ram;
+    commitRam();
 
   // Enable/disable RAM
   _ramEnable = enable;
 }
 
-void  GBC::MemoryBankController::loadRam()
+bool  GBC::MemoryBankController::loadRam()
 {
   // No save file
   if (_ramSave.empty() == true)
-    return;
+    return false;
 
   std::ifstream file(_ramSave, std::ifstream::binary);
 
   // Check if file open properly
   if (file.good() == false) {
     std::cerr << "[GBC::MBC] Warning, failed to load '" << _ramSave << "'." << std::endl;
-    return;
+    return false;
   }
 
   // Check compatible size
   if (std::filesystem::file_size(_ramSave) != _ram.size()) {
     std::cerr << "[GBC::MBC] Warning, invalid save size '" << _ramSave << "'." << std::endl;
-    return;
+    return false;
   }
 
   std::vector<std::uint8_t> data(std::filesystem::file_size(_ramSave), 0);
@@ -162,60 +228,175 @@ void  GBC::MemoryBankController::loadRam()
   // Check for error
   if (file.gcount() != data.size()) {
     std::cerr << "[GBC::MBC] Warning, invalid read size of '" << _ramSave << "'." << std::endl;
-    return;
+    return false;
   }
 
   // Copy RAM
   std::copy(data.begin(), data.end(), _ram.begin());
+
+  return true;
 }
 
-void  GBC::MemoryBankController::saveRam() const
+void  GBC::MemoryBankController::openRam(bool loaded)
 {
   // No save file
   if (_ramSave.empty() == true)
     return;
 
-  std::ofstream file(_ramSave, std::ofstream::binary | std::ofstream::trunc);
+  // Existing save file could not be loaded, keep it untouched rather than overwrite player's save
+  if (loaded == false && std::filesystem::exists(_ramSave) == true) {
+    std::cerr << "[GBC::MBC] Warning, '" << _ramSave << "' not loaded, RAM will not be saved." << std::endl;
+    return;
+  }
+
+  // Create save file with current RAM
+  if (loaded == false) {
+    std::ofstream file(_ramSave, std::ofstream::binary | std::ofstream::trunc);
+
+    file.write((const char*)_ram.data(), _ram.size());
+    if (file.good() == false) {
+      std::cerr << "[GBC::MBC] Warning, failed to write '" << _ramSave << "'." << std::endl;
+      return;
+    }
+  }
+
+  // Save file now matches saved RAM
+  _ramFile = _ramSaved;
+  _ramStream.open(_ramSave, std::fstream::binary | std::fstream::in | std::fstream::out);
 
   // Check if file open properly
-  if (file.good() == false) {
+  if (_ramStream.good() == false)
     std::cerr << "[GBC::MBC] Warning, failed to open '" << _ramSave << "'." << std::endl;
+}
+
+void  GBC::MemoryBankController::commitRam()
+{
+  // No save file, RAM writes are not tracked
+  if (_ramSave.empty() == true)
     return;
-  }
 
-  // Write External RAM to save file
-  file.write((const char*)_ramSaved.data(), _ramSaved.size());
+  // Copy pages written since last commit
+  for (std::size_t page = 0; page < _ramDirty.size(); page++) {
+    if (_ramDirty[page] == false)
+      continue;
 
-  // Check for success
-  if (file.good() == false) {
-    std::cerr << "[GBC::MBC] Warning, failed to write '" << _ramSave << "'." << std::endl;
+    std::size_t start = page * RamPageSize;
+    std::size_t end = std::min(start + RamPageSize, _ram.size());
+
+    std::copy(_ram.begin() + start, _ram.begin() + end, _ramSaved.begin() + start);
+    _ramDirty[page] = false;
+    _ramPending[page] = true;
+    _ramCopied += end - start;
+  }
+}
+
+void  GBC::MemoryBankController::flushRam(bool wait)
+{
+  // No save file
+  if (_ramSave.empty() == true || _ramStream.is_open() == false)
     return;
+
+  // Previous write still running, try again later
+  if (_ramFlush.valid() == true) {
+    if (wait == false && _ramFlush.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+      return;
+    _ramFlush.get();
   }
+
+  std::vector<std::size_t>  offsets;
+  std::vector<std::uint8_t> data;
+
+  // Collect pending pages differing from save file
+  for (std::size_t page = 0; page < _ramPending.size(); page++) {
+    if (_ramPending[page] == false)
+      continue;
+
+    std::size_t start = page * RamPageSize;
+    std::size_t end = std::min(start + RamPageSize, _ramSaved.size());
+
+    _ramPending[page] = false;
+    if (std::memcmp(_ramSaved.data() + start, _ramFile.data() + start, end - start) == 0)
+      continue;
+
+    std::copy(_ramSaved.begin() + start, _ramSaved.begin() + end, _ramFile.begin() + start);
+    offsets.push_back(start);
+    data.insert(data.end(), _ramSaved.begin() + start, _ramSaved.begin() + end);
+  }
+
+  // Nothing to write
+  if (offsets.empty() == true)
+    return;
+
+  _ramFlushed += data.size();
+  _ramFlushes += 1;
+
+  // Write pages in background, stream is only used by this task until it completes
+  _ramFlush = std::async(std::launch::async, [this, offsets = std::move(offsets), data = std::move(data)]() {
+    auto        start = std::chrono::steady_clock::now();
+    std::size_t position = 0;
+
+    for (std::size_t offset : offsets) {
+      std::size_t size = std::min(RamPageSize, data.size() - position);
+
+      _ramStream.seekp(offset);
+      _ramStream.write((const char*)data.data() + position, size);
+      position += size;
+    }
+    _ramStream.flush();
+
+    // Check for success
+    if (_ramStream.good() == false) {
+      std::cerr << "[GBC::MBC] Warning, failed to write '" << _ramSave << "'." << std::endl;
+      _ramStream.clear();
+    }
+
+    _ramFlushTime += std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+    });
 }
 
-void    GBC::MemoryBankController::save(std::ofstream& file) const
+void    GBC::MemoryBankController::save(GBC::SaveState& state) const
 {
   // Save MBC variables
-  _gbc.save(file, "MBC_ROMBANK0", _romBank0);
-  _gbc.save(file, "MBC_ROMBANK1", _romBank1);
-  _gbc.save(file, "MBC_RAM", _ram);
-  _gbc.save(file, "MBC_RAMENABLE", _ramEnable);
-  _gbc.save(file, "MBC_RAMBANK", _ramBank);
-  _gbc.save(file, "MBC_RAMSAVED", _ramSaved);
+  _gbc.save(state, "MBC_ROMBANK0", _romBank0);
+  _gbc.save(state, "MBC_ROMBANK1", _romBank1);
+  _gbc.save(state, "MBC_RAM", _ram);
+  _gbc.save(state, "MBC_RAMENABLE", _ramEnable);
+  _gbc.save(state, "MBC_RAMBANK", _ramBank);
+  _gbc.save(state, "MBC_RAMSAVED", _ramSaved);
 }
 
-void    GBC::MemoryBankController::load(std::ifstream& file)
+void    GBC::MemoryBankController::load(GBC::LoadState& state)
 {
   // Load MBC variables
-  _gbc.load(file, "MBC_ROMBANK0", _romBank0);
-  _gbc.load(file, "MBC_ROMBANK1", _romBank1);
-  _gbc.load(file, "MBC_RAM", _ram);
-  _gbc.load(file, "MBC_RAMENABLE", _ramEnable);
-  _gbc.load(file, "MBC_RAMBANK", _ramBank);
-  _gbc.load(file, "MBC_RAMSAVED", _ramSaved);
+  _gbc.load(state, "MBC_ROMBANK0", _romBank0);
+  _gbc.load(state, "MBC_ROMBANK1", _romBank1);
+  _gbc.load(state, "MBC_RAM", _ram);
+  _gbc.load(state, "MBC_RAMENABLE", _ramEnable);
+  _gbc.load(state, "MBC_RAMBANK", _ramBank);
+  _gbc.load(state, "MBC_RAMSAVED", _ramSaved);
+
+  // Pages differing from saved RAM are not committed yet
+  for (std::size_t page = 0; page < _ramDirty.size() && _ramSave.empty() == false; page++) {
+    std::size_t start = page * RamPageSize;
+    std::size_t end = std::min(start + RamPageSize, _ram.size());
+
+    _ramDirty[page] = (std::memcmp(_ram.data() + start, _ramSaved.data() + start, end - start) != 0);
+  }
+
+  // Saved RAM might differ from save file, only changed pages are written
+  std::fill(_ramPending.begin(), _ramPending.end(), true);
 }
 
 void    GBC::MemoryBankController::update(std::size_t ticks)
 {
-  // Does nothing
+  // Frames simulated ahead are discarded, their RAM must not reach save file
+  if (_gbc._discard == true)
+    return;
+
+  // Flush battery RAM at most once per second
+  _ramTicks += ticks;
+  if (_ramTicks >= GBC::CentralProcessingUnit::Frequency) {
+    _ramTicks = 0;
+    flushRam(false);
+  }
 }
\ No newline at end of file
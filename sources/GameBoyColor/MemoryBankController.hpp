@@ -1,12 +1,17 @@
 #pragma once
 
+#include <atomic>
 #include <filesystem>
+#include <fstream>
+#include <future>
 #include <string>
 #include <vector>
 
 namespace GBC
 {
   class GameBoyColor;
+  struct LoadState;
+  struct SaveState;
 
   class MemoryBankController
   {
@@ -14,17 +19,32 @@ namespace GBC
     GBC::GameBoyColor& _gbc;  // Main GBC reference for save states
 
   private:
-    const std::vector<std::uint8_t> _rom;       // Raw ROM memory
-    std::size_t                     _romBank0;  // ROM bank of first half of address range
-    std::size_t                     _romBank1;  // ROM bank of second half of address range
-    std::vector<std::uint8_t>       _ram;       // Raw RAM memory
-    bool                            _ramEnable; // RAM enable flag
-    std::size_t                     _ramBank;   // RAM bank
-    const std::filesystem::path     _ramSave;   // Path of RAM save files, empty if no battery
-    std::vector<std::uint8_t>       _ramSaved;  // Raw RAM to save
-
-    void  loadRam();        // Load MBC RAM from save file
-    void  saveRam() const;  // Save MBC RAM to save file
+    static constexpr std::size_t  RamPageSize = 0x0100; // Size of RAM pages tracked for battery save
+
+    const std::vector<std::uint8_t> _rom;         // Raw ROM memory
+    std::size_t                     _romBank0;    // ROM bank of first half of address range
+    std::size_t                     _romBank1;    // ROM bank of second half of address range
+    std::vector<std::uint8_t>       _ram;         // Raw RAM memory
+    bool                            _ramEnable;   // RAM enable flag
+    std::size_t                     _ramBank;     // RAM bank
+    const std::filesystem::path     _ramSave;     // Path of RAM save files, empty if no battery
+    std::vector<std::uint8_t>       _ramSaved;    // Raw RAM to save, updated when RAM is disabled
+    std::vector<bool>               _ramDirty;    // RAM pages written since last copy to saved RAM
+    std::vector<bool>               _ramPending;  // Saved RAM pages not flushed to save file yet
+    std::vector<std::uint8_t>       _ramFile;     // Content of save file, as last flushed
+    std::fstream                    _ramStream;   // Save file, opened for incremental writes
+    std::future<void>               _ramFlush;    // Asynchronous write of saved RAM pages to save file
+    std::size_t                     _ramTicks;    // Ticks since last flush
+
+    std::uint64_t               _ramCopied;     // Bytes copied from RAM to saved RAM
+    std::uint64_t               _ramFlushed;    // Bytes written to save file
+    std::uint64_t               _ramFlushes;    // Number of flushes to save file
+    std::atomic<std::uint64_t>  _ramFlushTime;  // Time spent writing save file, in microseconds
+
+    bool  loadRam();                // Load MBC RAM from save file, false if not loaded
+    void  openRam(bool loaded);     // Open save file for incremental writes, created if missing, left untouched if it exists but was not loaded
+    void  commitRam();              // Copy RAM pages written to saved RAM
+    void  flushRam(bool wait);      // Write saved RAM pages changed to save file, skipped if previous write is running unless waiting
 
   protected:
     std::pair<std::size_t, std::size_t> getRomBanks() const;  // Get ROM banks
@@ -43,12 +63,18 @@ namespace GBC
     virtual std::uint8_t  readRom(std::uint16_t address) const; // Read ROM
     virtual std::uint8_t  readRam(std::uint16_t address) const; // Read RAM
 
+    std::size_t getRomIndex(std::uint16_t address) const; // Get index in raw ROM of address
+    std::size_t getRomSize() const;                       // Get size of raw ROM
+
+    virtual const std::uint8_t* getRomPage(std::uint16_t address) const;  // Get 256 bytes ROM page of address, nullptr if not directly readable
+    virtual std::uint8_t*       getRamPage(std::uint16_t address, bool write);  // Get 256 bytes RAM page of address, nullptr if not directly readable, or writable as battery RAM writes are tracked
+
     virtual void  writeRom(std::uint16_t address, std::uint8_t value);  // Write to MBC registers
     virtual void  writeRam(std::uint16_t address, std::uint8_t value);  // Write to RAM
 
-    virtual void  save(std::ofstream& file) const;  // Save state to file
-    virtual void  load(std::ifstream& file);        // Load state from file
+    virtual void  save(GBC::SaveState& state) const;  // Save state
+    virtual void  load(GBC::LoadState& state);        // Load state
 
-    virtual void  update(std::size_t ticks);  // Update internal clock (MBC3)
+    virtual void  update(std::size_t ticks);  // Update internal clock (MBC3) and flush battery RAM at bounded rate
   };
 }
\ No newline at end of file
@@ -47,20 +47,20 @@ void  GBC::MemoryBankController1::writeRom(std::uint16_t address, std::uint8_t v
   }
 }
 
-void    GBC::MemoryBankController1::save(std::ofstream& file) const
+void    GBC::MemoryBankController1::save(GBC::SaveState& state) const
 {
   // Save MBC variables
-  GBC::MemoryBankController::save(file);
+  GBC::MemoryBankController::save(state);
 
   // Save MBC1 variables
-  _gbc.save(file, "MBC1_BANK", _bank);
+  _gbc.save(state, "MBC1_BANK", _bank);
 }
 
-void    GBC::MemoryBankController1::load(std::ifstream& file)
+void    GBC::MemoryBankController1::load(GBC::LoadState& state)
 {
   // Load MBC variables
-  GBC::MemoryBankController::load(file);
+  GBC::MemoryBankController::load(state);
 
   // Load MBC1 variables
-  _gbc.load(file, "MBC1_BANK", _bank);
+  _gbc.load(state, "MBC1_BANK", _bank);
 }
\ No newline at end of file
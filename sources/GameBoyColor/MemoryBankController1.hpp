@@ -19,7 +19,7 @@ namespace GBC
 
     virtual void  writeRom(std::uint16_t address, std::uint8_t value) override; // Write to MBC1 registers
 
-    virtual void  save(std::ofstream& file) const override; // Save state to file
-    virtual void  load(std::ifstream& file) override;       // Load state from file
+    virtual void  save(GBC::SaveState& state) const override; // Save state
+    virtual void  load(GBC::LoadState& state) override;       // Load state
   };
 }
\ No newline at end of file
@@ -100,6 +100,16 @@ void  GBC::MemoryBankController3::writeRom(std::uint16_t address, std::uint8_t v
   }
 }
 
+std::uint8_t* GBC::MemoryBankController3::getRamPage(std::uint16_t address, bool write)
+{
+  // RTC registers are not memory
+  if (getRamBank() >= 0x04)
+    return nullptr;
+
+  // Get RAM page
+  return GBC::MemoryBankController::getRamPage(address, write);
+}
+
 void  GBC::MemoryBankController3::writeRam(std::uint16_t address, std::uint8_t value)
 {
 #ifdef _DEBUG
@@ -226,34 +236,37 @@ void  GBC::MemoryBankController3::saveRtc()
   }
 }
 
-void    GBC::MemoryBankController3::save(std::ofstream& file) const
+void    GBC::MemoryBankController3::save(GBC::SaveState& state) const
 {
   // Save MBC variables
-  GBC::MemoryBankController::save(file);
+  GBC::MemoryBankController::save(state);
 
   // Save MBC3 variables
-  _gbc.save(file, "MBC3_RTCTIME", _rtcTime);
-  _gbc.save(file, "MBC3_RTCCLOCK", _rtcClock);
-  _gbc.save(file, "MBC3_RTCREGISTER", _rtcRegister);
-  _gbc.save(file, "MBC3_RTCLATCH", _rtcLatch);
-  _gbc.save(file, "MBC3_RTCHALT", _rtcHalt);
+  _gbc.save(state, "MBC3_RTCTIME", _rtcTime);
+  _gbc.save(state, "MBC3_RTCCLOCK", _rtcClock);
+  _gbc.save(state, "MBC3_RTCREGISTER", _rtcRegister);
+  _gbc.save(state, "MBC3_RTCLATCH", _rtcLatch);
+  _gbc.save(state, "MBC3_RTCHALT", _rtcHalt);
 }
 
-void    GBC::MemoryBankController3::load(std::ifstream& file)
+void    GBC::MemoryBankController3::load(GBC::LoadState& state)
 {
   // Load MBC variables
-  GBC::MemoryBankController::load(file);
+  GBC::MemoryBankController::load(state);
 
   // Load MBC3 variables
-  _gbc.load(file, "MBC3_RTCTIME", _rtcTime);
-  _gbc.load(file, "MBC3_RTCCLOCK", _rtcClock);
-  _gbc.load(file, "MBC3_RTCREGISTER", _rtcRegister);
-  _gbc.load(file, "MBC3_RTCLATCH", _rtcLatch);
-  _gbc.load(file, "MBC3_RTCHALT", _rtcHalt);
+  _gbc.load(state, "MBC3_RTCTIME", _rtcTime);
+  _gbc.load(state, "MBC3_RTCCLOCK", _rtcClock);
+  _gbc.load(state, "MBC3_RTCREGISTER", _rtcRegister);
+  _gbc.load(state, "MBC3_RTCLATCH", _rtcLatch);
+  _gbc.load(state, "MBC3_RTCHALT", _rtcHalt);
 }
 
 void    GBC::MemoryBankController3::update(std::size_t ticks)
 {
+  // Flush battery RAM
+  GBC::MemoryBankController::update(ticks);
+
   std::uint64_t clock = _rtcTime + ticks;
 
   // At least a second passed
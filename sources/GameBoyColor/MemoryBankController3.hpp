@@ -25,11 +25,13 @@ namespace GBC
 
     virtual std::uint8_t  readRam(std::uint16_t address) const override;  // Read RAM
 
+    virtual std::uint8_t* getRamPage(std::uint16_t address, bool write) override; // Get 256 bytes RAM page of address, nullptr when RTC registers are mapped
+
     virtual void  writeRom(std::uint16_t address, std::uint8_t value) override; // Write to MBC3 registers
     virtual void  writeRam(std::uint16_t address, std::uint8_t value) override; // Write to MBC3 RAM or RTC register
 
-    virtual void  save(std::ofstream& file) const override; // Save state to file
-    virtual void  load(std::ifstream& file) override;       // Load state from file
+    virtual void  save(GBC::SaveState& state) const override; // Save state
+    virtual void  load(GBC::LoadState& state) override;       // Load state
 
     virtual void  update(std::size_t ticks) override; // Update internal clock
   };
@@ -1,58 +1,107 @@
+#include <algorithm>
 #include <cstring>
+#include <limits>
 #include <stdexcept>
 #include <string>
 
 #include "GameBoyColor/GameBoyColor.hpp"
 #include "GameBoyColor/PixelProcessingUnit.hpp"
 
-GBC::PixelProcessingUnit::PixelProcessingUnit(GBC::GameBoyColor& gbc, sf::Texture& texture, Math::Vector<2, unsigned int> origin) :
+GBC::PixelProcessingUnit::PixelProcessingUnit(GBC::GameBoyColor& gbc, sf::Texture* texture, Math::Vector<2, unsigned int> origin) :
   _gbc(gbc),
   _ram{ 0 },
   _bgc{ 0 },
   _obc{ 0 },
   _oam{ 0 },
   _interrupt(false),
+  _renderer(Renderer::RendererScanline),
+  _scanline(false),
+  _scanlineEnd(0),
+  _scanlineWindow(false),
+  _timingKey{ 0, 0, 0, 0xFF },
+  _timingDuration(0),
+  _timingWindow(false),
   _sprites(),
   _cycles(0),
-  _image(),
+  _pixels(GBC::PixelProcessingUnit::ScreenWidth * GBC::PixelProcessingUnit::ScreenHeight * 4, 0xFF),
   _texture(texture),
-  _origin(origin)
+  _origin(origin),
+  _skip(false),
+  _skipRequest(false),
+  _emulated(0),
+  _presented(0)
 {
-  // Allocate image memory buffer
-  _image.resize({ GBC::PixelProcessingUnit::ScreenWidth, GBC::PixelProcessingUnit::ScreenHeight }, sf::Color::White);
+
+  // No texture when headless
+  if (_texture == nullptr)
+    return;
 
   // Check texture size
-  if (ScreenWidth + origin.x() > _texture.getSize().x || ScreenHeight + origin.y() > _texture.getSize().y)
+  if (ScreenWidth + origin.x() > _texture->getSize().x || ScreenHeight + origin.y() > _texture->getSize().y)
     throw std::runtime_error((std::string(__FILE__) + ": l." + std::to_string(__LINE__)).c_str());
 
   // White image
-  _texture.update(_image, sf::Vector2u(_origin.x(), _origin.y()));
+  _texture->update(_pixels.data(), sf::Vector2u(ScreenWidth, ScreenHeight), sf::Vector2u(_origin.x(), _origin.y()));
 }
 
-void  GBC::PixelProcessingUnit::simulate()
+void  GBC::PixelProcessingUnit::simulate(std::size_t ticks)
 {
   // Does nothing when PPU is disabled
   if (!(_gbc._io[IO::LCDC] & LcdControl::LcdControlEnable))
     return;
 
-  constexpr std::array<void(GBC::PixelProcessingUnit::*)(), LcdMode::LcdModeCount> modes = {
+  static constexpr std::array<std::size_t(GBC::PixelProcessingUnit::*)(std::size_t), LcdMode::LcdModeCount> modes = {
     &GBC::PixelProcessingUnit::simulateMode0,
     &GBC::PixelProcessingUnit::simulateMode1,
     &GBC::PixelProcessingUnit::simulateMode2,
     &GBC::PixelProcessingUnit::simulateMode3
   };
 
-  // Call PPU mode handler
-  (*this.*(modes[getMode() % LcdMode::LcdModeCount]))();
+  // Mode handlers consume ticks up to their next event
+  while (ticks > 0)
+  {
+    std::uint8_t  status = _gbc._io[IO::STAT];
+
+    // Call PPU mode handler
+    ticks -= (*this.*(modes[getMode() % LcdMode::LcdModeCount]))(ticks);
 
-  // Check STAT interrupt
-  simulateInterrupt();
+    // Check STAT interrupt, only when mode or LY=LYC flag changed
+    if (_gbc._io[IO::STAT] != status)
+      simulateInterrupt();
+  }
 }
 
-void  GBC::PixelProcessingUnit::simulateMode0()
+std::size_t GBC::PixelProcessingUnit::next() const
 {
-  // Next cycle
-  _cycles += 1;
+  // No event when PPU is disabled
+  if (!(_gbc._io[IO::LCDC] & LcdControl::LcdControlEnable))
+    return std::numeric_limits<std::size_t>::max();
+
+  switch (getMode())
+  {
+    // End of line
+  case LcdMode::LcdMode0:
+  case LcdMode::LcdMode1:
+    return GBC::PixelProcessingUnit::ScanlineDuration - _cycles % GBC::PixelProcessingUnit::ScanlineDuration;
+
+    // End of OAM search
+  case LcdMode::LcdMode2:
+    return GBC::PixelProcessingUnit::Mode2Duration - _cycles % GBC::PixelProcessingUnit::ScanlineDuration;
+
+    // End of drawing, known in advance only with scanline renderer
+  case LcdMode::LcdMode3:
+    return (_scanline == true) ? _scanlineEnd - _cycles : 1;
+
+  default:
+    throw std::runtime_error((std::string(__FILE__) + ": l." + std::to_string(__LINE__)).c_str());
+  }
+}
+
+std::size_t GBC::PixelProcessingUnit::simulateMode0(std::size_t ticks)
+{
+  // Skip to end of line
+  ticks = std::min(ticks, GBC::PixelProcessingUnit::ScanlineDuration - _cycles % GBC::PixelProcessingUnit::ScanlineDuration);
+  _cycles += ticks;
 
   // Next mode
   if (_cycles % GBC::PixelProcessingUnit::ScanlineDuration == 0)
@@ -71,16 +120,32 @@ void  GBC::PixelProcessingUnit::simulateMode0()
       // VBlank interrupt
       _gbc._io[GBC::GameBoyColor::IO::IF] |= GBC::GameBoyColor::Interrupt::InterruptVBlank;
 
-      // Send texture to VRAM for display
-      _texture.update(_image, sf::Vector2u(_origin.x(), _origin.y()));
+      // Send texture to VRAM for display, skipped when headless or frame not drawn
+      if (_texture != nullptr && _skip == false) {
+        GBC::Profile::Scope scope(_gbc._profile, GBC::Profile::Subsystem::SubsystemUpload);
+
+        _texture->update(_pixels.data(), sf::Vector2u(ScreenWidth, ScreenHeight), sf::Vector2u(_origin.x(), _origin.y()));
+        if (_gbc._discard == false)
+          _presented += 1;
+      }
+
+      // Frames simulated ahead are discarded
+      if (_gbc._discard == false)
+        _emulated += 1;
+
+      // Frame-skip request applies to whole next frame
+      _skip = _skipRequest;
     }
   }
+
+  return ticks;
 }
 
-void  GBC::PixelProcessingUnit::simulateMode1()
+std::size_t GBC::PixelProcessingUnit::simulateMode1(std::size_t ticks)
 {
-  // Next cycle
-  _cycles += 1;
+  // Skip to end of line
+  ticks = std::min(ticks, GBC::PixelProcessingUnit::ScanlineDuration - _cycles % GBC::PixelProcessingUnit::ScanlineDuration);
+  _cycles += ticks;
 
   // Next mode
   if (_cycles % GBC::PixelProcessingUnit::ScanlineDuration == 0)
@@ -92,9 +157,11 @@ void  GBC::PixelProcessingUnit::simulateMode1()
     if (getLine() == 0)
       setMode(LcdMode::LcdMode2);
   }
+
+  return ticks;
 }
 
-void  GBC::PixelProcessingUnit::simulateMode2()
+std::size_t GBC::PixelProcessingUnit::simulateMode2(std::size_t ticks)
 {
   // Process all OBJ at once
   if (_cycles % GBC::PixelProcessingUnit::ScanlineDuration == 0)
@@ -129,15 +196,24 @@ void  GBC::PixelProcessingUnit::simulateMode2()
       std::sort(_sprites.begin(), _sprites.end(), [](const auto& a, const auto& b) { return a.x < b.x; });
   }
 
-  // Next cycle
-  _cycles += 1;
+  // Skip to end of OAM search
+  ticks = std::min(ticks, GBC::PixelProcessingUnit::Mode2Duration - _cycles % GBC::PixelProcessingUnit::ScanlineDuration);
+  _cycles += ticks;
 
   // Next mode
-  if (_cycles % GBC::PixelProcessingUnit::ScanlineDuration == GBC::PixelProcessingUnit::Mode2Duration)
+  if (_cycles % GBC::PixelProcessingUnit::ScanlineDuration == GBC::PixelProcessingUnit::Mode2Duration) {
     setMode(LcdMode::LcdMode3);
+
+    // Draw line at once unless registers change
+    _scanline = (_renderer == Renderer::RendererScanline);
+    if (_scanline == true)
+      simulateMode3Timing();
+  }
+
+  return ticks;
 }
 
-void  GBC::PixelProcessingUnit::simulateMode3()
+std::size_t GBC::PixelProcessingUnit::simulateMode3(std::size_t ticks)
 {
   // Reset Mode3 datas at start of line
   if (_cycles % GBC::PixelProcessingUnit::ScanlineDuration == GBC::PixelProcessingUnit::Mode2Duration) {
@@ -152,6 +228,10 @@ void  GBC::PixelProcessingUnit::simulateMode3()
     _sWait = 0;
   }
 
+  // Scanline renderer, pixel FIFO is not used
+  if (_scanline == true)
+    return simulateMode3Scanline(ticks);
+
   // Start to draw window
   if (((_lx == 0) ? (_lx + 7 >= _gbc._io[IO::WX]) : (_lx + 7 == _gbc._io[IO::WX])) &&
     _wFlagX == false && _wFlagY == true &&
@@ -200,6 +280,8 @@ void  GBC::PixelProcessingUnit::simulateMode3()
 
   // Next cycle
   _cycles += 1;
+
+  return 1;
 }
 
 void  GBC::PixelProcessingUnit::simulateMode3Draw()
@@ -235,61 +317,17 @@ void  GBC::PixelProcessingUnit::simulateMode3Draw()
     if (_sFifo.empty() == false)
       _sFifo.pop();
 
-    bool      bwEnable = !(_gbc._io[GBC::GameBoyColor::IO::KEY0] & 0b00001100) || (_gbc._io[IO::LCDC] & LcdControl::LcdControlWindowBackgroundEnable);
-    bool      sEnable = sPixel.color != 0;
-
-    // Background and Window Master Priority, CGB mode only
-    if (bwEnable == true &&
-      sEnable == true &&
-      (_gbc._io[GBC::GameBoyColor::IO::KEY0] & 0b00001100) &&
-      !(_gbc._io[IO::LCDC] & LcdControl::LcdControlPriority))
-      bwEnable = false;
-
-    // Sprite priority over background and window
-    else if (bwEnable == true &&
-      sEnable == true &&
-      ((bwPixel.attributes & BackgroundAttributes::BackgroundAttributesPriority) || (sPixel.attributes & SpriteAttributes::SpriteAttributesOverObj)) &&
-      bwPixel.color != 0)
-      sEnable = false;
-
-    GBC::PixelProcessingUnit::Color color;
-    
-    // Select Sprite color
-    if (sEnable == true)
-    {
-      // DMG color palette conversion
-      if (_gbc._io[GBC::GameBoyColor::IO::KEY0] & 0b00001100) {
-        if (sPixel.attributes & SpriteAttributes::SpriteAttributesPaletteNonCgb) {
-          sPixel.color = (_gbc._io[IO::OBP1] >> (sPixel.color * 2)) & 0b00000011;
-          sPixel.palette = 1;
-        }
-        else {
-          sPixel.color = (_gbc._io[IO::OBP0] >> (sPixel.color * 2)) & 0b00000011;
-          sPixel.palette = 0;
-        }
-      }
+    // Set pixel color
+    auto  color = getColor(bwPixel, sPixel);
 
-      // Get color from Sprite color palettes
-      color = _obc.colors[sPixel.palette * 4 + sPixel.color];
-    }
+    if (_skip == false) {
+      std::uint8_t* pixel = _pixels.data() + ((std::size_t)getLine() * GBC::PixelProcessingUnit::ScreenWidth + _lx) * 4;
 
-    // Select Background/Window color
-    else if (bwEnable == true)
-    {
-      // DMG color palette conversion
-      if (_gbc._io[GBC::GameBoyColor::IO::KEY0] & 0b00001100)
-        bwPixel.color = (_gbc._io[IO::BGP] >> (bwPixel.color * 2)) & 0b00000011;
-
-      // Get color from Background/Window color palettes
-      color = _bgc.colors[bwPixel.palette * 4 + bwPixel.color];
+      pixel[0] = color.red();
+      pixel[1] = color.green();
+      pixel[2] = color.blue();
+      pixel[3] = 255;
     }
-
-    // Default to white
-    else
-      color.raw = 0b0111111111111111;
-
-    // Set pixel color
-    _image.setPixel({ (unsigned int)_lx, (unsigned int)getLine() }, sf::Color(color.red(), color.green(), color.blue()));
     
     // Next pixel
     _lx += 1;
@@ -417,6 +455,336 @@ void  GBC::PixelProcessingUnit::simulateMode3Sprites()
         sprite.x = 255;
 }
 
+std::size_t GBC::PixelProcessingUnit::simulateMode3Scanline(std::size_t ticks)
+{
+  // Skip to end of line drawing, as computed at start of mode 3
+  ticks = std::min(ticks, _scanlineEnd - _cycles);
+  _cycles += ticks;
+
+  if (_cycles < _scanlineEnd)
+    return ticks;
+
+  // Draw line, unless frame is skipped
+  if (_skip == false)
+    simulateMode3Line();
+
+  // Go to HBlank
+  setMode(LcdMode::LcdMode0);
+
+  // Increase window line counter
+  if (_scanlineWindow == true)
+    _wY += 1;
+
+  // Back to pixel FIFO for next line
+  _scanline = false;
+
+  return ticks;
+}
+
+void  GBC::PixelProcessingUnit::simulateMode3Line()
+{
+  std::array<GBC::PixelProcessingUnit::PixelFifo::Pixel, GBC::PixelProcessingUnit::ScreenWidth + 16> sprites;
+
+  // Clear Sprites pixels, with 8 pixels margin on each side
+  sprites.fill({ .color = 0, .palette = 0, .attributes = 0, .priority = 255 });
+
+  // Merge sprites pixels, lowest index has priority
+  if (_gbc._io[IO::LCDC] & LcdControl::LcdControlObjEnable) {
+    for (auto iterator = 0; iterator < _sprites.size(); iterator++)
+    {
+      const auto&   sprite = _sprites[iterator];
+      std::uint8_t  tile_y = getLine() - sprite.y + 16;
+      std::uint8_t  tile_height = (_gbc._io[IO::LCDC] & LcdControl::LcdControlObjSize) ? 16 : 8;
+
+      // Flip sprite Y coordinates
+      if (sprite.attributes & SpriteAttributes::SpriteAttributesYFlip)
+        tile_y = (tile_height - 1) - tile_y % tile_height;
+
+      std::uint8_t  sp_tile_id = sprite.tile & ((tile_height == 8) ? 0b11111111 : 0b11111110);
+      std::uint16_t sp_tile_index = ((std::uint16_t)sp_tile_id * 16);
+
+      std::uint8_t  tile_low = _ram[(sprite.attributes & SpriteAttributes::SpriteAttributesBank) ? 1 : 0][sp_tile_index + tile_y * 2 + 0];
+      std::uint8_t  tile_high = _ram[(sprite.attributes & SpriteAttributes::SpriteAttributesBank) ? 1 : 0][sp_tile_index + tile_y * 2 + 1];
+
+      // Register pixels according to X flip attribute
+      for (std::uint8_t index = 0; index < 8; index += 1) {
+        std::uint8_t  x = (sprite.attributes & SpriteAttributes::SpriteAttributesXFlip) ? (7 - index) : (index);
+
+        PixelFifo::Pixel  pixel = {
+          .color = (std::uint8_t)(((tile_low & (0b10000000 >> x)) ? 0b01 : 0b00) + ((tile_high & (0b10000000 >> x)) ? 0b10 : 0b00)),
+          .palette = (std::uint8_t)(sprite.attributes & SpriteAttributes::SpriteAttributesPaletteCgb),
+          .attributes = sprite.attributes,
+          .priority = (std::uint8_t)iterator
+        };
+
+        // Sprite X coordinate is offset by 8, as sprites buffer
+        if (sprite.x + index >= sprites.size())
+          break;
+
+        auto& target = sprites[sprite.x + index];
+
+        // Merge pixel in line
+        if (pixel.color != 0 && (pixel.priority < target.priority || target.color == 0))
+          target = pixel;
+      }
+    }
+  }
+
+  unsigned int  wx = _gbc._io[IO::WX];
+  unsigned int  wStart = GBC::PixelProcessingUnit::ScreenWidth;
+
+  // First pixel of window, out of screen when not triggered
+  if (_scanlineWindow == true)
+    wStart = std::min(std::max(wx, 7U) - 7, GBC::PixelProcessingUnit::ScreenWidth);
+
+  std::uint16_t tile_index = 0;
+  std::uint8_t  tile_attributes = 0;
+  std::uint8_t  tile_low = 0;
+  std::uint8_t  tile_high = 0;
+
+  // Write line directly in image buffer
+  std::uint8_t* pixels = _pixels.data() + (std::size_t)getLine() * GBC::PixelProcessingUnit::ScreenWidth * 4;
+
+  // Draw every pixel of the line
+  for (unsigned int lx = 0; lx < GBC::PixelProcessingUnit::ScreenWidth; lx++)
+  {
+    // X coordinate in window or background
+    std::uint8_t  x = (lx >= wStart) ? (lx + 7 - wx) : (_gbc._io[IO::SCX] + lx);
+
+    // Fetch a new tile at start of line, window or tile
+    if (lx == 0 || lx == wStart || x % 8 == 0)
+    {
+      std::uint8_t  tile_y = 0;
+      std::uint16_t tilemap = 0x0000;
+      std::uint16_t tilemap_id = 0;
+
+      // Window pixels data
+      if (lx >= wStart) {
+        tile_y = _wY;
+        tilemap = (_gbc._io[IO::LCDC] & LcdControl::LcdControlWindowTilemap) ? 0x1C00 : 0x1800;
+        tilemap_id = ((std::uint16_t)tile_y / 8) * 32 + ((std::uint16_t)x / 8) % 32;
+      }
+
+      // Background pixels data
+      else {
+        tile_y = getLine() + _gbc._io[IO::SCY];
+        tilemap = (_gbc._io[IO::LCDC] & LcdControl::LcdControlBackgroundTilemap) ? 0x1C00 : 0x1800;
+        tilemap_id = ((std::uint16_t)tile_y / 8) * 32 + ((std::uint16_t)x / 8) % 32;
+      }
+
+      std::uint8_t  tile_id = _ram[0][tilemap + tilemap_id];
+
+      tile_attributes = _ram[1][tilemap + tilemap_id];
+      tile_index = ((std::uint16_t)tile_id * 16)
+        + (((_gbc._io[IO::LCDC] & LcdControl::LcdControlData)) ?
+          0x0000 :
+          ((tile_id < 128) ? 0x1000 : 0x0000));
+
+      // Flip Y tile coordinates
+      tile_y = (tile_attributes & BackgroundAttributes::BackgroundAttributesYFlip) ? (~tile_y & 0b00000111) : (tile_y & 0b00000111);
+
+      tile_low = _ram[(tile_attributes & BackgroundAttributes::BackgroundAttributesBank) ? 1 : 0][tile_index + (tile_y % 8) * 2 + 0];
+      tile_high = _ram[(tile_attributes & BackgroundAttributes::BackgroundAttributesBank) ? 1 : 0][tile_index + (tile_y % 8) * 2 + 1];
+    }
+
+    std::uint8_t  index = (tile_attributes & BackgroundAttributes::BackgroundAttributesXFlip) ? (7 - x % 8) : (x % 8);
+
+    PixelFifo::Pixel  bwPixel = {
+      .color = (std::uint8_t)(((tile_low & (0b10000000 >> index)) ? 0b01 : 0b00) + ((tile_high & (0b10000000 >> index)) ? 0b10 : 0b00)),
+      .palette = (std::uint8_t)(tile_attributes & BackgroundAttributes::BackgroundAttributesPalette),
+      .attributes = tile_attributes,
+      .priority = 0
+    };
+
+    // Set pixel color
+    auto  color = getColor(bwPixel, sprites[lx + 8]);
+
+    pixels[lx * 4 + 0] = color.red();
+    pixels[lx * 4 + 1] = color.green();
+    pixels[lx * 4 + 2] = color.blue();
+    pixels[lx * 4 + 3] = 255;
+  }
+}
+
+void  GBC::PixelProcessingUnit::simulateMode3Timing()
+{
+  decltype(_timingKey)  key = { 0 };
+
+  // Parameters of pixel FIFO timings
+  key[0] = _gbc._io[IO::SCX] % 8;
+  key[1] = (_wFlagY == true && (_gbc._io[IO::LCDC] & LcdControl::LcdControlWindowEnable)) ? 1 : 0;
+  key[2] = _gbc._io[IO::WX];
+  key[3] = (_gbc._io[IO::LCDC] & LcdControl::LcdControlObjEnable) ? (std::uint8_t)std::min<std::size_t>(_sprites.size(), GBC::PixelProcessingUnit::SpriteLimit) : 0;
+  for (std::size_t index = 0; index < key[3]; index++)
+    key[4 + index] = _sprites[index].x;
+
+  // Compute duration only when parameters differ from previous line
+  if (key != _timingKey)
+  {
+    _timingKey = key;
+    _timingDuration = simulateMode3Timing(key, _timingWindow);
+  }
+
+  // Mode 3 ends on the same cycle as pixel FIFO
+  _scanlineEnd = _cycles - _cycles % GBC::PixelProcessingUnit::ScanlineDuration + GBC::PixelProcessingUnit::Mode2Duration + _timingDuration;
+  _scanlineWindow = _timingWindow;
+}
+
+std::size_t GBC::PixelProcessingUnit::simulateMode3Timing(const std::array<std::uint8_t, 4 + GBC::PixelProcessingUnit::SpriteLimit>& key, bool& window) const
+{
+  std::array<std::uint8_t, GBC::PixelProcessingUnit::SpriteLimit>  sprites = { 0 };
+
+  // Copy X coordinate of sprites of the line, as they are consumed
+  for (std::size_t index = 0; index < key[3]; index++)
+    sprites[index] = key[4 + index];
+
+  unsigned int  lx = 0;
+  unsigned int  bwSize = 0;
+  unsigned int  bwOffset = key[0];
+  unsigned int  bwWait = 0;
+  unsigned int  sOffset = 0;
+  unsigned int  sWait = 0;
+  std::size_t   cycles = 0;
+
+  window = false;
+
+  // Run pixel FIFO state machine without fetching pixels
+  for (;; cycles++)
+  {
+    // Start to draw window
+    if (((lx == 0) ? (lx + 7 >= key[2]) : (lx + 7 == key[2])) &&
+      window == false && key[1] == 1) {
+      window = true;
+      bwSize = 0;
+      bwOffset = lx + 7 - key[2];
+      bwWait = 6;
+    }
+
+    // Only work when in screen
+    if (lx < GBC::PixelProcessingUnit::ScreenWidth)
+    {
+      // Fetch background/window pixels
+      if (bwSize <= 16 && bwWait == 0) {
+        bwSize += 8;
+        bwWait = 6;
+      }
+
+      // Fetch sprites pixels
+      if (sWait == 0) {
+        for (std::size_t index = 0; index < key[3]; index++) {
+          if (sprites[index] <= lx + 8) {
+            sOffset = std::max<int>(sOffset, (int)lx - (int)sprites[index] + 8);
+            sWait = (sprites[index] == 0) ? (0) : (11 - std::min(5, (sprites[index] + key[0]) % 8));
+            sprites[index] = 255;
+            break;
+          }
+        }
+      }
+
+      // Pop a pixel from the FIFOs
+      if (bwSize > 16 && sWait == 0) {
+        if (bwOffset > 0 || sOffset > 0) {
+          if (bwOffset > 0) {
+            bwOffset -= 1;
+            bwSize -= 1;
+          }
+          if (sOffset > 0)
+            sOffset -= 1;
+        }
+        else {
+          bwSize -= 1;
+          lx += 1;
+        }
+      }
+    }
+
+    // Decrement fetchers timers
+    if (bwWait > 0)
+      bwWait -= 1;
+    if (sWait > 0)
+      sWait -= 1;
+
+    // End of line drawing
+    if (lx >= GBC::PixelProcessingUnit::ScreenWidth && bwWait == 0)
+      break;
+  }
+
+  return cycles + 1;
+}
+
+void  GBC::PixelProcessingUnit::simulateMode3Fallback()
+{
+  // Only when current line is drawn by scanline renderer
+  if (_scanline == false || getMode() != LcdMode::LcdMode3)
+    return;
+
+  std::size_t cycles = _cycles;
+
+  // Replay pixel FIFO from start of mode 3, registers are unchanged until now
+  _scanline = false;
+  _cycles = _cycles - _cycles % GBC::PixelProcessingUnit::ScanlineDuration + GBC::PixelProcessingUnit::Mode2Duration;
+  while (_cycles < cycles && getMode() == LcdMode::LcdMode3)
+    simulateMode3(1);
+}
+
+GBC::PixelProcessingUnit::Color GBC::PixelProcessingUnit::getColor(PixelFifo::Pixel bwPixel, PixelFifo::Pixel sPixel) const
+{
+  bool      bwEnable = !(_gbc._io[GBC::GameBoyColor::IO::KEY0] & 0b00001100) || (_gbc._io[IO::LCDC] & LcdControl::LcdControlWindowBackgroundEnable);
+  bool      sEnable = sPixel.color != 0;
+
+  // Background and Window Master Priority, CGB mode only
+  if (bwEnable == true &&
+    sEnable == true &&
+    (_gbc._io[GBC::GameBoyColor::IO::KEY0] & 0b00001100) &&
+    !(_gbc._io[IO::LCDC] & LcdControl::LcdControlPriority))
+    bwEnable = false;
+
+  // Sprite priority over background and window
+  else if (bwEnable == true &&
+    sEnable == true &&
+    ((bwPixel.attributes & BackgroundAttributes::BackgroundAttributesPriority) || (sPixel.attributes & SpriteAttributes::SpriteAttributesOverObj)) &&
+    bwPixel.color != 0)
+    sEnable = false;
+
+  GBC::PixelProcessingUnit::Color color;
+  
+  // Select Sprite color
+  if (sEnable == true)
+  {
+    // DMG color palette conversion
+    if (_gbc._io[GBC::GameBoyColor::IO::KEY0] & 0b00001100) {
+      if (sPixel.attributes & SpriteAttributes::SpriteAttributesPaletteNonCgb) {
+        sPixel.color = (_gbc._io[IO::OBP1] >> (sPixel.color * 2)) & 0b00000011;
+        sPixel.palette = 1;
+      }
+      else {
+        sPixel.color = (_gbc._io[IO::OBP0] >> (sPixel.color * 2)) & 0b00000011;
+        sPixel.palette = 0;
+      }
+    }
+
+    // Get color from Sprite color palettes
+    color = _obc.colors[sPixel.palette * 4 + sPixel.color];
+  }
+
+  // Select Background/Window color
+  else if (bwEnable == true)
+  {
+    // DMG color palette conversion
+    if (_gbc._io[GBC::GameBoyColor::IO::KEY0] & 0b00001100)
+      bwPixel.color = (_gbc._io[IO::BGP] >> (bwPixel.color * 2)) & 0b00000011;
+
+    // Get color from Background/Window color palettes
+    color = _bgc.colors[bwPixel.palette * 4 + bwPixel.color];
+  }
+
+  // Default to white
+  else
+    color.raw = 0b0111111111111111;
+
+  return color;
+}
+
 void  GBC::PixelProcessingUnit::simulateInterrupt()
 {
   bool  old = _interrupt;
@@ -435,56 +803,116 @@ void  GBC::PixelProcessingUnit::simulateInterrupt()
     _gbc._io[GBC::GameBoyColor::IO::IF] |= GBC::GameBoyColor::Interrupt::InterruptLcdStat;
 }
 
+GBC::PixelProcessingUnit::Renderer GBC::PixelProcessingUnit::renderer() const
+{
+  // Get rendering method
+  return _renderer;
+}
+
+void  GBC::PixelProcessingUnit::renderer(GBC::PixelProcessingUnit::Renderer renderer)
+{
+  // Finish current line with pixel FIFO
+  if (renderer == Renderer::RendererFifo)
+    simulateMode3Fallback();
+
+  // Set rendering method
+  _renderer = renderer;
+}
+
 const sf::Texture&  GBC::PixelProcessingUnit::lcd() const
 {
+  // No rendering target when headless
+  if (_texture == nullptr)
+    throw std::runtime_error((std::string(__FILE__) + ": l." + std::to_string(__LINE__)).c_str());
+
   // Return rendering target
-  return _texture;
+  return *_texture;
+}
+
+const std::vector<std::uint8_t>&  GBC::PixelProcessingUnit::pixels() const
+{
+  // Return rendering target on RAM
+  return _pixels;
+}
+
+bool  GBC::PixelProcessingUnit::skip() const
+{
+  // Get frame-skip request
+  return _skipRequest;
 }
 
-void  GBC::PixelProcessingUnit::save(std::ofstream& file) const
+void  GBC::PixelProcessingUnit::skip(bool skip)
+{
+  // Applied at next VBlank, so frames are never partially drawn
+  _skipRequest = skip;
+}
+
+std::size_t GBC::PixelProcessingUnit::emulated() const
+{
+  // Get number of frames emulated
+  return _emulated;
+}
+
+std::size_t GBC::PixelProcessingUnit::presented() const
+{
+  // Get number of frames sent to rendering target
+  return _presented;
+}
+
+void  GBC::PixelProcessingUnit::save(GBC::SaveState& state) const
 {
   // Save PPU variables
-  _gbc.save(file, "PPU_RAM", _ram);
-  _gbc.save(file, "PPU_BGC", _bgc);
-  _gbc.save(file, "PPU_OBC", _obc);
-  _gbc.save(file, "PPU_OAM", _oam);
-  _gbc.save(file, "PPU_INTERRUPT", _interrupt);
-  _gbc.save(file, "PPU_SPRITES", _sprites);
-  _gbc.save(file, "PPU_CYCLES", _cycles);
-  _gbc.save(file, "PPU_LX", _lx);
-  _gbc.save(file, "PPU_BWFIFO", _bwFifo);
-  _gbc.save(file, "PPU_BWOFFSET", _bwOffset);
-  _gbc.save(file, "PPU_BWTILE", _bwTile);
-  _gbc.save(file, "PPU_BWWAIT", _bwWait);
-  _gbc.save(file, "PPU_WFLAGX", _wFlagX);
-  _gbc.save(file, "PPU_WFLAGY", _wFlagY);
-  _gbc.save(file, "PPU_WY", _wY);
-  _gbc.save(file, "PPU_SFIFO", _sFifo);
-  _gbc.save(file, "PPU_SOFFSET", _sOffset);
-  _gbc.save(file, "PPU_SWAIT", _sWait);
-}
-
-void  GBC::PixelProcessingUnit::load(std::ifstream& file)
+  _gbc.save(state, "PPU_RAM", _ram);
+  _gbc.save(state, "PPU_BGC", _bgc);
+  _gbc.save(state, "PPU_OBC", _obc);
+  _gbc.save(state, "PPU_OAM", _oam);
+  _gbc.save(state, "PPU_INTERRUPT", _interrupt);
+  _gbc.save(state, "PPU_SPRITES", _sprites);
+  _gbc.save(state, "PPU_CYCLES", _cycles);
+  _gbc.save(state, "PPU_LX", _lx);
+  _gbc.save(state, "PPU_BWFIFO", _bwFifo);
+  _gbc.save(state, "PPU_BWOFFSET", _bwOffset);
+  _gbc.save(state, "PPU_BWTILE", _bwTile);
+  _gbc.save(state, "PPU_BWWAIT", _bwWait);
+  _gbc.save(state, "PPU_WFLAGX", _wFlagX);
+  _gbc.save(state, "PPU_WFLAGY", _wFlagY);
+  _gbc.save(state, "PPU_WY", _wY);
+  _gbc.save(state, "PPU_SFIFO", _sFifo);
+  _gbc.save(state, "PPU_SOFFSET", _sOffset);
+  _gbc.save(state, "PPU_SWAIT", _sWait);
+  _gbc.save(state, "PPU_SCANLINE", _scanline);
+}
+
+void  GBC::PixelProcessingUnit::load(GBC::LoadState& state)
 {
   // Load PPU variables
-  _gbc.load(file, "PPU_RAM", _ram);
-  _gbc.load(file, "PPU_BGC", _bgc);
-  _gbc.load(file, "PPU_OBC", _obc);
-  _gbc.load(file, "PPU_OAM", _oam);
-  _gbc.load(file, "PPU_INTERRUPT", _interrupt);
-  _gbc.load(file, "PPU_SPRITES", _sprites);
-  _gbc.load(file, "PPU_CYCLES", _cycles);
-  _gbc.load(file, "PPU_LX", _lx);
-  _gbc.load(file, "PPU_BWFIFO", _bwFifo);
-  _gbc.load(file, "PPU_BWOFFSET", _bwOffset);
-  _gbc.load(file, "PPU_BWTILE", _bwTile);
-  _gbc.load(file, "PPU_BWWAIT", _bwWait);
-  _gbc.load(file, "PPU_WFLAGX", _wFlagX);
-  _gbc.load(file, "PPU_WFLAGY", _wFlagY);
-  _gbc.load(file, "PPU_WY", _wY);
-  _gbc.load(file, "PPU_SFIFO", _sFifo);
-  _gbc.load(file, "PPU_SOFFSET", _sOffset);
-  _gbc.load(file, "PPU_SWAIT", _sWait);
+  _gbc.load(state, "PPU_RAM", _ram);
+  _gbc.load(state, "PPU_BGC", _bgc);
+  _gbc.load(state, "PPU_OBC", _obc);
+  _gbc.load(state, "PPU_OAM", _oam);
+  _gbc.load(state, "PPU_INTERRUPT", _interrupt);
+  _gbc.load(state, "PPU_SPRITES", _sprites);
+  _gbc.load(state, "PPU_CYCLES", _cycles);
+  _gbc.load(state, "PPU_LX", _lx);
+  _gbc.load(state, "PPU_BWFIFO", _bwFifo);
+  _gbc.load(state, "PPU_BWOFFSET", _bwOffset);
+  _gbc.load(state, "PPU_BWTILE", _bwTile);
+  _gbc.load(state, "PPU_BWWAIT", _bwWait);
+  _gbc.load(state, "PPU_WFLAGX", _wFlagX);
+  _gbc.load(state, "PPU_WFLAGY", _wFlagY);
+  _gbc.load(state, "PPU_WY", _wY);
+  _gbc.load(state, "PPU_SFIFO", _sFifo);
+  _gbc.load(state, "PPU_SOFFSET", _sOffset);
+  _gbc.load(state, "PPU_SWAIT", _sWait);
+
+  // Missing in text states older than scanline renderer, line drawn by pixel FIFO
+  _scanline = false;
+  if (_gbc.loadExists(state, "PPU_SCANLINE") == true)
+    _gbc.load(state, "PPU_SCANLINE", _scanline);
+
+  // Recompute end of line of scanline renderer
+  if (_scanline == true)
+    simulateMode3Timing();
 }
 
 void  GBC::PixelProcessingUnit::setMode(GBC::PixelProcessingUnit::LcdMode mode)
@@ -742,6 +1170,39 @@ void  GBC::PixelProcessingUnit::writeDma(std::uint16_t address, std::uint8_t val
   _oam.raw[address] = value;
 
   // Sprite of current scanline are not displayed during DMA transfer
+  simulateMode3Fallback();
+  _sprites.clear();
+}
+
+void  GBC::PixelProcessingUnit::writeRam(std::uint16_t address, std::span<const std::uint8_t> values)
+{
+#ifdef _DEBUG
+  // Out of bound address, should not happen
+  if (address + values.size() > 0x2000)
+    throw std::runtime_error((std::string(__FILE__) + ": l." + std::to_string(__LINE__)).c_str());
+#endif
+
+  // Can't write during rendering
+  if (getMode() == LcdMode::LcdMode3)
+    return;
+
+  // Copy data to Video RAM
+  std::memcpy(_ram[_gbc._io[IO::VBK] & 0b00000001].data() + address, values.data(), values.size());
+}
+
+void  GBC::PixelProcessingUnit::writeDma(std::uint16_t address, std::span<const std::uint8_t> values)
+{
+#ifdef _DEBUG
+  // Out of bound address, should not happen
+  if (address + values.size() > sizeof(_oam))
+    throw std::runtime_error((std::string(__FILE__) + ": l." + std::to_string(__LINE__)).c_str());
+#endif
+
+  // Copy data to OAM
+  std::memcpy(_oam.raw.data() + address, values.data(), values.size());
+
+  // Sprite of current scanline are not displayed during DMA transfer
+  simulateMode3Fallback();
   _sprites.clear();
 }
 
@@ -750,6 +1211,9 @@ void  GBC::PixelProcessingUnit::writeIo(std::uint16_t address, std::uint8_t valu
   switch (address)
   {
   case IO::LCDC:  // LCD Control, R/W (see enum)
+    // Finish current line with pixel FIFO
+    simulateMode3Fallback();
+
     // Disabling PPU, stop
     if ((_gbc._io[IO::LCDC] & LcdControl::LcdControlEnable) && !(value & LcdControl::LcdControlEnable)) {
       // Reset PPU
@@ -762,14 +1226,16 @@ void  GBC::PixelProcessingUnit::writeIo(std::uint16_t address, std::uint8_t valu
       setMode(LcdMode::LcdMode0);
 
       // White image
-      std::memset((std::uint8_t*)_image.getPixelsPtr(), 0xFF, _image.getSize().x * _image.getSize().y * 4);
-      _texture.update(_image, sf::Vector2u(_origin.x(), _origin.y()));
+      std::fill(_pixels.begin(), _pixels.end(), 0xFF);
+      if (_texture != nullptr)
+        _texture->update(_pixels.data(), sf::Vector2u(ScreenWidth, ScreenHeight), sf::Vector2u(_origin.x(), _origin.y()));
     }
 
     // Enabling PPU, start
     else if (!(_gbc._io[IO::LCDC] & LcdControl::LcdControlEnable) && (value & LcdControl::LcdControlEnable)) {
-      // Start to draw
+      // Start to draw, frame-skip request applies from first frame
       setMode(LcdMode::LcdMode2);
+      _skip = _skipRequest;
 
       // Force immediate STAT interrupt check
       simulateInterrupt();
@@ -832,8 +1298,13 @@ void  GBC::PixelProcessingUnit::writeIo(std::uint16_t address, std::uint8_t valu
   case IO::BGP:   // Background and Window Palette Data, R/W, non CGB mode only
   case IO::OBP0:  // OBJ 0 Palette Data, R/W, non CGB mode only
   case IO::OBP1:  // OBJ 1 Palette Data, R/W, non CGB mode only
-  case IO::WY:    // Window Y Position, R/W
   case IO::WX:    // Window X Position, R/W
+    // Finish current line with pixel FIFO
+    simulateMode3Fallback();
+    _gbc._io[address] = value;
+    break;
+
+  case IO::WY:    // Window Y Position, R/W
   case IO::VBK:   // Video RAM Bank, R/W, CGB mode only
   case IO::BCPI:  // Background Color Palette Index, R/W, CGB mode only
   case IO::OCPI:  // OBJ Color Palette Index, R/W, CGB mode only
@@ -3,8 +3,9 @@
 #include <array>
 #include <cstdint>
 #include <list>
+#include <span>
+#include <vector>
 
-#include <SFML/Graphics/Image.hpp>
 #include <SFML/Graphics/Texture.hpp>
 
 #include "Math/Vector.hpp"
@@ -12,6 +13,8 @@
 namespace GBC
 {
   class GameBoyColor;
+  struct LoadState;
+  struct SaveState;
 
   class PixelProcessingUnit
   {
@@ -83,6 +86,12 @@ namespace GBC
       LcdModeCount // Number of PPU mode
     };
 
+    enum Renderer
+    {
+      RendererFifo,     // Cycle-accurate pixel FIFO
+      RendererScanline  // Whole line drawn at end of mode 3, pixel FIFO used when registers change mid-line
+    };
+
     enum BackgroundAttributes : std::uint8_t
     {
       BackgroundAttributesPriority = 0b10000000,  // Background priority when set
@@ -173,6 +182,15 @@ namespace GBC
 
     bool  _interrupt;  // STAT interrupt line, interrupt triggered only from low-to-high
 
+    GBC::PixelProcessingUnit::Renderer  _renderer;        // Rendering method
+    bool                                _scanline;        // Current line is drawn by scanline renderer
+    std::size_t                         _scanlineEnd;     // Cycle of end of mode 3 for scanline renderer
+    bool                                _scanlineWindow;  // Window is triggered on current line
+
+    std::array<std::uint8_t, 4 + GBC::PixelProcessingUnit::SpriteLimit> _timingKey;      // Parameters of last mode 3 duration computed (SCX % 8, window, WX, sprites count and X), invalid count when empty
+    std::size_t                                                         _timingDuration; // Mode 3 duration for these parameters
+    bool                                                                _timingWindow;   // Window triggered for these parameters
+
     std::vector<GBC::PixelProcessingUnit::Sprite> _sprites; // Sprites to be drawn on the current line
     std::size_t                                   _cycles;  // Number of PPU cycle since first scanline
 
@@ -188,18 +206,29 @@ namespace GBC
     std::uint8_t  _sOffset;   // Number of Sprites pixel to discard
     std::uint8_t  _sWait;     // Sprites pixels fetcher wait time
 
-    sf::Image                     _image;   // Rendering target on RAM
-    sf::Texture&                  _texture; // Rendering target in GPU
-    Math::Vector<2, unsigned int> _origin;  // Position in rendering target
+    std::vector<std::uint8_t>     _pixels;      // Rendering target on RAM, RGBA
+    sf::Texture*                  _texture;     // Rendering target in GPU, nullptr when headless
+    Math::Vector<2, unsigned int> _origin;      // Position in rendering target
+    bool                          _skip;        // Pixel output of current frame is skipped, timings are kept
+    bool                          _skipRequest; // Skip pixel output of frames starting after next VBlank
+    std::size_t                   _emulated;    // Number of frames emulated
+    std::size_t                   _presented;   // Number of frames sent to rendering target
     
-    void  simulateMode0(); // Simulate an horizontal blank tick
-    void  simulateMode1(); // Simulate a vertical blank tick
-    void  simulateMode2(); // Simulate a searching OAM tick
-    void  simulateMode3(); // Simulate a LCD Controller data transfer tick
+    std::size_t simulateMode0(std::size_t ticks);         // Simulate horizontal blank ticks, return number of ticks simulated
+    std::size_t simulateMode1(std::size_t ticks);         // Simulate vertical blank ticks, return number of ticks simulated
+    std::size_t simulateMode2(std::size_t ticks);         // Simulate searching OAM ticks, return number of ticks simulated
+    std::size_t simulateMode3(std::size_t ticks);         // Simulate LCD Controller data transfer ticks, return number of ticks simulated
+    std::size_t simulateMode3Scanline(std::size_t ticks); // Wait for end of mode 3 and draw the whole line at once
+    void        simulateMode3Line();                      // Draw the whole line at once in pixel buffer
 
     void  simulateMode3Draw();              // Pop pixels from Background/Window and Sprite FIFO and draw to screen
     void  simulateMode3BackgroundWindow();  // Fetch pixels for Background/Window FIFO
     void  simulateMode3Sprites();           // Fetch pixels for Sprites FIFO
+    void  simulateMode3Timing();            // Compute end of mode 3 of current line, as pixel FIFO would
+    void  simulateMode3Fallback();          // Replay pixel FIFO from start of line, before a register change
+
+    std::size_t                     simulateMode3Timing(const std::array<std::uint8_t, 4 + GBC::PixelProcessingUnit::SpriteLimit>& key, bool& window) const; // Run pixel FIFO state machine without fetching pixels, return mode 3 duration
+    GBC::PixelProcessingUnit::Color getColor(PixelFifo::Pixel bwPixel, PixelFifo::Pixel sPixel) const;                                                     // Mix Background/Window and Sprite pixels to final color
 
     void  simulateInterrupt();  // Update and trigger STAT interrupts
 
@@ -210,7 +239,7 @@ namespace GBC
     std::uint8_t  getLine() const;            // Get current line
 
   public:
-    PixelProcessingUnit(GBC::GameBoyColor& gbc, sf::Texture& texture, Math::Vector<2, unsigned int> origin);
+    PixelProcessingUnit(GBC::GameBoyColor& gbc, sf::Texture* texture, Math::Vector<2, unsigned int> origin);
     ~PixelProcessingUnit() = default;
 
     std::uint8_t  readRam(std::uint16_t address); // Read a byte from Video RAM
@@ -220,13 +249,27 @@ namespace GBC
     void  writeRam(std::uint16_t address, std::uint8_t value);  // Write a byte to Video RAM
     void  writeOam(std::uint16_t address, std::uint8_t value);  // Write a byte to OBJ Attribute Table
     void  writeDma(std::uint16_t address, std::uint8_t value);  // Write a byte to OBJ Attribute Table for DMA transfer
+
+    void  writeRam(std::uint16_t address, std::span<const std::uint8_t> values);  // Write a block of bytes to Video RAM, within current bank
+    void  writeDma(std::uint16_t address, std::span<const std::uint8_t> values);  // Write a block of bytes to OBJ Attribute Table for DMA transfer
     void  writeIo(std::uint16_t address, std::uint8_t value);   // Write a graphic IO
 
-    void  simulate(); // Simulate 1 tick of the PPU
+    void        simulate(std::size_t ticks);  // Simulate ticks of the PPU
+    std::size_t next() const;                 // Get number of ticks before next mode or line change
+
+    GBC::PixelProcessingUnit::Renderer  renderer() const;                                   // Get rendering method
+    void                                renderer(GBC::PixelProcessingUnit::Renderer renderer);  // Set rendering method
+
+    bool  skip() const;     // Get frame-skip request
+    void  skip(bool skip);  // Skip pixel output of frames starting after next VBlank, STAT and LY timings are kept
+
+    std::size_t emulated() const;   // Get number of frames emulated
+    std::size_t presented() const;  // Get number of frames sent to rendering target
 
-    const sf::Texture&  lcd() const;  // Get rendering target
+    const sf::Texture&                lcd() const;    // Get rendering target
+    const std::vector<std::uint8_t>&  pixels() const; // Get rendering target on RAM, RGBA
 
-    void  save(std::ofstream& file) const;  // Save state to file
-    void  load(std::ifstream& file);        // Load state from file
+    void  save(GBC::SaveState& state) const;  // Save state
+    void  load(GBC::LoadState& state);        // Load state
   };
 }
\ No newline at end of file
@@ -0,0 +1,106 @@
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#include <tuple>
+
+#include "GameBoyColor/Profile.hpp"
+
+GBC::Profile::Profile() :
+  enabled(false),
+  frames(0),
+  instructions(0),
+  reads{ 0 },
+  writes{ 0 },
+  modes{ 0 },
+  dma(0),
+  hdma(0),
+  samples(0),
+  time{ 0. },
+  current(Subsystem::SubsystemCount),
+  start(std::chrono::steady_clock::now())
+{}
+
+void  GBC::Profile::reset(bool enabled)
+{
+  // Clear counters and timers
+  *this = GBC::Profile();
+
+  // Start collection
+  this->enabled = enabled;
+}
+
+void  GBC::Profile::enter(GBC::Profile::Subsystem subsystem)
+{
+  auto  now = std::chrono::steady_clock::now();
+
+  // Charge elapsed time to current subsystem, time outside of emulation is ignored
+  if (current != Subsystem::SubsystemCount)
+    time[current] += std::chrono::duration<double>(now - start).count();
+
+  // Switch to new subsystem
+  current = subsystem;
+  start = now;
+}
+
+std::string GBC::Profile::report(const GBC::Profile& since) const
+{
+  std::ostringstream  stream;
+  double              count = (double)std::max<std::uint64_t>(frames - since.frames, 1);
+  double              total = 0.;
+  std::uint64_t       cycles = 0;
+
+  for (std::size_t subsystem = 0; subsystem < Subsystem::SubsystemCount; subsystem++)
+    total += time[subsystem] - since.time[subsystem];
+  for (std::size_t mode = 0; mode < modes.size(); mode++)
+    cycles += modes[mode] - since.modes[mode];
+
+  stream << std::fixed << std::setprecision(0);
+
+  // Time per frame of each subsystem
+  stream << "frame: " << total / count * 1000000. << "us, "
+    << "cpu " << (time[Subsystem::SubsystemCpu] - since.time[Subsystem::SubsystemCpu]) / count * 1000000. << "us, "
+    << "ppu " << (time[Subsystem::SubsystemPpu] - since.time[Subsystem::SubsystemPpu]) / count * 1000000. << "us, "
+    << "apu " << (time[Subsystem::SubsystemApu] - since.time[Subsystem::SubsystemApu]) / count * 1000000. << "us, "
+    << "upload " << (time[Subsystem::SubsystemUpload] - since.time[Subsystem::SubsystemUpload]) / count * 1000000. << "us, "
+    << "other " << (time[Subsystem::SubsystemOther] - since.time[Subsystem::SubsystemOther]) / count * 1000000. << "us" << std::endl;
+
+  // CPU instructions and memory accesses per frame
+  stream << "cpu: " << (instructions - since.instructions) / count << " instructions" << std::endl;
+  for (const auto& [name, counters, previous] : { std::tuple{ "reads", &reads, &since.reads }, std::tuple{ "writes", &writes, &since.writes } })
+    stream << name << ": "
+      << "rom " << ((*counters)[Region::RegionRom] - (*previous)[Region::RegionRom]) / count << ", "
+      << "vram " << ((*counters)[Region::RegionVRam] - (*previous)[Region::RegionVRam]) / count << ", "
+      << "eram " << ((*counters)[Region::RegionERam] - (*previous)[Region::RegionERam]) / count << ", "
+      << "wram " << ((*counters)[Region::RegionWRam] - (*previous)[Region::RegionWRam]) / count << ", "
+      << "oam " << ((*counters)[Region::RegionOam] - (*previous)[Region::RegionOam]) / count << ", "
+      << "io " << ((*counters)[Region::RegionIo] - (*previous)[Region::RegionIo]) / count << std::endl;
+
+  // Share of PPU cycles in each mode
+  stream << "ppu: ";
+  for (std::size_t mode = 0; mode < modes.size(); mode++)
+    stream << "mode " << mode << " " << ((cycles > 0) ? (modes[mode] - since.modes[mode]) * 100. / cycles : 0.) << "%" << ((mode + 1 < modes.size()) ? ", " : "");
+  stream << std::endl;
+
+  // Transfers and audio per frame
+  stream << "dma: " << (dma - since.dma) / count << " bytes, hdma " << (hdma - since.hdma) / count << " bytes, "
+    << "apu: " << (samples - since.samples) / count << " samples" << std::endl;
+
+  return stream.str();
+}
+
+GBC::Profile::Region  GBC::Profile::region(std::uint16_t addr)
+{
+  // Memory map of the Game Boy
+  if (addr < 0x8000)
+    return Region::RegionRom;
+  else if (addr < 0xA000)
+    return Region::RegionVRam;
+  else if (addr < 0xC000)
+    return Region::RegionERam;
+  else if (addr < 0xFE00)
+    return Region::RegionWRam;
+  else if (addr < 0xFF00)
+    return Region::RegionOam;
+  else
+    return Region::RegionIo;
+}
\ No newline at end of file
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+namespace GBC
+{
+  struct Profile  // Per-subsystem counters and timings of emulation, collected only when enabled
+  {
+    enum Region
+    {
+      RegionRom,  // Cartridge ROM and bootstrap
+      RegionVRam, // Video RAM
+      RegionERam, // External RAM
+      RegionWRam, // Work RAM and its echo
+      RegionOam,  // OBJ Attribute Table and unusable area
+      RegionIo,   // IO registers, High RAM and Interrupt Enable register
+
+      RegionCount
+    };
+
+    enum Subsystem
+    {
+      SubsystemCpu,     // CPU instructions and DMA transfers
+      SubsystemPpu,     // PPU modes and pixel rendering
+      SubsystemApu,     // Audio samples generation
+      SubsystemUpload,  // Texture upload of displayed frames
+      SubsystemOther,   // Joypad, MBC clock and scheduling
+
+      SubsystemCount
+    };
+
+    bool                                      enabled;      // Counters and timers are updated
+    std::uint64_t                             frames;       // Number of frames simulated
+    std::uint64_t                             instructions; // Number of CPU instructions executed
+    std::array<std::uint64_t, RegionCount>    reads;        // Number of memory reads by region
+    std::array<std::uint64_t, RegionCount>    writes;       // Number of memory writes by region
+    std::array<std::uint64_t, 4>              modes;        // Number of cycles spent by PPU in each LCD mode
+    std::uint64_t                             dma;          // Number of bytes transferred by OAM DMA
+    std::uint64_t                             hdma;         // Number of bytes transferred by HDMA and general purpose DMA
+    std::uint64_t                             samples;      // Number of audio samples generated
+    std::array<double, SubsystemCount>        time;         // Time spent in each subsystem, nested subsystems excluded (seconds)
+    Subsystem                                 current;      // Subsystem being timed, SubsystemCount outside of emulation
+    std::chrono::steady_clock::time_point     start;        // Start of current subsystem timing
+
+    class Scope // Time a subsystem until end of scope, then resume timing of previous one
+    {
+    private:
+      GBC::Profile&           _profile;   // Profile being updated
+      GBC::Profile::Subsystem _previous;  // Subsystem timed before scope
+      bool                    _enabled;   // Profile was enabled at start of scope
+
+    public:
+      Scope(GBC::Profile& profile, GBC::Profile::Subsystem subsystem) :
+        _profile(profile),
+        _previous(profile.current),
+        _enabled(profile.enabled)
+      {
+        // Switch timing to subsystem
+        if (_enabled == true)
+          _profile.enter(subsystem);
+      }
+
+      ~Scope()
+      {
+        // Resume timing of previous subsystem
+        if (_enabled == true)
+          _profile.enter(_previous);
+      }
+    };
+
+    Profile();
+    ~Profile() = default;
+
+    void  reset(bool enabled);                      // Clear counters and timers, then enable or disable collection
+    void  enter(GBC::Profile::Subsystem subsystem); // Charge elapsed time to current subsystem, then switch to given one
+
+    std::string report(const GBC::Profile& since) const;  // Per-frame averages since a previous copy of profile, one line per subsystem
+
+    static GBC::Profile::Region  region(std::uint16_t addr);  // Memory region of an address
+  };
+}
\ No newline at end of file
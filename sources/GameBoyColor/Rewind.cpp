@@ -0,0 +1,197 @@
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include "GameBoyColor/Rewind.hpp"
+
+GBC::Rewind::Rewind(std::size_t capacity) :
+  _ring(capacity, 0),
+  _head(0),
+  _used(0),
+  _count(0),
+  _snapshot(),
+  _delta()
+{
+  // Ring cannot be empty
+  if (_ring.empty() == true)
+    throw std::runtime_error((std::string(__FILE__) + ": l." + std::to_string(__LINE__)).c_str());
+}
+
+void  GBC::Rewind::push(const std::vector<std::uint8_t>& snapshot)
+{
+  // Store delta from new snapshot to previous one
+  if (_snapshot.empty() == false)
+  {
+    encode(_snapshot, snapshot);
+
+    std::uint32_t length = (std::uint32_t)_delta.size();
+
+    // Delta bigger than whole ring, history is lost
+    if (length + 2 * sizeof(length) > _ring.size()) {
+      _head = 0;
+      _used = 0;
+      _count = 0;
+    }
+
+    else {
+      // Make room by discarding oldest deltas
+      while (_used + length + 2 * sizeof(length) > _ring.size())
+        drop();
+
+      // Delta framed by its size, so it can be walked from both ends
+      write(&length, sizeof(length));
+      write(_delta.data(), length);
+      write(&length, sizeof(length));
+      _count++;
+    }
+  }
+
+  // Keep most recent snapshot uncompressed
+  _snapshot = snapshot;
+}
+
+bool  GBC::Rewind::pop(std::vector<std::uint8_t>& snapshot)
+{
+  // No snapshot recorded
+  if (_snapshot.empty() == true)
+    return false;
+
+  // Most recent snapshot
+  snapshot = _snapshot;
+
+  // Rebuild previous snapshot from most recent delta
+  if (_count > 0)
+  {
+    std::uint32_t length = 0;
+
+    read((_head + _ring.size() - sizeof(length)) % _ring.size(), &length, sizeof(length));
+    _delta.resize(length);
+    read((_head + 2 * _ring.size() - sizeof(length) - length) % _ring.size(), _delta.data(), length);
+
+    // Remove delta from ring
+    _head = (_head + 2 * _ring.size() - length - 2 * sizeof(length)) % _ring.size();
+    _used -= length + 2 * sizeof(length);
+    _count--;
+
+    decode(_snapshot);
+  }
+
+  // No more history
+  else
+    _snapshot.clear();
+
+  return true;
+}
+
+void  GBC::Rewind::clear()
+{
+  // Reset ring and most recent snapshot
+  _head = 0;
+  _used = 0;
+  _count = 0;
+  _snapshot.clear();
+}
+
+std::size_t GBC::Rewind::size() const
+{
+  // Deltas and most recent snapshot
+  return _count + (_snapshot.empty() == true ? 0 : 1);
+}
+
+void  GBC::Rewind::write(const void* data, std::size_t size)
+{
+  std::size_t first = std::min(size, _ring.size() - _head);
+
+  // Copy up to end of ring, then wrap around
+  std::memcpy(_ring.data() + _head, data, first);
+  std::memcpy(_ring.data(), (const std::uint8_t*)data + first, size - first);
+
+  _head = (_head + size) % _ring.size();
+  _used += size;
+}
+
+void  GBC::Rewind::read(std::size_t position, void* data, std::size_t size) const
+{
+  std::size_t first = std::min(size, _ring.size() - position);
+
+  // Copy up to end of ring, then wrap around
+  std::memcpy(data, _ring.data() + position, first);
+  std::memcpy((std::uint8_t*)data + first, _ring.data(), size - first);
+}
+
+void  GBC::Rewind::drop()
+{
+  std::uint32_t length = 0;
+
+  // Oldest delta is right after free space
+  read((_head + _ring.size() - _used) % _ring.size(), &length, sizeof(length));
+
+  _used -= length + 2 * sizeof(length);
+  _count--;
+}
+
+void  GBC::Rewind::encode(const std::vector<std::uint8_t>& older, const std::vector<std::uint8_t>& newer)
+{
+  std::uint32_t size = (std::uint32_t)older.size();
+
+  // XOR of both snapshots, newer is padded with zeros
+  auto  delta = [&older, &newer](std::size_t index) {
+    return (std::uint8_t)(older[index] ^ (index < newer.size() ? newer[index] : 0));
+    };
+
+  // Size of older snapshot
+  _delta.clear();
+  _delta.insert(_delta.end(), (const std::uint8_t*)&size, (const std::uint8_t*)&size + sizeof(size));
+
+  // Sequence of unchanged bytes count, changed bytes count and changed bytes
+  for (std::size_t index = 0; index < older.size();)
+  {
+    std::uint16_t zeros = 0;
+    std::uint16_t literals = 0;
+
+    // Unchanged bytes
+    while (index + zeros < older.size() && zeros < 0xFFFF && delta(index + zeros) == 0)
+      zeros++;
+    index += zeros;
+
+    // Changed bytes, up to a run of unchanged bytes worth a new sequence
+    for (std::size_t run = 0; index + literals < older.size() && literals < 0xFFFF; literals++) {
+      run = (delta(index + literals) == 0) ? run + 1 : 0;
+      if (run == 4) {
+        literals -= 3;
+        break;
+      }
+    }
+
+    _delta.insert(_delta.end(), (const std::uint8_t*)&zeros, (const std::uint8_t*)&zeros + sizeof(zeros));
+    _delta.insert(_delta.end(), (const std::uint8_t*)&literals, (const std::uint8_t*)&literals + sizeof(literals));
+    for (std::size_t end = index + literals; index < end; index++)
+      _delta.push_back(delta(index));
+  }
+}
+
+void  GBC::Rewind::decode(std::vector<std::uint8_t>& snapshot) const
+{
+  std::uint32_t size = 0;
+  std::size_t   position = sizeof(size);
+
+  // Resize to older snapshot, new bytes are the zero padding of encoding
+  std::memcpy(&size, _delta.data(), sizeof(size));
+  snapshot.resize(size, 0);
+
+  // Apply sequences of unchanged and changed bytes
+  for (std::size_t index = 0; position < _delta.size();)
+  {
+    std::uint16_t zeros = 0;
+    std::uint16_t literals = 0;
+
+    std::memcpy(&zeros, _delta.data() + position + 0, sizeof(zeros));
+    std::memcpy(&literals, _delta.data() + position + sizeof(zeros), sizeof(literals));
+    position += sizeof(zeros) + sizeof(literals);
+    index += zeros;
+
+    for (std::size_t end = index + literals; index < end; index++, position++)
+      snapshot[index] ^= _delta[position];
+  }
+}
\ No newline at end of file
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace GBC
+{
+  class Rewind
+  {
+  private:
+    std::vector<std::uint8_t> _ring;      // Fixed-size circular storage of compressed deltas, each framed by its size
+    std::size_t               _head;      // Ring position where next delta is written
+    std::size_t               _used;      // Bytes of ring used by stored deltas
+    std::size_t               _count;     // Number of deltas in ring
+    std::vector<std::uint8_t> _snapshot;  // Most recent snapshot, uncompressed, empty if none
+    std::vector<std::uint8_t> _delta;     // Buffer of delta being compressed or decompressed
+
+    void  write(const void* data, std::size_t size);                    // Copy bytes at head of ring
+    void  read(std::size_t position, void* data, std::size_t size) const; // Copy bytes from ring position
+    void  drop();                                                       // Discard oldest delta of ring
+
+    void  encode(const std::vector<std::uint8_t>& older, const std::vector<std::uint8_t>& newer); // Compress delta to rebuild older snapshot from newer one
+    void  decode(std::vector<std::uint8_t>& snapshot) const;                                        // Turn newer snapshot into older one using current delta
+
+  public:
+    Rewind(std::size_t capacity);
+    ~Rewind() = default;
+
+    void  push(const std::vector<std::uint8_t>& snapshot);  // Record a new snapshot, oldest ones are discarded when ring is full
+    bool  pop(std::vector<std::uint8_t>& snapshot);         // Get most recent snapshot and remove it, false if none
+    void  clear();                                          // Remove every snapshot
+
+    std::size_t size() const; // Number of snapshots recorded
+  };
+}
\ No newline at end of file
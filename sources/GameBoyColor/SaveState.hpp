@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstdint>
+#include <span>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace GBC
+{
+  struct SaveState  // State being serialized by GBC components
+  {
+    enum Format
+    {
+      FormatBinary, // Versioned binary snapshot, raw variables in save order
+      FormatText    // "NAME=hex" lines, human readable export
+    };
+
+    static constexpr std::string_view Magic = "GBCS"; // Signature of binary snapshots
+    static constexpr std::uint32_t    Version = 2;    // Version of binary snapshots, increment when saved variables change
+
+    GBC::SaveState::Format      format; // Output format
+    std::vector<std::uint8_t>&  buffer; // Output buffer
+  };
+
+  struct LoadState  // State being deserialized by GBC components
+  {
+    GBC::SaveState::Format                                  format;     // Input format
+    std::span<const std::uint8_t>                           buffer;     // Input buffer
+    std::size_t                                             offset;     // Read position in binary snapshot
+    std::unordered_map<std::string_view, std::string_view>  variables;  // Variables of text export by name, indexed once
+  };
+}
\ No newline at end of file
@@ -1,4 +1,6 @@
 #include <filesystem>
+#include <fstream>
+#include <iostream>
 
 #include "System/Library/FontLibrary.hpp"
 #include "Scenes/ExitScene.hpp"
@@ -7,6 +9,8 @@
 #include "GameBoyColor/GameBoyColor.hpp"
 #include "GameBoyColor/SelectionScene.hpp"
 #include "System/Config.hpp"
+#include "System/JavaScriptObjectNotation.hpp"
+#include "System/Utilities.hpp"
 
 #ifdef _WIN32
 #include <Windows.h>
@@ -14,34 +18,21 @@
 
 GBC::SelectionScene::SelectionScene(Game::SceneMachine& machine) :
   Game::AbstractMenuScene(machine),
+  _library(),
+  _validation(),
+  _validated(0),
+  _applied(0),
+  _stop(false),
+  _validator(),
   _selected()
 {
   // Set menu title
   title("GameBoy");
 
-  sf::Texture texture(sf::Vector2u(GBC::PixelProcessingUnit::ScreenWidth, GBC::PixelProcessingUnit::ScreenHeight));
+  // List games in game directory, without loading them
+  scan();
+  refresh();
 
-  // List games in game directory
-  try {
-    for (const auto& entry : std::filesystem::directory_iterator(Game::Config::ExecutablePath / "assets" / "gbc")) {
-      // Only .gb or .gbc files
-      if (entry.path().extension() != ".gb" && entry.path().extension() != ".gbc" && entry.path().extension() != ".bin")
-        continue;
-
-      try {
-        GBC::GameBoyColor gbc(entry, texture, Math::Vector<2, unsigned int>((unsigned int)0, (unsigned int)0));
-
-        // Add game to menu list
-        if (gbc.header().header_checksum && gbc.header().global_checksum)
-          add(gbc.header().title, std::function<void(Game::AbstractMenuScene::Item&)>(std::bind(&GBC::SelectionScene::selectGame, this, std::placeholders::_1, std::filesystem::absolute(entry).string())));
-      }
-      catch (const std::exception&e) {
-        std::cout << e.what() << std::endl;
-      }
-    }
-  }
-  catch (const std::exception&) {}
-  
 #ifdef _WIN32
   // Add browse files option
   footer("Browse...", std::function<void(Game::AbstractMenuScene::Item&)>(std::bind(&GBC::SelectionScene::selectBrowse, this, std::placeholders::_1)));
@@ -50,6 +41,21 @@ GBC::SelectionScene::SelectionScene(Game::SceneMachine& machine) :
   // Nothing to load, browse to file
   if (empty() == true)
     _selected = browse();
+
+  // Check global checksums in background, once nothing can throw
+  _validation.resize(_library.size(), Entry::Status::StatusPending);
+  _validator = std::thread(&GBC::SelectionScene::validate, this);
+}
+
+GBC::SelectionScene::~SelectionScene()
+{
+  // Stop validation thread
+  _stop = true;
+  _validator.join();
+
+  // Keep library for next time, with games validated so far
+  apply();
+  saveIndex();
 }
 
 bool  GBC::SelectionScene::update(float elapsed)
@@ -73,6 +79,10 @@ bool  GBC::SelectionScene::update(float elapsed)
     return false;
   }
 
+  // Remove games invalidated by validation thread from menu
+  if (apply() == true)
+    refresh();
+
   // Update menu
   return Game::AbstractMenuScene::update(elapsed);
 }
@@ -122,4 +132,152 @@ std::filesystem::path GBC::SelectionScene::browse() const
 
   // Failure
   return "";
+}
+
+void  GBC::SelectionScene::scan()
+{
+  Game::JSON::Object  index;
+
+  // Load index of previously scanned games, empty if none
+  try {
+    index = Game::JSON::Object(Game::Config::ExecutablePath / "assets" / "gbc" / "library.json");
+  }
+  catch (const std::exception&) {}
+
+  // List games in game directory
+  try {
+    for (const auto& file : std::filesystem::directory_iterator(Game::Config::ExecutablePath / "assets" / "gbc")) {
+      // Only .gb or .gbc files
+      if (file.path().extension() != ".gb" && file.path().extension() != ".gbc" && file.path().extension() != ".bin")
+        continue;
+
+      try {
+        Entry entry = {
+          .path = std::filesystem::absolute(file.path()),
+          .size = file.file_size(),
+          .time = (std::int64_t)file.last_write_time().time_since_epoch().count(),
+          .title = "",
+          .status = Entry::Status::StatusInvalid
+        };
+
+        bool  indexed = false;
+
+        // Game unchanged since indexed, keep title and validation status
+        try {
+          auto& game = index.get(entry.path.wstring()).object();
+
+          if ((std::uintmax_t)game.get(L"size").number() == entry.size && game.get(L"time").string() == std::to_wstring(entry.time)) {
+            entry.title = Game::Utilities::Convert(game.get(L"title").string());
+            entry.status = (Entry::Status)game.get(L"status").number();
+            indexed = true;
+          }
+        }
+        catch (const std::exception&) {}
+
+        // Parse cartridge header only
+        if (indexed == false) {
+          std::vector<std::uint8_t> header(0x0150, 0);
+          std::ifstream             stream(entry.path, std::ifstream::binary);
+
+          stream.read((char*)header.data(), header.size());
+
+          // Files smaller than a cartridge header are not games
+          if (stream.gcount() == header.size()) {
+            auto  cartridge = GBC::GameBoyColor::parseHeader(header);
+
+            entry.title = cartridge.title;
+            entry.status = (cartridge.header_checksum == true) ? Entry::Status::StatusPending : Entry::Status::StatusInvalid;
+          }
+        }
+
+        _library.push_back(std::move(entry));
+      }
+      catch (const std::exception& e) {
+        std::cout << e.what() << std::endl;
+      }
+    }
+  }
+  catch (const std::exception&) {}
+}
+
+void  GBC::SelectionScene::refresh()
+{
+  // Reset menu
+  clear();
+
+  // Add games not invalidated to menu list
+  for (const auto& entry : _library)
+    if (entry.status != Entry::Status::StatusInvalid)
+      add(entry.title, std::function<void(Game::AbstractMenuScene::Item&)>(std::bind(&GBC::SelectionScene::selectGame, this, std::placeholders::_1, entry.path)));
+}
+
+void  GBC::SelectionScene::validate()
+{
+  // Check global checksum of pending games, in library order
+  for (std::size_t index = 0; index < _library.size() && _stop == false; index++) {
+    const auto& entry = _library[index];
+
+    _validation[index] = entry.status;
+
+    // Load whole ROM for global checksum
+    if (entry.status == Entry::Status::StatusPending) {
+      try {
+        std::vector<std::uint8_t> rom(entry.size, 0);
+        std::ifstream             stream(entry.path, std::ifstream::binary);
+
+        stream.read((char*)rom.data(), rom.size());
+        _validation[index] = (stream.gcount() == rom.size() && GBC::GameBoyColor::parseHeader(rom).global_checksum == true) ?
+          Entry::Status::StatusValid :
+          Entry::Status::StatusInvalid;
+      }
+      catch (const std::exception&) {
+        _validation[index] = Entry::Status::StatusInvalid;
+      }
+    }
+
+    // Publish status to main thread, entry is not accessed anymore
+    _validated.store(index + 1, std::memory_order_release);
+  }
+}
+
+bool  GBC::SelectionScene::apply()
+{
+  std::size_t validated = _validated.load(std::memory_order_acquire);
+  bool        invalid = false;
+
+  // Copy statuses published since last call
+  for (; _applied < validated; _applied++) {
+    if (_validation[_applied] == Entry::Status::StatusInvalid && _library[_applied].status != Entry::Status::StatusInvalid)
+      invalid = true;
+    _library[_applied].status = _validation[_applied];
+  }
+
+  return invalid;
+}
+
+void  GBC::SelectionScene::saveIndex()
+{
+  Game::JSON::Object  index;
+
+  // Games indexed by path, checked against size and modification time
+  // NOTE: time is stored as string, as it does not fit in a double
+  for (const auto& entry : _library) {
+    try {
+      Game::JSON::Object  game;
+
+      game.set(L"size", (double)entry.size);
+      game.set(L"time", std::to_wstring(entry.time));
+      game.set(L"title", Game::Utilities::Convert(entry.title));
+      game.set(L"status", (double)entry.status);
+      index.set(entry.path.wstring(), std::move(game));
+    }
+
+    // Title is not valid UTF-8, header is parsed again next time
+    catch (const std::exception&) {}
+  }
+
+  std::wofstream file(Game::Config::ExecutablePath / "assets" / "gbc" / "library.json");
+
+  // Send JSON to file
+  file << index;
 }
\ No newline at end of file
@@ -1,7 +1,11 @@
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <filesystem>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "Scenes/Menu/AbstractMenuScene.hpp"
 
@@ -10,16 +14,45 @@ namespace GBC
   class SelectionScene : public Game::AbstractMenuScene
   {
   private:
+    struct Entry
+    {
+      enum Status
+      {
+        StatusPending,  // Cartridge header is valid, global checksum not checked yet
+        StatusValid,    // Cartridge header and global checksum are valid
+        StatusInvalid   // Not a game, not displayed
+      };
+
+      std::filesystem::path path;   // Absolute path of ROM
+      std::uintmax_t        size;   // Size of ROM file
+      std::int64_t          time;   // Last modification time of ROM file
+      std::string           title;  // Game title from cartridge header
+      Status                status; // Validation status
+    };
+
+    std::vector<Entry>                _library;     // Games of game directory, from index or cartridge header, only modified by main thread
+    std::vector<Entry::Status>        _validation;  // Status of library entries computed by validation thread
+    std::atomic<std::size_t>          _validated;   // Number of statuses published by validation thread
+    std::size_t                       _applied;     // Number of statuses applied to library
+    std::atomic<bool>                 _stop;        // Stop flag of validation thread
+    std::thread                       _validator;   // Thread checking global checksum of games in background
+
     void  selectGame(Game::AbstractMenuScene::Item&, const std::filesystem::path& file);  // Start emulation with given game
     void  selectBrowse(Game::AbstractMenuScene::Item&);                                   // Select file to start game
-    
+
     std::filesystem::path _selected;
 
     std::filesystem::path browse() const;
 
+    void  scan();       // List games of game directory, reading only cartridge header of games not in index
+    void  refresh();    // Rebuild menu from games not invalidated
+    void  validate();   // Check global checksum of pending games, run by validation thread
+    bool  apply();      // Apply statuses published by validation thread to library, true if a game was invalidated
+    void  saveIndex();  // Save library to index file
+
   public:
     SelectionScene(Game::SceneMachine& machine);
-    ~SelectionScene() override = default;
+    ~SelectionScene() override;
 
     bool  update(float elapsed) override;  // Update state
   };
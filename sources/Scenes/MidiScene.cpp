@@ -15,7 +15,12 @@ Game::MidiScene::MidiScene(Game::SceneMachine& machine) :
   _buffer(),
   _offset(0),
   _octave(0),
-  _wave()
+  _wave(),
+  _synthesizer(),
+  _stream(),
+  _ended(),
+  _streamed(),
+  _lock()
 {
   for (int index = 0; index < _wave.size(); index++)
     _wave[index] = std::cos((float)index / (float)_wave.size() * 2.f * Math::Pi);
@@ -25,11 +30,46 @@ Game::MidiScene::MidiScene(Game::SceneMachine& machine) :
   sf::SoundStream::play();
 }
 
+Game::MidiScene::~MidiScene()
+{
+  // Stop audio thread before releasing stream
+  sf::SoundStream::stop();
+}
+
 bool  Game::MidiScene::update(float elapsed)
 {
+  std::unique_ptr<Game::Audio::Synthesizer::Stream> stream;
+  std::unique_ptr<Game::Audio::Synthesizer::Stream> ended;
+
+  // Take streams from audio thread, only pointers are swapped under lock
+  {
+    std::unique_lock  lock(_lock);
+
+    ended = std::move(_ended);
+    if (Game::Window::Instance().keyboard().keyPressed(Game::Window::Key::Enter) == true)
+      stream = std::move(_stream);
+  }
+
+  // Release sequence completed by audio thread
+  if (ended)
+    release(std::move(ended));
+
+  // Start or stop streaming of MIDI sequence
   if (Game::Window::Instance().keyboard().keyPressed(Game::Window::Key::Enter) == true) {
-    Game::Audio::Synthesizer  midi(Game::Config::ExecutablePath / "assets" / "levels" / "beethoven.mid", Game::Config::ExecutablePath / "assets" / "levels" / "gzdoom.sf2");
-    midi.generate(0);
+    if (stream) {
+      release(std::move(stream));
+    }
+    else {
+      // Load MIDI file and soundfont on first use, samples are read from mapped file
+      // NOTE: audio thread only uses synthesizer through stream, so it is not blocked while loading
+      if (!_synthesizer)
+        _synthesizer = std::make_unique<Game::Audio::Synthesizer>(Game::Config::ExecutablePath / "assets" / "levels" / "beethoven.mid", Game::Config::ExecutablePath / "assets" / "levels" / "gzdoom.sf2", Game::MidiScene::SampleRate, Game::Audio::Soundfont::Storage::StorageMapped);
+      stream = std::make_unique<Game::Audio::Synthesizer::Stream>(*_synthesizer, 0);
+
+      std::unique_lock  lock(_lock);
+
+      _stream = std::move(stream);
+    }
   }
 
   if (Game::Window::Instance().keyboard().keyPressed(Game::Window::Key::Escape) == true)
@@ -74,12 +114,36 @@ bool  Game::MidiScene::onGetData(sf::SoundStream::Chunk& data)
       for (int index = 0; index < Game::MidiScene::ChannelCount * Game::MidiScene::FramePerChunk; index++)
         _buffer[index] = (int16_t)std::clamp((int)((float)_buffer[index] + 8192.f * std::cos((float)(index / ChannelCount + _offset) / (float)SampleRate * Game::MidiScene::GetRatio(key.second) * C * 2.f * Math::Pi)), (int)std::numeric_limits<int16_t>::min(), (int)std::numeric_limits<int16_t>::max());
 
+  // Mix next block of streamed sequence
+  {
+    std::unique_lock  lock(_lock);
+
+    if (_stream) {
+      bool  playing = _stream->render(_streamed.data(), Game::MidiScene::FramePerChunk);
+
+      // Downmix stereo frames to output
+      for (int index = 0; index < Game::MidiScene::FramePerChunk; index++)
+        _buffer[index] = (int16_t)std::clamp((int)((float)_buffer[index] + (_streamed[index * 2 + 0] + _streamed[index * 2 + 1]) / 2.f * 32767.f), (int)std::numeric_limits<int16_t>::min(), (int)std::numeric_limits<int16_t>::max());
+
+      // Sequence completed, released by main thread
+      if (playing == false)
+        _ended = std::move(_stream);
+    }
+  }
+
   // Add number of sample generated to counter
   _offset += data.sampleCount;
 
   return true;
 }
 
+void  Game::MidiScene::release(std::unique_ptr<Game::Audio::Synthesizer::Stream> stream)
+{
+  // Report notes not played, counted by audio thread
+  if (stream->statistics.skipped > 0)
+    std::cerr << "[Game::MidiScene::release]: Warning, " << stream->statistics.skipped << " notes or voices skipped (no preset or invalid sample)." << std::endl;
+}
+
 void  Game::MidiScene::onSeek(sf::Time timeOffset)
 {
   _offset = (size_t)(timeOffset.asSeconds() * Game::MidiScene::SampleRate);
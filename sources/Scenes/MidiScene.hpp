@@ -2,9 +2,12 @@
 
 #include <cstdint>
 #include <array>
+#include <memory>
+#include <mutex>
 #include <SFML/Audio/SoundStream.hpp>
 
 #include "Scenes/AbstractScene.hpp"
+#include "System/Audio/Synthesizer.hpp"
 
 namespace Game
 {
@@ -58,12 +61,20 @@ namespace Game
     int                                               _octave;  // Current octave [+/-]
     std::array<float, 128>                            _wave;    // Pre-computed wave for fast cosinus
 
+    std::unique_ptr<Game::Audio::Synthesizer>         _synthesizer; // Loaded MIDI file and soundfont
+    std::unique_ptr<Game::Audio::Synthesizer::Stream> _stream;      // Sequence currently streamed, nullptr when stopped
+    std::unique_ptr<Game::Audio::Synthesizer::Stream> _ended;       // Sequence completed by audio thread, released by main thread
+    std::array<float, 2 * FramePerChunk>              _streamed;    // Stereo frames rendered by stream
+    std::mutex                                        _lock;        // Lock of streams, shared with audio thread
+
+    void  release(std::unique_ptr<Game::Audio::Synthesizer::Stream> stream);  // Release a stream outside of lock, reporting notes it skipped
+
     virtual bool onGetData(sf::SoundStream::Chunk& data) override;
     virtual void onSeek(sf::Time timeOffset) override;
 
   public:
     MidiScene(Game::SceneMachine& machine);
-    ~MidiScene() override = default;
+    ~MidiScene() override;
 
     bool  update(float elapsed) override; // Update state
     void  draw() override;                // Draw state
@@ -1 +1,350 @@
-#include "System/Audio/Pitch.hpp"
\ No newline at end of file
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <random>
+#include <tuple>
+
+#include "System/Audio/Pitch.hpp"
+
+#if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+# include <immintrin.h>
+#endif
+
+// AVX2 kernels are only built with GAME_AVX2 CMake option, SSE2 otherwise
+#if defined(__AVX2__)
+const char* const Game::Audio::Vocoder::Kernel = "avx2";
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+const char* const Game::Audio::Vocoder::Kernel = "sse2";
+#else
+const char* const Game::Audio::Vocoder::Kernel = "scalar";
+#endif
+
+void  Game::Audio::Vocoder::analyzeScalar(const float* real, const float* imag, float* last, float* magnitude, float* frequency, std::size_t count, float expected, float freqPerBin, float step)
+{
+  for (std::size_t k = 0; k < count; k++) {
+    float phase = std::atan2(imag[k], real[k]);
+
+    /* Compute phase difference, subtract expected phase difference */
+    float tmp = phase - last[k] - (float)k * expected;
+    last[k] = phase;
+
+    /* Map delta phase into +/- Pi interval */
+    int qpd = (int)(tmp / Math::Pi);
+    if (qpd >= 0)
+      qpd += qpd & 1;
+    else
+      qpd -= qpd & 1;
+    tmp -= Math::Pi * (float)qpd;
+
+    /* Store magnitude and true frequency */
+    magnitude[k] = 2.f * std::sqrt(real[k] * real[k] + imag[k] * imag[k]);
+    frequency[k] = (float)k * freqPerBin + tmp * (step / (2.f * Math::Pi)) * freqPerBin;
+  }
+}
+
+void  Game::Audio::Vocoder::analyzeVector(const float* real, const float* imag, float* last, float* magnitude, float* frequency, std::size_t count, float expected, float freqPerBin, float step)
+{
+  std::size_t k = 0;
+
+  // Minimax polynomial of atan over [0, 1], error below 2e-8 (Abramowitz & Stegun 4.4.49)
+  const float atan[] = { 1.f, -0.3333314528f, 0.1999355085f, -0.1420889944f, 0.1065626393f, -0.0752896400f, 0.0429096138f, -0.0161657367f, 0.0028662257f };
+
+#if defined(__AVX2__)
+  const __m256  offsets = _mm256_setr_ps(0.f, 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f);
+  const __m256  sign = _mm256_set1_ps(-0.f);
+  const __m256  pi = _mm256_set1_ps(Math::Pi);
+
+  // Eight bins at a time
+  for (; k + 8 <= count; k += 8) {
+    __m256  n = _mm256_add_ps(_mm256_set1_ps((float)k), offsets);
+    __m256  re = _mm256_loadu_ps(real + k);
+    __m256  im = _mm256_loadu_ps(imag + k);
+
+    // Phase from octant of (re, im) and atan of smallest over largest coordinate
+    __m256  x = _mm256_andnot_ps(sign, re);
+    __m256  y = _mm256_andnot_ps(sign, im);
+    __m256  a = _mm256_div_ps(_mm256_min_ps(x, y), _mm256_max_ps(_mm256_max_ps(x, y), _mm256_set1_ps(std::numeric_limits<float>::min())));
+    __m256  s = _mm256_mul_ps(a, a);
+    __m256  phase = _mm256_set1_ps(atan[8]);
+
+    for (int index = 7; index >= 0; index--)
+      phase = _mm256_add_ps(_mm256_mul_ps(phase, s), _mm256_set1_ps(atan[index]));
+    phase = _mm256_mul_ps(phase, a);
+    phase = _mm256_blendv_ps(phase, _mm256_sub_ps(_mm256_set1_ps(Math::Pi / 2.f), phase), _mm256_cmp_ps(y, x, _CMP_GT_OQ));
+    phase = _mm256_blendv_ps(phase, _mm256_sub_ps(pi, phase), _mm256_cmp_ps(re, _mm256_setzero_ps(), _CMP_LT_OQ));
+    phase = _mm256_or_ps(phase, _mm256_and_ps(im, sign));
+
+    // Phase difference minus expected one, mapped into +/- Pi interval
+    __m256  tmp = _mm256_sub_ps(_mm256_sub_ps(phase, _mm256_loadu_ps(last + k)), _mm256_mul_ps(n, _mm256_set1_ps(expected)));
+    __m256i qpd = _mm256_cvttps_epi32(_mm256_div_ps(tmp, pi));
+    __m256i negative = _mm256_srai_epi32(qpd, 31);
+
+    _mm256_storeu_ps(last + k, phase);
+    qpd = _mm256_add_epi32(qpd, _mm256_sub_epi32(_mm256_xor_si256(_mm256_and_si256(qpd, _mm256_set1_epi32(1)), negative), negative));
+    tmp = _mm256_sub_ps(tmp, _mm256_mul_ps(pi, _mm256_cvtepi32_ps(qpd)));
+
+    // Magnitude and true frequency
+    _mm256_storeu_ps(magnitude + k, _mm256_mul_ps(_mm256_set1_ps(2.f), _mm256_sqrt_ps(_mm256_add_ps(_mm256_mul_ps(re, re), _mm256_mul_ps(im, im)))));
+    _mm256_storeu_ps(frequency + k, _mm256_add_ps(_mm256_mul_ps(n, _mm256_set1_ps(freqPerBin)), _mm256_mul_ps(_mm256_mul_ps(tmp, _mm256_set1_ps(step / (2.f * Math::Pi))), _mm256_set1_ps(freqPerBin))));
+  }
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+  const __m128  offsets = _mm_setr_ps(0.f, 1.f, 2.f, 3.f);
+  const __m128  sign = _mm_set1_ps(-0.f);
+  const __m128  pi = _mm_set1_ps(Math::Pi);
+
+  // Four bins at a time, no blend instruction so selections are masked
+  for (; k + 4 <= count; k += 4) {
+    __m128  n = _mm_add_ps(_mm_set1_ps((float)k), offsets);
+    __m128  re = _mm_loadu_ps(real + k);
+    __m128  im = _mm_loadu_ps(imag + k);
+
+    // Phase from octant of (re, im) and atan of smallest over largest coordinate
+    __m128  x = _mm_andnot_ps(sign, re);
+    __m128  y = _mm_andnot_ps(sign, im);
+    __m128  a = _mm_div_ps(_mm_min_ps(x, y), _mm_max_ps(_mm_max_ps(x, y), _mm_set1_ps(std::numeric_limits<float>::min())));
+    __m128  s = _mm_mul_ps(a, a);
+    __m128  phase = _mm_set1_ps(atan[8]);
+    __m128  mask;
+
+    for (int index = 7; index >= 0; index--)
+      phase = _mm_add_ps(_mm_mul_ps(phase, s), _mm_set1_ps(atan[index]));
+    phase = _mm_mul_ps(phase, a);
+    mask = _mm_cmpgt_ps(y, x);
+    phase = _mm_or_ps(_mm_and_ps(mask, _mm_sub_ps(_mm_set1_ps(Math::Pi / 2.f), phase)), _mm_andnot_ps(mask, phase));
+    mask = _mm_cmplt_ps(re, _mm_setzero_ps());
+    phase = _mm_or_ps(_mm_and_ps(mask, _mm_sub_ps(pi, phase)), _mm_andnot_ps(mask, phase));
+    phase = _mm_or_ps(phase, _mm_and_ps(im, sign));
+
+    // Phase difference minus expected one, mapped into +/- Pi interval
+    __m128  tmp = _mm_sub_ps(_mm_sub_ps(phase, _mm_loadu_ps(last + k)), _mm_mul_ps(n, _mm_set1_ps(expected)));
+    __m128i qpd = _mm_cvttps_epi32(_mm_div_ps(tmp, pi));
+    __m128i negative = _mm_srai_epi32(qpd, 31);
+
+    _mm_storeu_ps(last + k, phase);
+    qpd = _mm_add_epi32(qpd, _mm_sub_epi32(_mm_xor_si128(_mm_and_si128(qpd, _mm_set1_epi32(1)), negative), negative));
+    tmp = _mm_sub_ps(tmp, _mm_mul_ps(pi, _mm_cvtepi32_ps(qpd)));
+
+    // Magnitude and true frequency
+    _mm_storeu_ps(magnitude + k, _mm_mul_ps(_mm_set1_ps(2.f), _mm_sqrt_ps(_mm_add_ps(_mm_mul_ps(re, re), _mm_mul_ps(im, im)))));
+    _mm_storeu_ps(frequency + k, _mm_add_ps(_mm_mul_ps(n, _mm_set1_ps(freqPerBin)), _mm_mul_ps(_mm_mul_ps(tmp, _mm_set1_ps(step / (2.f * Math::Pi))), _mm_set1_ps(freqPerBin))));
+  }
+#endif
+
+  // Remaining bins
+  for (; k < count; k++) {
+    float phase = std::atan2(imag[k], real[k]);
+    float tmp = phase - last[k] - (float)k * expected;
+    last[k] = phase;
+
+    int qpd = (int)(tmp / Math::Pi);
+    if (qpd >= 0)
+      qpd += qpd & 1;
+    else
+      qpd -= qpd & 1;
+    tmp -= Math::Pi * (float)qpd;
+
+    magnitude[k] = 2.f * std::sqrt(real[k] * real[k] + imag[k] * imag[k]);
+    frequency[k] = (float)k * freqPerBin + tmp * (step / (2.f * Math::Pi)) * freqPerBin;
+  }
+}
+
+void  Game::Audio::Vocoder::synthesizeScalar(const float* magnitude, const float* frequency, float* sum, float* real, float* imag, std::size_t count, float expected, float freqPerBin, float step)
+{
+  for (std::size_t k = 0; k < count; k++) {
+    /* Bin deviation from true frequency, take Step into account, add the overlap phase advance back in */
+    float tmp = (frequency[k] - (float)k * freqPerBin) / freqPerBin * (2.f * Math::Pi / step) + (float)k * expected;
+
+    /* Accumulate delta phase to get bin phase, kept in +/- Pi interval for precision */
+    float phase = sum[k] + tmp;
+    int   qpd = (int)(phase / Math::Pi);
+    if (qpd >= 0)
+      qpd += qpd & 1;
+    else
+      qpd -= qpd & 1;
+    phase -= Math::Pi * (float)qpd;
+    sum[k] = phase;
+
+    /* Get real and imag part */
+    real[k] = magnitude[k] * std::cos(phase);
+    imag[k] = magnitude[k] * std::sin(phase);
+  }
+}
+
+void  Game::Audio::Vocoder::synthesizeVector(const float* magnitude, const float* frequency, float* sum, float* real, float* imag, std::size_t count, float expected, float freqPerBin, float step)
+{
+  std::size_t k = 0;
+
+  // Sine and cosine polynomials over [-Pi/4, Pi/4] (Cephes sinf and cosf)
+  const float sine[] = { -1.6666654611e-1f, 8.3321608736e-3f, -1.9515295891e-4f };
+  const float cosine[] = { 4.166664568298827e-2f, -1.388731625493765e-3f, 2.443315711809948e-5f };
+
+#if defined(__AVX2__)
+  const __m256  offsets = _mm256_setr_ps(0.f, 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f);
+  const __m256  pi = _mm256_set1_ps(Math::Pi);
+
+  // Eight bins at a time
+  for (; k + 8 <= count; k += 8) {
+    __m256  n = _mm256_add_ps(_mm256_set1_ps((float)k), offsets);
+    __m256  tmp = _mm256_add_ps(_mm256_mul_ps(_mm256_div_ps(_mm256_sub_ps(_mm256_loadu_ps(frequency + k), _mm256_mul_ps(n, _mm256_set1_ps(freqPerBin))), _mm256_set1_ps(freqPerBin)), _mm256_set1_ps(2.f * Math::Pi / step)), _mm256_mul_ps(n, _mm256_set1_ps(expected)));
+
+    // Accumulated phase, mapped into +/- Pi interval
+    __m256  phase = _mm256_add_ps(_mm256_loadu_ps(sum + k), tmp);
+    __m256i qpd = _mm256_cvttps_epi32(_mm256_div_ps(phase, pi));
+    __m256i negative = _mm256_srai_epi32(qpd, 31);
+
+    qpd = _mm256_add_epi32(qpd, _mm256_sub_epi32(_mm256_xor_si256(_mm256_and_si256(qpd, _mm256_set1_epi32(1)), negative), negative));
+    phase = _mm256_sub_ps(phase, _mm256_mul_ps(pi, _mm256_cvtepi32_ps(qpd)));
+    _mm256_storeu_ps(sum + k, phase);
+
+    // Reduce to [-Pi/4, Pi/4] by quadrant, Pi/2 split in three parts
+    __m256i quadrant = _mm256_cvtps_epi32(_mm256_mul_ps(phase, _mm256_set1_ps(2.f / Math::Pi)));
+    __m256  q = _mm256_cvtepi32_ps(quadrant);
+    __m256  x = _mm256_sub_ps(_mm256_sub_ps(_mm256_sub_ps(phase, _mm256_mul_ps(q, _mm256_set1_ps(1.5703125f))), _mm256_mul_ps(q, _mm256_set1_ps(4.837512969970703125e-4f))), _mm256_mul_ps(q, _mm256_set1_ps(7.54978995489188216e-8f)));
+    __m256  z = _mm256_mul_ps(x, x);
+    __m256  s = _mm256_add_ps(x, _mm256_mul_ps(_mm256_mul_ps(x, z), _mm256_add_ps(_mm256_set1_ps(sine[0]), _mm256_mul_ps(z, _mm256_add_ps(_mm256_set1_ps(sine[1]), _mm256_mul_ps(z, _mm256_set1_ps(sine[2])))))));
+    __m256  c = _mm256_add_ps(_mm256_sub_ps(_mm256_set1_ps(1.f), _mm256_mul_ps(z, _mm256_set1_ps(0.5f))), _mm256_mul_ps(_mm256_mul_ps(z, z), _mm256_add_ps(_mm256_set1_ps(cosine[0]), _mm256_mul_ps(z, _mm256_add_ps(_mm256_set1_ps(cosine[1]), _mm256_mul_ps(z, _mm256_set1_ps(cosine[2])))))));
+
+    // Swap and negate polynomials according to quadrant
+    __m256  swap = _mm256_castsi256_ps(_mm256_cmpeq_epi32(_mm256_and_si256(quadrant, _mm256_set1_epi32(1)), _mm256_set1_epi32(1)));
+    __m256  sin = _mm256_xor_ps(_mm256_blendv_ps(s, c, swap), _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(quadrant, _mm256_set1_epi32(2)), 30)));
+    __m256  cos = _mm256_xor_ps(_mm256_blendv_ps(c, s, swap), _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(_mm256_add_epi32(quadrant, _mm256_set1_epi32(1)), _mm256_set1_epi32(2)), 30)));
+
+    // Real and imag part
+    _mm256_storeu_ps(real + k, _mm256_mul_ps(_mm256_loadu_ps(magnitude + k), cos));
+    _mm256_storeu_ps(imag + k, _mm256_mul_ps(_mm256_loadu_ps(magnitude + k), sin));
+  }
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+  const __m128  offsets = _mm_setr_ps(0.f, 1.f, 2.f, 3.f);
+  const __m128  pi = _mm_set1_ps(Math::Pi);
+
+  // Four bins at a time, no blend instruction so selections are masked
+  for (; k + 4 <= count; k += 4) {
+    __m128  n = _mm_add_ps(_mm_set1_ps((float)k), offsets);
+    __m128  tmp = _mm_add_ps(_mm_mul_ps(_mm_div_ps(_mm_sub_ps(_mm_loadu_ps(frequency + k), _mm_mul_ps(n, _mm_set1_ps(freqPerBin))), _mm_set1_ps(freqPerBin)), _mm_set1_ps(2.f * Math::Pi / step)), _mm_mul_ps(n, _mm_set1_ps(expected)));
+
+    // Accumulated phase, mapped into +/- Pi interval
+    __m128  phase = _mm_add_ps(_mm_loadu_ps(sum + k), tmp);
+    __m128i qpd = _mm_cvttps_epi32(_mm_div_ps(phase, pi));
+    __m128i negative = _mm_srai_epi32(qpd, 31);
+
+    qpd = _mm_add_epi32(qpd, _mm_sub_epi32(_mm_xor_si128(_mm_and_si128(qpd, _mm_set1_epi32(1)), negative), negative));
+    phase = _mm_sub_ps(phase, _mm_mul_ps(pi, _mm_cvtepi32_ps(qpd)));
+    _mm_storeu_ps(sum + k, phase);
+
+    // Reduce to [-Pi/4, Pi/4] by quadrant, Pi/2 split in three parts
+    __m128i quadrant = _mm_cvtps_epi32(_mm_mul_ps(phase, _mm_set1_ps(2.f / Math::Pi)));
+    __m128  q = _mm_cvtepi32_ps(quadrant);
+    __m128  x = _mm_sub_ps(_mm_sub_ps(_mm_sub_ps(phase, _mm_mul_ps(q, _mm_set1_ps(1.5703125f))), _mm_mul_ps(q, _mm_set1_ps(4.837512969970703125e-4f))), _mm_mul_ps(q, _mm_set1_ps(7.54978995489188216e-8f)));
+    __m128  z = _mm_mul_ps(x, x);
+    __m128  s = _mm_add_ps(x, _mm_mul_ps(_mm_mul_ps(x, z), _mm_add_ps(_mm_set1_ps(sine[0]), _mm_mul_ps(z, _mm_add_ps(_mm_set1_ps(sine[1]), _mm_mul_ps(z, _mm_set1_ps(sine[2])))))));
+    __m128  c = _mm_add_ps(_mm_sub_ps(_mm_set1_ps(1.f), _mm_mul_ps(z, _mm_set1_ps(0.5f))), _mm_mul_ps(_mm_mul_ps(z, z), _mm_add_ps(_mm_set1_ps(cosine[0]), _mm_mul_ps(z, _mm_add_ps(_mm_set1_ps(cosine[1]), _mm_mul_ps(z, _mm_set1_ps(cosine[2])))))));
+
+    // Swap and negate polynomials according to quadrant
+    __m128  swap = _mm_castsi128_ps(_mm_cmpeq_epi32(_mm_and_si128(quadrant, _mm_set1_epi32(1)), _mm_set1_epi32(1)));
+    __m128  sin = _mm_xor_ps(_mm_or_ps(_mm_and_ps(swap, c), _mm_andnot_ps(swap, s)), _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(quadrant, _mm_set1_epi32(2)), 30)));
+    __m128  cos = _mm_xor_ps(_mm_or_ps(_mm_and_ps(swap, s), _mm_andnot_ps(swap, c)), _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(_mm_add_epi32(quadrant, _mm_set1_epi32(1)), _mm_set1_epi32(2)), 30)));
+
+    // Real and imag part
+    _mm_storeu_ps(real + k, _mm_mul_ps(_mm_loadu_ps(magnitude + k), cos));
+    _mm_storeu_ps(imag + k, _mm_mul_ps(_mm_loadu_ps(magnitude + k), sin));
+  }
+#endif
+
+  // Remaining bins
+  for (; k < count; k++) {
+    float tmp = (frequency[k] - (float)k * freqPerBin) / freqPerBin * (2.f * Math::Pi / step) + (float)k * expected;
+    float phase = sum[k] + tmp;
+
+    int qpd = (int)(phase / Math::Pi);
+    if (qpd >= 0)
+      qpd += qpd & 1;
+    else
+      qpd -= qpd & 1;
+    phase -= Math::Pi * (float)qpd;
+    sum[k] = phase;
+
+    real[k] = magnitude[k] * std::cos(phase);
+    imag[k] = magnitude[k] * std::sin(phase);
+  }
+}
+
+void  Game::Audio::Vocoder::benchmark()
+{
+  // Every frame size used by pitch shifting, at synthesizer sample rate
+  benchmark<1024>(22050);
+  benchmark<2048>(22050);
+  benchmark<4096>(22050);
+  benchmark<8192>(22050);
+}
+
+template<std::size_t FrameSize>
+void  Game::Audio::Vocoder::benchmark(std::size_t sampleRate)
+{
+  using Pitch = Game::Audio::Pitch<FrameSize, 4>;
+
+  auto                                  pitch = std::make_unique<Pitch>();
+  std::mt19937                          generator(42);
+  std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+  std::size_t                           repeat = (std::size_t)(1 << 24) / FrameSize;
+  float                                 error = 0.f;
+
+  // Random frame
+  for (auto& sample : pitch->_InFIFO)
+    sample = distribution(generator);
+
+  // Forward and inverse transforms
+  auto  start = std::chrono::steady_clock::now();
+
+  for (std::size_t index = 0; index < repeat; index++) {
+    pitch->forward();
+    pitch->inverse();
+  }
+
+  auto  fft = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  // Round trip gives back windowed frame scaled by FrameSize/2, plus half of DC and Nyquist bins
+  for (std::size_t k = 0; k < Pitch::Half; k++) {
+    error = std::max(error, std::abs((pitch->_FFTreal[k] - (pitch->_Real[0] + pitch->_Real[Pitch::Half]) * 0.5f) / (float)Pitch::Half - pitch->_InFIFO[2 * k + 0] * Pitch::plan().window[2 * k + 0]));
+    error = std::max(error, std::abs((pitch->_FFTimag[k] - (pitch->_Real[0] - pitch->_Real[Pitch::Half]) * 0.5f) / (float)Pitch::Half - pitch->_InFIFO[2 * k + 1] * Pitch::plan().window[2 * k + 1]));
+  }
+
+  // Analysis and synthesis with each vocoder kernel
+  const std::array<std::tuple<const char*, decltype(&Game::Audio::Vocoder::analyzeScalar), decltype(&Game::Audio::Vocoder::synthesizeScalar)>, 2> kernels = {
+    std::tuple{ "scalar", &Game::Audio::Vocoder::analyzeScalar, &Game::Audio::Vocoder::synthesizeScalar },
+    std::tuple{ Game::Audio::Vocoder::Kernel, &Game::Audio::Vocoder::analyzeVector, &Game::Audio::Vocoder::synthesizeVector }
+  };
+  std::array<double, 2> vocoder = { 0. };
+
+  pitch->forward();
+  for (std::size_t index = 0; index < kernels.size(); index++) {
+    const auto& [name, analyze, synthesize] = kernels[index];
+
+    start = std::chrono::steady_clock::now();
+    for (std::size_t count = 0; count < repeat; count++) {
+      analyze(pitch->_Real.data(), pitch->_Imag.data(), pitch->_LastPhase.data(), pitch->_AnaMagn.data(), pitch->_AnaFreq.data(), Pitch::Half + 1, 1.f, (float)sampleRate / (float)FrameSize, 4.f);
+      synthesize(pitch->_AnaMagn.data(), pitch->_AnaFreq.data(), pitch->_SumPhase.data(), pitch->_Real.data(), pitch->_Imag.data(), Pitch::Half + 1, 1.f, (float)sampleRate / (float)FrameSize, 4.f);
+    }
+    vocoder[index] = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  }
+
+  // Complete pitch shift of ten seconds of noise
+  std::vector<float>  samples(sampleRate * 10);
+
+  for (auto& sample : samples)
+    sample = distribution(generator);
+
+  start = std::chrono::steady_clock::now();
+  pitch->shift(samples, sampleRate, 1.5f);
+
+  auto  shift = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  // Report transforms and frames per second
+  std::cout
+    << "[Game::Audio::Pitch] frame " << FrameSize << ": "
+    << "fft " << ((fft > 0.) ? repeat * 2 / fft : 0.) << " transforms/s (error " << error << "), "
+    << "vocoder " << std::get<0>(kernels[0]) << " " << ((vocoder[0] > 0.) ? repeat / vocoder[0] : 0.) << " frames/s, "
+    << std::get<0>(kernels[1]) << " " << ((vocoder[1] > 0.) ? repeat / vocoder[1] : 0.) << " frames/s (x" << ((vocoder[1] > 0.) ? vocoder[0] / vocoder[1] : 0.) << "), "
+    << "shift " << samples.size() / (double)sampleRate << "s of audio in " << shift << "s (x" << ((shift > 0.) ? samples.size() / (double)sampleRate / shift : 0.) << " real-time)." << std::endl;
+}
\ No newline at end of file
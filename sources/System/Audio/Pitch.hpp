@@ -39,6 +39,9 @@
 *****************************************************************************/
 
 #include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
 #include <vector>
 #include <cstring>
 
@@ -48,91 +51,215 @@ namespace Game
 {
   namespace Audio
   {
+    class Vocoder // Phase vocoder loops of Pitch, shared by every frame size
+    {
+    public:
+      static const char* const  Kernel; // Name of instruction set used by vectorized vocoder loops
+
+      static void analyzeScalar(const float* real, const float* imag, float* last, float* magnitude, float* frequency, std::size_t count, float expected, float freqPerBin, float step);     // Magnitude and true frequency of bins [0, count) of spectrum, last phase updated
+      static void analyzeVector(const float* real, const float* imag, float* last, float* magnitude, float* frequency, std::size_t count, float expected, float freqPerBin, float step);     // Same as analyzeScalar, using SSE2 or AVX2 when available
+      static void synthesizeScalar(const float* magnitude, const float* frequency, float* sum, float* real, float* imag, std::size_t count, float expected, float freqPerBin, float step); // Spectrum of bins [0, count) from magnitude and true frequency, phase accumulated in sum
+      static void synthesizeVector(const float* magnitude, const float* frequency, float* sum, float* real, float* imag, std::size_t count, float expected, float freqPerBin, float step); // Same as synthesizeScalar, using SSE2 or AVX2 when available
+
+      static void benchmark();  // Shift noise with frame sizes from 1024 to 8192, report transforms and frames per second
+
+    private:
+      template<std::size_t FrameSize>
+      static void benchmark(std::size_t sampleRate);  // Benchmark of a single frame size
+    };
+
     template<std::size_t FrameSize = 2048, std::size_t Step = 4>
     class Pitch
     {
+      static_assert(FrameSize >= 16 && std::has_single_bit(FrameSize), "FrameSize must be a power of 2.");
+
+      friend class Game::Audio::Vocoder;
+
     private:
-      std::array<float, FrameSize>          _InFIFO;
-      std::array<float, FrameSize>          _OutFIFO;
-      std::array<float, FrameSize * 2>      _FFTworksp;
-      std::array<float, FrameSize / 2 + 1>  _LastPhase;
-      std::array<float, FrameSize / 2 + 1>  _SumPhase;
-      std::array<float, FrameSize * 2>      _OutputAccum;
-      std::array<float, FrameSize>          _AnaFreq;
-      std::array<float, FrameSize>          _AnaMagn;
-      std::array<float, FrameSize>          _SynFreq;
-      std::array<float, FrameSize>          _SynMagn;
+      static const std::size_t  Half = FrameSize / 2; // Points of complex FFT, real frame is packed as (even, odd) sample pairs
+
+      struct Plan // FFT tables, computed once for each frame size
+      {
+        std::array<std::uint32_t, Half>   reverse;      // Bit-reversed index of each point of complex FFT
+        std::array<float, Half / 2>       twiddleReal;  // Complex FFT twiddle factors, exp(-2i.Pi.k/Half)
+        std::array<float, Half / 2>       twiddleImag;
+        std::array<float, Half + 1>       splitReal;    // Real FFT split twiddle factors, exp(-2i.Pi.k/FrameSize)
+        std::array<float, Half + 1>       splitImag;
+        std::array<float, FrameSize>      window;       // Hann window of analysis and synthesis
+
+        Plan()
+        {
+          unsigned int  bits = std::countr_zero(Half);
+
+          // Bit reversal permutation
+          for (std::uint32_t index = 0; index < Half; index++) {
+            reverse[index] = 0;
+            for (unsigned int bit = 0; bit < bits; bit++)
+              reverse[index] |= ((index >> bit) & 1) << (bits - 1 - bit);
+          }
+
+          // Twiddle factors, computed in double precision
+          for (std::size_t k = 0; k < Half / 2; k++) {
+            twiddleReal[k] = (float)std::cos(2. * Math::PiValue<double>() * (double)k / (double)Half);
+            twiddleImag[k] = (float)-std::sin(2. * Math::PiValue<double>() * (double)k / (double)Half);
+          }
+          for (std::size_t k = 0; k <= Half; k++) {
+            splitReal[k] = (float)std::cos(2. * Math::PiValue<double>() * (double)k / (double)FrameSize);
+            splitImag[k] = (float)-std::sin(2. * Math::PiValue<double>() * (double)k / (double)FrameSize);
+          }
+
+          // Window
+          for (std::size_t k = 0; k < FrameSize; k++)
+            window[k] = (float)(-0.5 * std::cos(2. * Math::PiValue<double>() * (double)k / (double)FrameSize) + 0.5);
+        }
+      };
+
+      static const Plan&  plan()
+      {
+        static const Plan instance;
+
+        return instance;
+      }
+
+      std::array<float, FrameSize>      _InFIFO;
+      std::array<float, FrameSize>      _OutFIFO;
+      std::array<float, Half>           _FFTreal;     // Complex FFT workspace
+      std::array<float, Half>           _FFTimag;
+      std::array<float, Half + 1>       _Real;        // Spectrum of positive frequencies
+      std::array<float, Half + 1>       _Imag;
+      std::array<float, Half + 1>       _LastPhase;
+      std::array<float, Half + 1>       _SumPhase;
+      std::array<float, FrameSize * 2>  _OutputAccum;
+      std::array<float, Half + 1>       _AnaFreq;
+      std::array<float, Half + 1>       _AnaMagn;
+      std::array<float, Half + 1>       _SynFreq;
+      std::array<float, Half + 1>       _SynMagn;
 
       /*
-      ** FFT routine, (C)1996 S.M.Bernsee. Sign = -1 is FFT, 1 is iFFT (inverse)
-      ** Fills fftBuffer[0...2*fftFrameSize-1] with the Fourier transform of the
-      ** time domain data in fftBuffer[0...2*fftFrameSize-1]. The FFT array takes
-      ** and returns the cosine and sine parts in an interleaved manner, ie.
-      ** fftBuffer[0] = cosPart[0], fftBuffer[1] = sinPart[0], asf. fftFrameSize
-      ** must be a power of 2. It expects a complex input signal (see footnote 2),
-      ** ie. when working with 'common' audio signals our input signal has to be
-      ** passed as {in[0],0.,in[1],0.,in[2],0.,...} asf. In that case, the transform
-      ** of the frequencies of interest is in fftBuffer[0...fftFrameSize].
+      ** Complex FFT of _FFTreal/_FFTimag[0...Half-1], in-place. Sign = -1 is FFT,
+      ** 1 is iFFT (inverse), unnormalized. Input is expected in bit-reversed order.
+      ** Pairs of radix-2 stages are merged in radix-4 butterflies, halving passes
+      ** over the workspace, a single radix-2 stage is done first when the number
+      ** of stages is odd.
       */
       template <int Sign>
-      void fft()
+      void transform()
       {
-        float tr, ti;
-
-        for (unsigned int i = 2; i < 2 * FrameSize - 2; i += 2) {
-          unsigned int j = 0;
-          for (unsigned int bitm = 2; bitm < 2 * FrameSize; bitm <<= 1) {
-            if (i & bitm)
-              j++;
-            j <<= 1;
-          }
-          if (i < j) {
-            float* p1 = _FFTworksp.data() + i;
-            float* p2 = _FFTworksp.data() + j;
-            float temp = *p1;
-
-            *(p1++) = *p2;
-            *(p2++) = temp;
-            temp = *p1;
-            *p1 = *p2;
-            *p2 = temp;
+        const Plan& table = plan();
+        float*      re = _FFTreal.data();
+        float*      im = _FFTimag.data();
+        std::size_t span = 1;
+
+        // Odd number of stages, single radix-2 stage without twiddle
+        if (std::countr_zero(Half) % 2 == 1) {
+          for (std::size_t i = 0; i < Half; i += 2) {
+            float ar = re[i], ai = im[i];
+            float br = re[i + 1], bi = im[i + 1];
+
+            re[i] = ar + br;
+            im[i] = ai + bi;
+            re[i + 1] = ar - br;
+            im[i + 1] = ai - bi;
           }
+          span = 2;
         }
-        for (unsigned int k = 0, le = 2; k < (unsigned int)((float)std::log(FrameSize) / std::log(2.f) + 0.5f); k++) {
-          le <<= 1;
-
-          unsigned int le2 = le >> 1;
-          float ur = 1.0;
-          float ui = 0.0;
-          float arg = Math::Pi / (le2 >> 1);
-          float wr = std::cos(arg);
-          float wi = Sign * std::sin(arg);
-
-          for (unsigned int j = 0; j < le2; j += 2) {
-            float* p1r = _FFTworksp.data() + j;
-            float* p1i = p1r + 1;
-            float* p2r = p1r + le2;
-            float* p2i = p2r + 1;
-
-            for (unsigned int i = j; i < 2 * FrameSize; i += le) {
-              tr = *p2r * ur - *p2i * ui;
-              ti = *p2r * ui + *p2i * ur;
-              *p2r = *p1r - tr;
-              *p2i = *p1i - ti;
-              *p1r += tr;
-              *p1i += ti;
-              p1r += le;
-              p1i += le;
-              p2r += le;
-              p2i += le;
+
+        // Radix-4 stages
+        for (; span < Half; span *= 4) {
+          std::size_t stride = Half / (span * 2);
+
+          for (std::size_t group = 0; group < Half; group += span * 4) {
+            for (std::size_t j = 0; j < span; j++) {
+              float*  pr = re + group + j;
+              float*  pi = im + group + j;
+
+              // Twiddles of both stages, conjugated for inverse transform
+              float w1r = table.twiddleReal[j * stride], w1i = (float)-Sign * table.twiddleImag[j * stride];
+              float w2r = table.twiddleReal[j * stride / 2], w2i = (float)-Sign * table.twiddleImag[j * stride / 2];
+
+              float ar = pr[0], ai = pi[0];
+              float br = pr[span] * w1r - pi[span] * w1i, bi = pr[span] * w1i + pi[span] * w1r;
+              float cr = pr[span * 2], ci = pi[span * 2];
+              float dr = pr[span * 3] * w1r - pi[span * 3] * w1i, di = pr[span * 3] * w1i + pi[span * 3] * w1r;
+
+              // First stage
+              float a1r = ar + br, a1i = ai + bi;
+              float b1r = ar - br, b1i = ai - bi;
+              float c1r = cr + dr, c1i = ci + di;
+              float d1r = cr - dr, d1i = ci - di;
+
+              // Second stage, odd half rotated by a quarter turn
+              float c2r = c1r * w2r - c1i * w2i, c2i = c1r * w2i + c1i * w2r;
+              float tr = d1r * w2r - d1i * w2i, ti = d1r * w2i + d1i * w2r;
+              float d2r = (float)-Sign * ti, d2i = (float)Sign * tr;
+
+              pr[0] = a1r + c2r;
+              pi[0] = a1i + c2i;
+              pr[span] = b1r + d2r;
+              pi[span] = b1i + d2i;
+              pr[span * 2] = a1r - c2r;
+              pi[span * 2] = a1i - c2i;
+              pr[span * 3] = b1r - d2r;
+              pi[span * 3] = b1i - d2i;
             }
-            tr = ur * wr - ui * wi;
-            ui = ur * wi + ui * wr;
-            ur = tr;
           }
         }
       }
 
+      /*
+      ** Real FFT of windowed _InFIFO[0...FrameSize-1] to _Real/_Imag[0...FrameSize/2].
+      ** Even and odd samples are packed as real and imaginary parts of a complex
+      ** signal of half size, its transform is then split in the spectrum of the
+      ** real frame.
+      */
+      void forward()
+      {
+        const Plan& table = plan();
+
+        // Window and pack in bit-reversed order
+        for (std::size_t n = 0; n < Half; n++) {
+          _FFTreal[table.reverse[n]] = _InFIFO[2 * n + 0] * table.window[2 * n + 0];
+          _FFTimag[table.reverse[n]] = _InFIFO[2 * n + 1] * table.window[2 * n + 1];
+        }
+
+        transform<-1>();
+
+        // Split spectrums of even and odd samples
+        for (std::size_t k = 0; k <= Half; k++) {
+          float zr = _FFTreal[k % Half], zi = _FFTimag[k % Half];
+          float cr = _FFTreal[(Half - k) % Half], ci = -_FFTimag[(Half - k) % Half];
+          float er = (zr + cr) * 0.5f, ei = (zi + ci) * 0.5f;
+          float or_ = (zi - ci) * 0.5f, oi = (cr - zr) * 0.5f;
+
+          _Real[k] = er + table.splitReal[k] * or_ - table.splitImag[k] * oi;
+          _Imag[k] = ei + table.splitReal[k] * oi + table.splitImag[k] * or_;
+        }
+      }
+
+      /*
+      ** Real part of the inverse FFT of _Real/_Imag[0...FrameSize/2], negative
+      ** frequencies being zero. Result is left in _FFTreal/_FFTimag as even and
+      ** odd samples of the frame.
+      */
+      void inverse()
+      {
+        const Plan& table = plan();
+
+        // Hermitian spectrum with same real part, merged in a complex spectrum of half size
+        for (std::size_t k = 0; k < Half; k++) {
+          float hr = (k == 0) ? _Real[0] : _Real[k] * 0.5f, hi = (k == 0) ? 0.f : _Imag[k] * 0.5f;
+          float cr = (k == 0) ? _Real[Half] : _Real[Half - k] * 0.5f, ci = (k == 0) ? 0.f : -_Imag[Half - k] * 0.5f;
+          float er = hr + cr, ei = hi + ci;
+          float dr = hr - cr, di = hi - ci;
+          float or_ = dr * table.splitReal[k] + di * table.splitImag[k], oi = di * table.splitReal[k] - dr * table.splitImag[k];
+
+          _FFTreal[table.reverse[k]] = er - oi;
+          _FFTimag[table.reverse[k]] = ei + or_;
+        }
+
+        transform<1>();
+      }
+
     public:
       Pitch() = default;
       ~Pitch() = default;
@@ -150,10 +277,15 @@ namespace Game
       */
       void shift(std::vector<float>& samples, std::size_t sampleRate, const std::vector<std::pair<std::size_t, float>>& pitchShifts)
       {
+        const Plan& table = plan();
+
         // Reset data arrays
         _InFIFO.fill(0.f);
         _OutFIFO.fill(0.f);
-        _FFTworksp.fill(0.f);
+        _FFTreal.fill(0.f);
+        _FFTimag.fill(0.f);
+        _Real.fill(0.f);
+        _Imag.fill(0.f);
         _LastPhase.fill(0.f);
         _SumPhase.fill(0.f);
         _OutputAccum.fill(0.f);
@@ -184,52 +316,12 @@ namespace Game
           if (gRover >= FrameSize) {
             gRover = FrameSize - FrameSize / Step;
 
-            /* Do windowing and re,im interleave */
-            for (std::size_t k = 0; k < FrameSize; k++) {
-              _FFTworksp[2 * k] = _InFIFO[k] * (-0.5f * std::cos(2.f * Math::Pi * (float)k / (float)FrameSize) + 0.5f);
-              _FFTworksp[2 * k + 1] = 0.f;
-            }
-
             /* ***************** ANALYSIS ******************* */
-            /* Do transform */
-            fft<-1>();
+            /* Do windowing and transform */
+            forward();
 
             /* This is the analysis step */
-            for (std::size_t k = 0; k <= FrameSize / 2; k++)
-            {
-              /* De-interlace FFT buffer */
-              float real = _FFTworksp[2 * k];
-              float imag = _FFTworksp[2 * k + 1];
-
-              /* Compute magnitude and phase */
-              float magnitude = 2.f * std::sqrt(real * real + imag * imag);
-              float phase = std::atan2(imag, real);
-
-              /* Compute phase difference */
-              float tmp = phase - _LastPhase[k];
-              _LastPhase[k] = phase;
-
-              /* Subtract expected phase difference */
-              tmp -= (float)k * expected;
-
-              /* Map delta phase into +/- Pi interval */
-              int qpd = (int)(tmp / Math::Pi);
-              if (qpd >= 0)
-                qpd += qpd & 1;
-              else
-                qpd -= qpd & 1;
-              tmp -= Math::Pi * (float)qpd;
-
-              /* Get deviation from bin frequency from the +/- Pi interval */
-              tmp = Step * tmp / (2.f * Math::Pi);
-
-              /* Compute the k-th partials' true frequency */
-              tmp = (float)k * freqPerBin + tmp * freqPerBin;
-
-              /* Store magnitude and true frequency in analysis arrays */
-              _AnaMagn[k] = magnitude;
-              _AnaFreq[k] = tmp;
-            }
+            Game::Audio::Vocoder::analyzeVector(_Real.data(), _Imag.data(), _LastPhase.data(), _AnaMagn.data(), _AnaFreq.data(), Half + 1, expected, freqPerBin, (float)Step);
 
             /* ***************** PROCESSING ******************* */
             /* This does the actual pitch shifting */
@@ -251,43 +343,16 @@ namespace Game
 
             /* ***************** SYNTHESIS ******************* */
             /* This is the synthesis step */
-            for (std::size_t k = 0; k <= FrameSize / 2; k++)
-            {
-              /* Get magnitude and true frequency from synthesis arrays */
-              float magnitude = _SynMagn[k];
-              float tmp = _SynFreq[k];
-
-              /* Subtract bin mid frequency */
-              tmp -= (float)k * freqPerBin;
-
-              /* Get bin deviation from freq deviation */
-              tmp /= freqPerBin;
+            Game::Audio::Vocoder::synthesizeVector(_SynMagn.data(), _SynFreq.data(), _SumPhase.data(), _Real.data(), _Imag.data(), Half + 1, expected, freqPerBin, (float)Step);
 
-              /* Take Step into account */
-              tmp = 2.f * Math::Pi * tmp / Step;
-
-              /* Add the overlap phase advance back in */
-              tmp += (float)k * expected;
-
-              /* Accumulate delta phase to get bin phase */
-              _SumPhase[k] += tmp;
-              float phase = _SumPhase[k];
-
-              /* Get real and imag part and re-interleave */
-              _FFTworksp[2 * k] = magnitude * std::cos(phase);
-              _FFTworksp[2 * k + 1] = magnitude * std::sin(phase);
-            }
-
-            /* Zero negative frequencies */
-            for (std::size_t k = FrameSize + 2; k < 2 * FrameSize; k++)
-              _FFTworksp[k] = 0.;
-
-            /* Do inverse transform */
-            fft<1>();
+            /* Do inverse transform, negative frequencies are zero */
+            inverse();
 
             /* Do windowing and add to output accumulator */
-            for (std::size_t k = 0; k < FrameSize; k++)
-              _OutputAccum[k] += 2.f * (-0.5f * std::cos(2.f * Math::Pi * (float)k / (float)FrameSize) + 0.5f) * _FFTworksp[2 * k] / (FrameSize / 2 * Step);
+            for (std::size_t k = 0; k < Half; k++) {
+              _OutputAccum[2 * k + 0] += 2.f * table.window[2 * k + 0] * _FFTreal[k] / (FrameSize / 2 * Step);
+              _OutputAccum[2 * k + 1] += 2.f * table.window[2 * k + 1] * _FFTimag[k] / (FrameSize / 2 * Step);
+            }
             for (std::size_t k = 0; k < FrameSize / Step; k++)
               _OutFIFO[k] = _OutputAccum[k];
 
@@ -10,16 +10,36 @@
 #include <algorithm>
 #include <future>
 #include <set>
+#include <chrono>
+
+#ifdef _WIN32
+# include <windows.h>
+# include <psapi.h>
+#else
+# include <unistd.h>
+#endif
 
 #include "System/Audio/Soundfont.hpp"
 #include "System/Config.hpp"
 #include "System/Utilities.hpp"
 
-Game::Audio::Soundfont::Soundfont(const std::filesystem::path& filename) :
+Game::Audio::Soundfont::Soundfont(const std::filesystem::path& filename, Game::Audio::Soundfont::Storage storage) :
+  _storage(storage),
+  _mapping(),
+  _raw(),
+  _table(),
+  _zones(),
   info(),
   presets(),
   samples()
 {
+  // No preset defined
+  _table.fill(Game::Audio::Soundfont::NoPreset);
+
+  // Map file, samples are read from it
+  if (_storage == Game::Audio::Soundfont::Storage::StorageMapped)
+    _mapping = std::make_unique<Game::MappedFile>(filename);
+
   // Load file
   load(filename);
 }
@@ -261,6 +281,18 @@ void  Game::Audio::Soundfont::loadSectionListSdta(std::ifstream& file, const Gam
     file.seekg(position + sdta_position, file.beg);
     Game::Utilities::read(file, &sdta);
 
+    // Keep 16 bits samples in mapped file, 24 bits extension is ignored
+    if (_storage == Game::Audio::Soundfont::Storage::StorageMapped) {
+      std::size_t offset = (std::size_t)(std::streamoff)(position + sdta_position) + sizeof(sdta);
+
+      if (sdta.name == Game::Utilities::str_to_key<uint32_t>("smpl")) {
+        if (offset + sdta.size > _mapping->size() || sdta.size % sizeof(int16_t) != 0)
+          throw std::runtime_error((std::string(__FILE__) + ": l." + std::to_string(__LINE__)).c_str());
+        _raw = std::span<const int16_t>((const int16_t*)(_mapping->data() + offset), sdta.size / sizeof(int16_t));
+      }
+      continue;
+    }
+
     // Matching subsections
     std::unordered_map<uint32_t, std::function<void()>> sdta_commands = {
       { Game::Utilities::str_to_key<uint32_t>("smpl"), std::bind(&Game::Audio::Soundfont::loadSubsection<int16_t>, this, std::ref(file), sdta.size, std::ref(samples16)) },
@@ -284,6 +316,10 @@ void  Game::Audio::Soundfont::loadSectionListSdta(std::ifstream& file, const Gam
     ;
 #endif
 
+  // Samples are not converted when mapped
+  if (_storage == Game::Audio::Soundfont::Storage::StorageMapped)
+    return;
+
   // Set 24 bits complementary to 0 if absent or incomplete
   if (samples24.size() < samples16.size())
     samples24.resize(samples16.size(), 0);
@@ -357,7 +393,21 @@ void  Game::Audio::Soundfont::loadSectionListPdta(std::ifstream& file, const Gam
 
   // Build presets
   for (int preset_index = 0; preset_index < presetHeaders.size() - 1; preset_index++) {
-    Game::Audio::Soundfont::Preset&   preset = presets[(uint8_t)presetHeaders[preset_index].bank][(uint8_t)presetHeaders[preset_index].midi];
+    // MIDI preset number out of range
+    if (presetHeaders[preset_index].midi > 127) {
+      std::cerr << "[Game::Soundfont::load]: Warning, invalid MIDI preset number (" << presetHeaders[preset_index].midi << "), ignored." << std::endl;
+      continue;
+    }
+
+    uint16_t& preset_table = _table[(uint8_t)presetHeaders[preset_index].bank * 128 + presetHeaders[preset_index].midi];
+
+    // New preset, instruments are added to existing one otherwise
+    if (preset_table == Game::Audio::Soundfont::NoPreset) {
+      preset_table = (uint16_t)presets.size();
+      presets.emplace_back();
+    }
+
+    Game::Audio::Soundfont::Preset&   preset = presets[preset_table];
     Game::Audio::Soundfont::Generator preset_generator_global;
     int                               preset_bag_start = presetHeaders[preset_index + 0].bag;
     int                               preset_bag_end = presetHeaders[preset_index + 1].bag;
@@ -452,6 +502,33 @@ void  Game::Audio::Soundfont::loadSectionListPdta(std::ifstream& file, const Gam
     }
   }
 
+  // Flatten zones of every preset, ranges of preset and instrument zones are merged
+  for (auto& preset : presets) {
+    preset.zoneStart = _zones.size();
+    for (const auto& instrument : preset.instruments) {
+      for (const auto& bag : instrument.bags) {
+        Game::Audio::Soundfont::Zone  zone = {
+          .instrument = &instrument,
+          .bag = &bag,
+          .keyLow = std::max(instrument.generator[Game::Audio::Soundfont::Sf2Generator::KeyRange].range.low, bag.generator[Game::Audio::Soundfont::Sf2Generator::KeyRange].range.low),
+          .keyHigh = std::min(instrument.generator[Game::Audio::Soundfont::Sf2Generator::KeyRange].range.high, bag.generator[Game::Audio::Soundfont::Sf2Generator::KeyRange].range.high),
+          .velocityLow = std::max(instrument.generator[Game::Audio::Soundfont::Sf2Generator::VelocityRange].range.low, bag.generator[Game::Audio::Soundfont::Sf2Generator::VelocityRange].range.low),
+          .velocityHigh = std::min(instrument.generator[Game::Audio::Soundfont::Sf2Generator::VelocityRange].range.high, bag.generator[Game::Audio::Soundfont::Sf2Generator::VelocityRange].range.high)
+        };
+
+        // Zone can't be played
+        if (zone.keyLow > zone.keyHigh || zone.velocityLow > zone.velocityHigh)
+          continue;
+
+        _zones.push_back(zone);
+      }
+    }
+    preset.zoneEnd = _zones.size();
+  }
+
+  // Number of 16 bits samples available
+  std::size_t samples_size = (_storage == Game::Audio::Soundfont::Storage::StorageMapped) ? _raw.size() : samplesFloat.size();
+
   // Build samples
   for (const auto& sample : sampleHeaders)
   {
@@ -465,6 +542,8 @@ void  Game::Audio::Soundfont::loadSectionListPdta(std::ifstream& file, const Gam
     // Default values
     samples.back().name = "";
     samples.back().samples = { 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f };
+    samples.back().mapped = nullptr;
+    samples.back().size = samples.back().samples.size();
     samples.back().start = 2;
     samples.back().end = 6;
     samples.back().rate = 22050;
@@ -486,7 +565,7 @@ void  Game::Audio::Soundfont::loadSectionListPdta(std::ifstream& file, const Gam
       sample.loopEnd < sample.sampleStart || sample.loopEnd > sample.loopEnd ||
       sample.loopStart >= sample.loopEnd ||
       sample.sampleStart >= sample.sampleEnd ||
-      sample.sampleStart >= samplesFloat.size() || sample.sampleEnd >= samplesFloat.size()) {
+      sample.sampleStart >= samples_size || sample.sampleEnd >= samples_size) {
       std::cerr << "[Game::Soundfont::load]: Warning, invalid sample points, ignored." << std::endl;
       continue;
     }
@@ -501,10 +580,113 @@ void  Game::Audio::Soundfont::loadSectionListPdta(std::ifstream& file, const Gam
     samples.back().type = (Game::Audio::Soundfont::Sample::Link)sample.sampleType;
     samples.back().link = sample.sampleLink;
 
+    samples.back().size = sample.sampleEnd - sample.sampleStart;
+
+    // Point to mapped samples
+    if (_storage == Game::Audio::Soundfont::Storage::StorageMapped) {
+      samples.back().samples.clear();
+      samples.back().mapped = _raw.data() + sample.sampleStart;
+    }
+
     // Copy samples
-    samples.back().samples.resize(sample.sampleEnd - sample.sampleStart, 0.f);
-    for (auto index = sample.sampleStart; index < sample.sampleEnd; index++)
-      samples.back().samples[index - sample.sampleStart] = samplesFloat[index];
+    else {
+      samples.back().samples.resize(sample.sampleEnd - sample.sampleStart, 0.f);
+      for (auto index = sample.sampleStart; index < sample.sampleEnd; index++)
+        samples.back().samples[index - sample.sampleStart] = samplesFloat[index];
+    }
+  }
+}
+
+const Game::Audio::Soundfont::Preset* Game::Audio::Soundfont::find(uint8_t bank, uint8_t program) const
+{
+  // Invalid MIDI preset number
+  if (program > 127)
+    return nullptr;
+
+  uint16_t  index = _table[bank * 128 + program];
+
+  return (index == Game::Audio::Soundfont::NoPreset) ? nullptr : &presets[index];
+}
+
+std::span<const Game::Audio::Soundfont::Zone> Game::Audio::Soundfont::zones(const Game::Audio::Soundfont::Preset& preset) const
+{
+  return std::span<const Game::Audio::Soundfont::Zone>(_zones.data() + preset.zoneStart, _zones.data() + preset.zoneEnd);
+}
+
+std::size_t Game::Audio::Soundfont::resident()
+{
+#ifdef _WIN32
+  ::PROCESS_MEMORY_COUNTERS counters = {};
+
+  // Working set of current process
+  if (::K32GetProcessMemoryInfo(::GetCurrentProcess(), &counters, sizeof(counters)) == FALSE)
+    return 0;
+  return counters.WorkingSetSize;
+#else
+  std::ifstream file("/proc/self/statm");
+  std::size_t   size = 0;
+  std::size_t   pages = 0;
+
+  // Second field is number of resident pages
+  if (!(file >> size >> pages))
+    return 0;
+  return pages * (std::size_t)::sysconf(_SC_PAGESIZE);
+#endif
+}
+
+void  Game::Audio::Soundfont::benchmark(const std::filesystem::path& soundfont)
+{
+  // Mapped storage first, memory of float storage might not be returned to system when freed
+  for (auto storage : { Game::Audio::Soundfont::Storage::StorageMapped, Game::Audio::Soundfont::Storage::StorageFloat })
+  {
+    std::size_t before = Game::Audio::Soundfont::resident();
+
+    // Load soundfont
+    auto  start = std::chrono::steady_clock::now();
+    auto  font = std::make_unique<Game::Audio::Soundfont>(soundfont, storage);
+    auto  load = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::size_t loaded = Game::Audio::Soundfont::resident();
+    std::size_t size = 0;
+    float       checksum = 0.f;
+
+    // Read every sample as voices would, mapped pages are loaded
+    for (const auto& sample : font->samples) {
+      for (std::size_t index = 0; index < sample.size; index++)
+        checksum += (sample.mapped != nullptr) ? (float)sample.mapped[index] / 32768.f : sample.samples[index];
+      size += sample.size * ((sample.mapped != nullptr) ? sizeof(int16_t) : sizeof(float));
+    }
+
+    std::size_t touched = Game::Audio::Soundfont::resident();
+    std::size_t lookups = 0;
+    std::size_t matches = 0;
+
+    // Find zones of every key of every bank/MIDI preset number
+    start = std::chrono::steady_clock::now();
+    for (unsigned int bank = 0; bank < 256; bank++) {
+      for (uint8_t program = 0; program < 128; program++) {
+        const auto* preset = font->find((uint8_t)bank, program);
+
+        for (uint8_t key = 0; key < 128; key++, lookups++)
+          if (preset != nullptr)
+            for (const auto& zone : font->zones(*preset))
+              matches += (key >= zone.keyLow && key <= zone.keyHigh && zone.velocityLow <= 100 && zone.velocityHigh >= 100) ? 1 : 0;
+      }
+    }
+
+    auto  lookup = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    // Report load time and memory
+    std::cout
+      << "[Game::Audio::Soundfont] " << soundfont.filename().string() << ": "
+      << ((storage == Game::Audio::Soundfont::Storage::StorageMapped) ? "mapped" : "float") << " storage, "
+      << "loaded in " << load << "s, "
+      << "resident +" << (double)(loaded - std::min(loaded, before)) / (1024. * 1024.) << "MB after load, "
+      << "+" << (double)(touched - std::min(touched, before)) / (1024. * 1024.) << "MB after reading samples, "
+      << "samples " << (double)size / (1024. * 1024.) << "MB, "
+      << font->presets.size() << " presets, " << font->_zones.size() << " zones, "
+      << "lookup " << ((lookups > 0) ? lookup / (double)lookups * 1000000000. : 0.) << "ns/key (" << matches << " matches), "
+      << "checksum " << checksum << "." << std::endl;
   }
 }
 
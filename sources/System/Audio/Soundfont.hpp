@@ -1,13 +1,15 @@
 #pragma once
 
+#include <array>
 #include <filesystem>
 #include <fstream>
 #include <exception>
+#include <memory>
+#include <span>
 #include <string>
-#include <list>
-#include <unordered_map>
 #include <vector>
 
+#include "System/MappedFile.hpp"
 #include "System/Utilities.hpp"
 
 namespace Game
@@ -16,6 +18,13 @@ namespace Game
   {
     class Soundfont
     {
+    public:
+      enum Storage : uint8_t
+      {
+        StorageFloat,   // Samples converted to float at load, with 24 bits extension
+        StorageMapped   // Samples kept as 16 bits in memory-mapped file, converted when rendered
+      };
+
 #pragma pack(push, 1)
     private:
       struct Sf2Header
@@ -290,13 +299,25 @@ namespace Game
             Soundfont::Modulator  modulator;  // Modulator of the instrument
           };
 
-          std::string                 name;       // Instrument name
-          Soundfont::Generator        generator;  // Preset (global) generator
-          std::list<Instrument::Bag>  bags;       // Bags of the instrument
+          std::string                   name;       // Instrument name
+          Soundfont::Generator          generator;  // Preset (global) generator
+          std::vector<Instrument::Bag>  bags;       // Bags of the instrument
         };
 
-        std::string                   name;         // Name of the preset
-        std::list<Preset::Instrument> instruments;  // Instruments of the preset
+        std::string                     name;         // Name of the preset
+        std::vector<Preset::Instrument> instruments;  // Instruments of the preset
+        std::size_t                     zoneStart;    // Index of first zone of the preset in zone table
+        std::size_t                     zoneEnd;      // Index after last zone of the preset in zone table
+      };
+
+      struct Zone
+      {
+        const Soundfont::Preset::Instrument*      instrument;   // Preset zone
+        const Soundfont::Preset::Instrument::Bag* bag;          // Instrument zone
+        uint8_t                                   keyLow;       // Key range of both zones
+        uint8_t                                   keyHigh;
+        uint8_t                                   velocityLow;  // Velocity range of both zones
+        uint8_t                                   velocityHigh;
       };
 
       struct Sample
@@ -309,7 +330,9 @@ namespace Game
         };
 
         std::string         name;       // Name of the sample
-        std::vector<float>  samples;    // Samples stored in float format [-1:+1[
+        std::vector<float>  samples;    // Samples stored in float format [-1:+1[, empty when mapped
+        const int16_t*      mapped;     // Samples stored in 16 bits format in mapped file, nullptr when in float format
+        std::size_t         size;       // Number of samples
         std::size_t         start;      // Index of the first sample of the loop
         std::size_t         end;        // Index of the first sample after the loop
         std::size_t         rate;       // Sample rate of the sample
@@ -319,12 +342,29 @@ namespace Game
         std::size_t         link;       // Index of other channel for stereo samples
       };
 
-      Soundfont(const std::filesystem::path& filename);
+    private:
+      static const uint16_t NoPreset = 0xFFFF; // Undefined bank/MIDI preset number in preset table
+
+      static std::size_t  resident(); // Resident memory of process in bytes, 0 if unavailable
+
+      Soundfont::Storage                  _storage; // Storage of samples
+      std::unique_ptr<Game::MappedFile>   _mapping; // Mapped soundfont file, when samples are mapped
+      std::span<const int16_t>            _raw;     // 16 bits samples of sdta section, in mapped file
+      std::array<uint16_t, 256 * 128>     _table;   // Index of preset for each bank/MIDI preset number
+      std::vector<Soundfont::Zone>        _zones;   // Zones of every preset, contiguous for each preset
+
+    public:
+      Soundfont(const std::filesystem::path& filename, Soundfont::Storage storage = Soundfont::Storage::StorageFloat);
       ~Soundfont() = default;
 
-      Soundfont::Info                                                             info;     // General informations
-      std::unordered_map<uint8_t, std::unordered_map<uint8_t, Soundfont::Preset>> presets;  // Presets ordered by bank/MIDI preset number
-      std::vector<Soundfont::Sample>                                              samples;  // Samples used by presets
+      const Soundfont::Preset*          find(uint8_t bank, uint8_t program) const;    // Preset of bank/MIDI preset number, nullptr if undefined
+      std::span<const Soundfont::Zone>  zones(const Soundfont::Preset& preset) const; // Zones of preset, key and velocity ranges to be checked
+
+      Soundfont::Info                 info;     // General informations
+      std::vector<Soundfont::Preset>  presets;  // Presets, in order of first definition
+      std::vector<Soundfont::Sample>  samples;  // Samples used by presets
+
+      static void benchmark(const std::filesystem::path& soundfont);  // Load soundfont with each storage, report load time and resident memory
     };
   }
 }
\ No newline at end of file
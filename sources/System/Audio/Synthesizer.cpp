@@ -1,7 +1,18 @@
-#include <future>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
 #include <list>
+#include <string>
+#include <tuple>
 
+#if defined(__AVX2__) || defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+# include <immintrin.h>
+#endif
+
+#include "Math/Math.hpp"
 #include "System/Audio/Synthesizer.hpp"
+#include "System/ThreadPool.hpp"
 
 // TODO: remove this
 #include <SFML/System.hpp>
@@ -45,12 +56,11 @@ void  toWave(const std::filesystem::path& filename, const std::vector<float>& bu
   out.write((char*)buffer16.data(), buffer16.size() * 2);
 }
 
-Game::Audio::Synthesizer::Synthesizer(const std::filesystem::path& midi, const std::filesystem::path& soundfont, std::size_t sampleRate) :
+Game::Audio::Synthesizer::Synthesizer(const std::filesystem::path& midi, const std::filesystem::path& soundfont, std::size_t sampleRate, Game::Audio::Soundfont::Storage storage) :
   _sampleRate(sampleRate),
   _buffer(),
-  _bufferLock(),
   midi(midi),
-  soundfont(soundfont)
+  soundfont(soundfont, storage)
 {}
 
 std::vector<float>  Game::Audio::Synthesizer::generate(std::size_t sequenceId)
@@ -62,67 +72,77 @@ std::vector<float>  Game::Audio::Synthesizer::generate(std::size_t sequenceId)
   // TODO: remove this
   sf::Clock clock;
 
-  Game::Audio::Midi::Sequence   sequence = *std::next(midi.sequences.begin(), sequenceId);
-  std::list<std::future<void>>  tasks;
+  Game::Audio::Midi::Sequence                   sequence = *std::next(midi.sequences.begin(), sequenceId);
+  Game::ThreadPool                              pool(Game::Config::ThreadNumber);
+  std::vector<Game::Audio::Synthesizer::Voice>  voices;
 
   // Resize rendering buffer
   _buffer.clear();
   _buffer.resize((std::size_t)((sequence.metadata.end * (float)_sampleRate) + 1) * 2, 0.f);
 
-  // Run a task for each channel of each track
-  for (const auto& [track_id, track] : sequence.tracks) {
-    for (auto& channel : track.channel)
-    {
-      // Skip empty channels
-      if (channel.events.empty() == true)
-        continue;
-
-      // Execute task
-      tasks.push_back(std::async(std::launch::async, [this, &sequence, &track, &channel]
-        {
-          // Generate channel
-          generateChannel(sequence, track, channel);
-        }));
-    }
-  }
-
-  // Wait for rendering tasks to complete
-  for (auto& task : tasks)
-    task.wait();
+  // List voices of each channel of each track
+  for (const auto& [track_id, track] : sequence.tracks)
+    for (const auto& channel : track.channel)
+      generateChannel(sequence, track, channel, voices);
+
+  // Render each voice in its own buffer
+  for (auto& voice : voices)
+    pool.push([this, &sequence, &voice]()
+      {
+        generateInstrument(sequence, voice);
+      });
+  pool.wait();
+
+  std::size_t         slices = pool.size() * Game::Audio::Synthesizer::MergeSlices;
+  std::size_t         frames = _buffer.size() / 2;
+  std::vector<float>  maximums(slices, 1.f);
+
+  // Merge voices, each job sums voices in its own slice of rendering buffer
+  for (std::size_t slice = 0; slice < slices; slice++)
+    pool.push([this, &voices, &maximums, slice, slices, frames]()
+      {
+        std::size_t begin = frames * (slice + 0) / slices;
+        std::size_t end = frames * (slice + 1) / slices;
+
+        // Add part of each voice overlapping slice
+        for (const auto& voice : voices) {
+          std::size_t voice_begin = std::max(begin, voice.offset);
+          std::size_t voice_end = std::min(end, voice.offset + voice.buffer.size() / 2);
+
+          for (std::size_t index = voice_begin * 2; index < voice_end * 2; index++)
+            _buffer[index] += voice.buffer[index - voice.offset * 2];
+        }
 
-  float max = 1.f;
+        // Get max value of slice
+        for (std::size_t index = begin * 2; index < end * 2; index++)
+          maximums[slice] = std::max(maximums[slice], std::abs(_buffer[index]));
+      });
+  pool.wait();
 
-  // Get max value of buffer
-  for (float sample : _buffer)
-    max = std::max(max, std::abs(sample));
+  float max = *std::max_element(maximums.begin(), maximums.end());
 
   // Normalize buffer
-  for (float& sample : _buffer)
-    sample = sample / max;
+  for (std::size_t slice = 0; slice < slices; slice++)
+    pool.push([this, max, slice, slices, frames]()
+      {
+        for (std::size_t index = frames * (slice + 0) / slices * 2; index < frames * (slice + 1) / slices * 2; index++)
+          _buffer[index] = _buffer[index] / max;
+      });
+  pool.wait();
 
-  std::cout << "Generation time: " << clock.getElapsedTime().asSeconds() << "s." << std::endl;
+  std::cout << "Generation time: " << clock.getElapsedTime().asSeconds() << "s (" << voices.size() << " voices, " << pool.size() + 1 << " threads, peak " << pool.peak() << " running)." << std::endl;
 
   puts("Creating WAVE file...");
-  ::toWave(Game::Config::ExecutablePath / "/generated.wav", _buffer, _sampleRate);
+  ::toWave(Game::Config::ExecutablePath / "generated.wav", _buffer, _sampleRate);
   puts("Done.");
 
   return _buffer;
 }
 
-void  Game::Audio::Synthesizer::generateChannel(const Game::Audio::Midi::Sequence& sequence, const Game::Audio::Midi::Sequence::Track& track, const Game::Audio::Midi::Sequence::Track::Channel& channel)
+void  Game::Audio::Synthesizer::generateChannel(const Game::Audio::Midi::Sequence& sequence, const Game::Audio::Midi::Sequence::Track& track, const Game::Audio::Midi::Sequence::Track::Channel& channel, std::vector<Game::Audio::Synthesizer::Voice>& voices)
 {
-  Game::Audio::Synthesizer::Note  note = {
-    .key = 0,
-    .velocity = 0,
-    .polyphonic = 0,
-
-    .channel_pitch = 0,
-    .channel_program = 0,
-    .channel_controllers = { 0 }
-  };
-
-  std::array<uint8_t, 128>      polyphonics = { 0 };  // Pressure on channel keys
-  std::list<std::future<void>>  tasks;
+  Game::Audio::Synthesizer::Note  note = Game::Audio::Synthesizer::initialNote();
+  std::array<uint8_t, 128>        polyphonics = { 0 };  // Pressure on channel keys
 
   // Process each event of channel
   for (auto event = channel.events.begin(); event != channel.events.end(); event++)
@@ -136,11 +156,8 @@ void  Game::Audio::Synthesizer::generateChannel(const Game::Audio::Midi::Sequenc
         note.velocity = event->data.note.velocity;
         note.polyphonic = polyphonics[note.key];
 
-        tasks.push_back(std::async(std::launch::async, [this, &sequence, &track, &channel, event, note]
-          {
-            // Generate note
-            generateNote(sequence, track, channel, event, note);
-          }));
+        // List voices of note
+        generateNote(sequence, track, channel, event, note, voices);
       }
       break;
 
@@ -164,13 +181,9 @@ void  Game::Audio::Synthesizer::generateChannel(const Game::Audio::Midi::Sequenc
       throw std::runtime_error((std::string(__FILE__) + ": l." + std::to_string(__LINE__)).c_str());
     }
   }
-
-  // Wait for rendering tasks to complete
-  for (auto& task : tasks)
-    task.wait();
 }
 
-void  Game::Audio::Synthesizer::generateNote(const Game::Audio::Midi::Sequence& sequence, const Game::Audio::Midi::Sequence::Track& track, const Game::Audio::Midi::Sequence::Track::Channel& channel, std::list<Game::Audio::Midi::Sequence::Track::Channel::Event>::const_iterator event, Game::Audio::Synthesizer::Note note)
+void  Game::Audio::Synthesizer::generateNote(const Game::Audio::Midi::Sequence& sequence, const Game::Audio::Midi::Sequence::Track& track, const Game::Audio::Midi::Sequence::Track::Channel& channel, std::list<Game::Audio::Midi::Sequence::Track::Channel::Event>::const_iterator event, Game::Audio::Synthesizer::Note note, std::vector<Game::Audio::Synthesizer::Voice>& voices, std::size_t* skipped)
 {
   // Get current bank number
   uint8_t program = note.channel_program;
@@ -178,54 +191,805 @@ void  Game::Audio::Synthesizer::generateNote(const Game::Audio::Midi::Sequence&
     + note.channel_controllers[Game::Audio::Midi::Sequence::Track::Channel::Controller::ControllerBankSelectFine] * 128
     + (&channel == &track.channel[9] ? 128 : 0);
 
+  // Get preset to be played
+  const auto* preset = soundfont.find(bank, program);
+
   // Check a preset exist for given bank/key
-  if (soundfont.presets.find(bank) == soundfont.presets.end() ||
-    soundfont.presets.find(bank)->second.find(program) == soundfont.presets.find(bank)->second.end()) {
-    std::cerr << "[Game::Midi::generate]: Warning, no preset for MIDI bank/program (bank: " << (int)bank << ", program: " << (int)program << ", time: " << event->clock << "s)." << std::endl;
+  if (preset == nullptr) {
+    if (skipped != nullptr)
+      (*skipped)++;
+    else
+      std::cerr << "[Game::Midi::generate]: Warning, no preset for MIDI bank/program (bank: " << (int)bank << ", program: " << (int)program << ", time: " << event->clock << "s)." << std::endl;
     return;
   }
 
-  std::list<std::future<void>>  tasks;
+  // Find zones to generate, key and velocity ranges of preset and instrument zones are merged
+  for (const auto& zone : soundfont.zones(*preset))
+  {
+    // Check zone's key and velocity range
+    if (note.key < zone.keyLow || note.key > zone.keyHigh || note.velocity < zone.velocityLow || note.velocity > zone.velocityHigh)
+      continue;
+
+    // Instrument bag to be rendered
+    voices.push_back({
+      .track = &track,
+      .channel = &channel,
+      .event = event,
+      .note = note,
+      .preset = preset,
+      .instrument = zone.instrument,
+      .bag = zone.bag,
+      .offset = (std::size_t)(event->clock * (float)_sampleRate),
+      .buffer = {}
+      });
+  }
+}
 
-  // Get preset to be played
-  const auto& preset = soundfont.presets.find(bank)->second.find(program)->second;
-  
-  // Find instrument bag to generate
-  for (const auto& instrument : preset.instruments) {
-    for (const auto& bag : instrument.bags)
+void  Game::Audio::Synthesizer::generateInstrument(const Game::Audio::Midi::Sequence& sequence, Game::Audio::Synthesizer::Voice& voice)
+{
+  using Controller = Game::Audio::Midi::Sequence::Track::Channel::Controller;
+  using Event = Game::Audio::Midi::Sequence::Track::Channel::Event;
+
+  const auto& note = voice.note;
+
+  // Voice can't be played
+  if (startVoice(voice) == false)
+    return;
+
+  bool  held = true;
+  bool  hold = note.channel_controllers[Controller::ControllerHoldPedal] >= 64;
+  bool  sustenuto = note.channel_controllers[Controller::ControllerSustenutoPedal] >= 64;
+  bool  captured = false;
+
+  voice.release = sequence.metadata.end - voice.event->clock;
+
+  // Find release of the note, delayed by hold pedal and by sustenuto pedal pressed while key was held
+  for (auto event = std::next(voice.event); event != voice.channel->events.end(); event++) {
+    bool  stop = false;
+
+    if (event->type == Event::Type::EventKey && event->data.note.key == note.key) {
+      if (held == true)
+        held = false;
+      else
+        stop = event->data.note.velocity > 0;
+    }
+    else if (event->type == Event::Type::EventController) {
+      switch (event->data.controller.type) {
+      case Controller::ControllerHoldPedal:
+        hold = event->data.controller.value >= 64;
+        break;
+      case Controller::ControllerSustenutoPedal:
+        captured = (event->data.controller.value >= 64) && (captured == true || (held == true && sustenuto == false));
+        sustenuto = event->data.controller.value >= 64;
+        break;
+      case Controller::ControllerAllSoundOff:
+      case Controller::ControllerAllNoteOff:
+        stop = true;
+        break;
+      default:
+        break;
+      }
+    }
+
+    // Key released and not sustained anymore, or played again
+    if (stop == true || (held == false && hold == false && captured == false)) {
+      voice.release = event->clock - voice.event->clock;
+      break;
+    }
+  }
+
+  // Voice stops at end of release or end of rendering target
+  if (voice.offset >= _buffer.size() / 2)
+    return;
+
+  std::size_t frames = std::min(_buffer.size() / 2 - voice.offset, (std::size_t)std::ceil((voice.release + voice.envelope.release) * (float)_sampleRate) + 1);
+  auto        controllers = note.channel_controllers;
+  auto        pitch = note.channel_pitch;
+  auto        event = std::next(voice.event);
+
+  voice.buffer.assign(frames * 2, 0.f);
+
+  // Render blocks of frames, channel events are applied between blocks
+  while (voice.frame < frames)
+  {
+    // Apply channel events up to current time
+    for (; event != voice.channel->events.end() && event->clock <= voice.event->clock + (float)voice.frame / (float)_sampleRate; event++) {
+      if (event->type == Event::Type::EventPitch)
+        pitch = event->data.pitch;
+      else if (event->type == Event::Type::EventController)
+        controllers[event->data.controller.type] = event->data.controller.value;
+    }
+
+    // Stop when voice has ended
+    if (renderVoice(voice, controllers, pitch, std::min(Game::Audio::Synthesizer::VoiceBlock, frames - voice.frame), voice.buffer.data() + voice.frame * 2) == false)
+      break;
+  }
+
+  // Shrink voice to rendered frames when stopped early
+  voice.buffer.resize(voice.frame * 2);
+}
+
+bool  Game::Audio::Synthesizer::startVoice(Game::Audio::Synthesizer::Voice& voice, std::size_t* skipped) const
+{
+  static const Game::Audio::Soundfont::Generator  defaults;
+
+  const auto& note = voice.note;
+  const auto& local = voice.bag->generator;
+  const auto& global = voice.instrument->generator;
+
+  // Instrument generator, preset generator is an offset to it
+  auto  amount = [&local, &global](Game::Audio::Soundfont::Sf2Generator generator)
     {
-      // Check bag's key range
-      if (note.key < bag.generator[Game::Audio::Soundfont::Sf2Generator::KeyRange].range.low || note.key > bag.generator[Game::Audio::Soundfont::Sf2Generator::KeyRange].range.high)
-        continue;
+      return (int)local[generator].s_amount + (int)global[generator].s_amount - (int)defaults[generator].s_amount;
+    };
 
-      // Check bag's velocity range
-      if (note.key < bag.generator[Game::Audio::Soundfont::Sf2Generator::VelocityRange].range.low || note.key > bag.generator[Game::Audio::Soundfont::Sf2Generator::VelocityRange].range.high)
-        continue;
+  // Convert timecents to seconds
+  auto  timecents = [](int value)
+    {
+      return std::pow(2.f, (float)std::clamp(value, -12000, 8000) / 1200.f);
+    };
+
+  // Handle invalid sample ID
+  if (local[Game::Audio::Soundfont::Sf2Generator::SampleId].u_amount >= soundfont.samples.size()) {
+    if (skipped != nullptr)
+      (*skipped)++;
+    else
+      std::cerr << "[Game::Audio::Synthesizer::generate]: Warning, invalid sample ID (" << local[Game::Audio::Soundfont::Sf2Generator::SampleId].u_amount << ")." << std::endl;
+    return false;
+  }
 
-      // Generate instrument bag
-      tasks.push_back(std::async(std::launch::async, [this, &sequence, &track, &channel, event, note, &preset, &instrument, &bag]
-        {
-          // Generate instrument bag
-          generateInstrument(sequence, track, channel, event, note, preset, instrument, bag);
-        }));
+  const auto& sample = soundfont.samples[local[Game::Audio::Soundfont::Sf2Generator::SampleId].u_amount];
+  int         key = (amount(Game::Audio::Soundfont::Sf2Generator::Keynum) >= 0) ? amount(Game::Audio::Soundfont::Sf2Generator::Keynum) : note.key;
+  int         velocity = (amount(Game::Audio::Soundfont::Sf2Generator::Velocity) > 0) ? amount(Game::Audio::Soundfont::Sf2Generator::Velocity) : note.velocity;
+  int         root = (amount(Game::Audio::Soundfont::Sf2Generator::OverridingRootKey) >= 0) ? amount(Game::Audio::Soundfont::Sf2Generator::OverridingRootKey) : sample.key;
+
+  // Sample too short to be interpolated
+  if (sample.size < 4)
+    return false;
+
+  voice.sample = &sample;
+  voice.mode = amount(Game::Audio::Soundfont::Sf2Generator::SampleMode) & 0b11;
+
+  // Sample and loop points, offsets by generators
+  voice.sample_start = std::clamp(amount(Game::Audio::Soundfont::Sf2Generator::StartAddrsOffset) + amount(Game::Audio::Soundfont::Sf2Generator::StartAddrsCoarseOffset) * 32768, 0, (int)sample.size - 3);
+  voice.sample_end = std::clamp((int)sample.size - 2 + amount(Game::Audio::Soundfont::Sf2Generator::EndAddrsOffset) + amount(Game::Audio::Soundfont::Sf2Generator::EndAddrsCoarseOffset) * 32768, (int)voice.sample_start + 1, (int)sample.size - 2);
+  voice.loop_start = std::clamp((int)sample.start + amount(Game::Audio::Soundfont::Sf2Generator::StartLoopAddrsOffset) + amount(Game::Audio::Soundfont::Sf2Generator::StartLoopAddrsCoarseOffset) * 32768, 0, (int)sample.size - 3);
+  voice.loop_end = std::clamp((int)sample.end + amount(Game::Audio::Soundfont::Sf2Generator::EndLoopAddrsOffset) + amount(Game::Audio::Soundfont::Sf2Generator::EndLoopAddrsCoarseOffset) * 32768, (int)voice.loop_start + 1, (int)sample.size - 2);
+
+  // Pitch in cents relative to sample
+  voice.tuning = (float)(key - root) * (float)amount(Game::Audio::Soundfont::Sf2Generator::ScaleTuning)
+    + (float)amount(Game::Audio::Soundfont::Sf2Generator::CoarseTune) * 100.f + (float)amount(Game::Audio::Soundfont::Sf2Generator::FineTune) + (float)sample.correction;
+
+  // Attenuation of the voice (instrument, velocity and soft pedal)
+  voice.level = std::pow(10.f, -(float)std::clamp(amount(Game::Audio::Soundfont::Sf2Generator::InitialAttenuation), 0, 1440) / 200.f)
+    * ((float)velocity / 127.f) * ((float)velocity / 127.f)
+    * ((note.channel_controllers[Game::Audio::Midi::Sequence::Track::Channel::Controller::ControllerSoftPedal] >= 64) ? 0.5f : 1.f);
+  voice.pan = (float)amount(Game::Audio::Soundfont::Sf2Generator::Pan) / 1000.f;
+
+  voice.envelope = {
+    .delay = timecents(amount(Game::Audio::Soundfont::Sf2Generator::DelayVolEnv)),
+    .attack = timecents(amount(Game::Audio::Soundfont::Sf2Generator::AttackVolEnv)),
+    .hold = timecents(amount(Game::Audio::Soundfont::Sf2Generator::HoldVolEnv) + amount(Game::Audio::Soundfont::Sf2Generator::KeynumToVolEnvHold) * (60 - key)),
+    .decay = timecents(amount(Game::Audio::Soundfont::Sf2Generator::DecayVolEnv) + amount(Game::Audio::Soundfont::Sf2Generator::KeynumToVolEnvDecay) * (60 - key)),
+    .sustain = (float)std::clamp(amount(Game::Audio::Soundfont::Sf2Generator::SustainVolEnv), 0, 1440),
+    .release = timecents(amount(Game::Audio::Soundfont::Sf2Generator::ReleaseVolEnv))
+  };
+
+  // Start of playback, key held
+  voice.position = voice.sample_start;
+  voice.frame = 0;
+  voice.release = std::numeric_limits<float>::infinity();
+  voice.held = true;
+  voice.captured = false;
+
+  return true;
+}
+
+bool  Game::Audio::Synthesizer::renderVoice(Game::Audio::Synthesizer::Voice& voice, const std::array<uint8_t, 128>& controllers, std::uint16_t pitch, std::size_t count, float* output) const
+{
+  using Controller = Game::Audio::Midi::Sequence::Track::Channel::Controller;
+
+  static const float  silence = std::pow(10.f, -Game::Audio::Synthesizer::VoiceSilence / 200.f);
+
+  // Channel volume, expression and pan, constant for the whole call
+  float mix = voice.level
+    * ((float)controllers[Controller::ControllerVolumeCoarse] / 127.f) * ((float)controllers[Controller::ControllerVolumeCoarse] / 127.f)
+    * ((float)controllers[Controller::ControllerExpressionCoarse] / 127.f) * ((float)controllers[Controller::ControllerExpressionCoarse] / 127.f);
+  float pan = std::clamp(voice.pan + ((float)controllers[Controller::ControllerPanCoarse] - 64.f) / 128.f, -0.5f, +0.5f);
+  float left = std::cos((pan + 0.5f) * Math::Pi / 2.f);
+  float right = std::sin((pan + 0.5f) * Math::Pi / 2.f);
+
+  // Channel pitch wheel range is 2 semitones
+  float increment = std::pow(2.f, (voice.tuning + ((float)pitch - 8192.f) / 8192.f * 200.f) / 1200.f) * (float)voice.sample->rate / (float)_sampleRate;
+
+  // Render blocks of frames, gain is ramped linearly inside a block
+  for (std::size_t done = 0; done < count;)
+  {
+    float time = (float)voice.frame / (float)_sampleRate;
+    bool  looping = (voice.mode == 1) || (voice.mode == 3 && time < voice.release);
+
+    // Wrap position in loop
+    if (looping == true && voice.position >= voice.loop_end)
+      voice.position = voice.loop_start + std::fmod(voice.position - voice.loop_start, voice.loop_end - voice.loop_start);
+
+    double  limit = (looping == true) ? voice.loop_end : voice.sample_end;
+
+    // End of sample reached
+    if (voice.position >= limit)
+      return false;
+
+    // Block stops before loop or sample end
+    std::size_t block = std::min({ Game::Audio::Synthesizer::VoiceBlock, count - done, (std::size_t)std::ceil((limit - voice.position) / increment) });
+
+    float start = voice.envelope.gain(time, voice.release);
+    float end = voice.envelope.gain((float)(voice.frame + block) / (float)_sampleRate, voice.release);
+
+    // Voice faded out after attack or release
+    if (start <= silence && end <= silence && (time >= voice.envelope.delay + voice.envelope.attack + voice.envelope.hold || time >= voice.release))
+      return false;
+
+    // Resample block, constant power pan
+    if (voice.sample->mapped != nullptr)
+      renderVector(voice.sample->mapped, voice.position, increment, start * mix, (end - start) * mix / (float)block, left, right, block, output + done * 2);
+    else
+      renderVector(voice.sample->samples.data(), voice.position, increment, start * mix, (end - start) * mix / (float)block, left, right, block, output + done * 2);
+
+    voice.position += (double)increment * (double)block;
+    voice.frame += block;
+    done += block;
+  }
+
+  return true;
+}
+
+
+float Game::Audio::Synthesizer::Envelope::attenuation(float time) const
+{
+  // Delay, silent
+  if (time < delay)
+    return std::numeric_limits<float>::infinity();
+
+  // Attack, linear rise of amplitude
+  if (time < delay + attack)
+    return -200.f * std::log10((time - delay) / attack);
+
+  // Hold, full level
+  if (time < delay + attack + hold)
+    return 0.f;
+
+  // Decay, linear fall in decibels until sustain level
+  return std::min(1000.f * (time - delay - attack - hold) / std::max(decay, 0.001f), sustain);
+}
+
+float Game::Audio::Synthesizer::Envelope::gain(float time, float released) const
+{
+  float value = (time < released) ?
+    attenuation(time) :
+    attenuation(released) + 1000.f * (time - released) / std::max(release, 0.001f);
+
+  // Convert centibels to amplitude
+  return std::pow(10.f, -value / 200.f);
+}
+
+// AVX2 kernel is only built with GAME_AVX2 CMake option, SSE2 otherwise
+#if defined(__AVX2__)
+const char* const Game::Audio::Synthesizer::VoiceKernel = "avx2";
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+const char* const Game::Audio::Synthesizer::VoiceKernel = "sse2";
+#else
+const char* const Game::Audio::Synthesizer::VoiceKernel = "scalar";
+#endif
+
+void  Game::Audio::Synthesizer::renderScalar(const float* samples, double position, float increment, float gain, float step, float left, float right, std::size_t count, float* output)
+{
+  std::size_t base = (std::size_t)position;
+  float       fraction = (float)(position - (double)base);
+
+  // Positions are relative to first sample of block, to keep float precision
+  samples += base;
+
+  // Linear interpolation between the two nearest samples
+  for (std::size_t index = 0; index < count; index++) {
+    float         x = fraction + (float)index * increment;
+    std::int32_t  i = (std::int32_t)x;
+    float         f = x - (float)i;
+    float         value = (samples[i] + f * (samples[i + 1] - samples[i])) * (gain + (float)index * step);
+
+    output[index * 2 + 0] += value * left;
+    output[index * 2 + 1] += value * right;
+  }
+}
+
+void  Game::Audio::Synthesizer::renderVector(const float* samples, double position, float increment, float gain, float step, float left, float right, std::size_t count, float* output)
+{
+  std::size_t base = (std::size_t)position;
+  float       fraction = (float)(position - (double)base);
+  std::size_t index = 0;
+
+  // Positions are relative to first sample of block, to keep float precision
+  samples += base;
+
+#if defined(__AVX2__)
+  const __m256  offsets = _mm256_setr_ps(0.f, 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f);
+
+  // Eight frames at a time, samples gathered from computed indexes
+  for (; index + 8 <= count; index += 8) {
+    __m256  n = _mm256_add_ps(_mm256_set1_ps((float)index), offsets);
+    __m256  x = _mm256_add_ps(_mm256_set1_ps(fraction), _mm256_mul_ps(n, _mm256_set1_ps(increment)));
+    __m256i i = _mm256_cvttps_epi32(x);
+    __m256  f = _mm256_sub_ps(x, _mm256_cvtepi32_ps(i));
+    __m256  a = _mm256_i32gather_ps(samples + 0, i, sizeof(float));
+    __m256  b = _mm256_i32gather_ps(samples + 1, i, sizeof(float));
+    __m256  value = _mm256_mul_ps(_mm256_add_ps(a, _mm256_mul_ps(f, _mm256_sub_ps(b, a))), _mm256_add_ps(_mm256_set1_ps(gain), _mm256_mul_ps(n, _mm256_set1_ps(step))));
+    __m256  l = _mm256_mul_ps(value, _mm256_set1_ps(left));
+    __m256  r = _mm256_mul_ps(value, _mm256_set1_ps(right));
+
+    // Interleave left and right channels
+    __m256  low = _mm256_unpacklo_ps(l, r);
+    __m256  high = _mm256_unpackhi_ps(l, r);
+
+    _mm256_storeu_ps(output + index * 2 + 0, _mm256_add_ps(_mm256_loadu_ps(output + index * 2 + 0), _mm256_permute2f128_ps(low, high, 0x20)));
+    _mm256_storeu_ps(output + index * 2 + 8, _mm256_add_ps(_mm256_loadu_ps(output + index * 2 + 8), _mm256_permute2f128_ps(low, high, 0x31)));
+  }
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+  const __m128  offsets = _mm_setr_ps(0.f, 1.f, 2.f, 3.f);
+
+  // Four frames at a time, no gather instruction so samples are loaded one by one
+  for (; index + 4 <= count; index += 4) {
+    __m128  n = _mm_add_ps(_mm_set1_ps((float)index), offsets);
+    __m128  x = _mm_add_ps(_mm_set1_ps(fraction), _mm_mul_ps(n, _mm_set1_ps(increment)));
+    __m128i i = _mm_cvttps_epi32(x);
+    __m128  f = _mm_sub_ps(x, _mm_cvtepi32_ps(i));
+
+    alignas(16) std::int32_t  indexes[4];
+
+    _mm_store_si128((__m128i*)indexes, i);
+
+    __m128  a = _mm_setr_ps(samples[indexes[0] + 0], samples[indexes[1] + 0], samples[indexes[2] + 0], samples[indexes[3] + 0]);
+    __m128  b = _mm_setr_ps(samples[indexes[0] + 1], samples[indexes[1] + 1], samples[indexes[2] + 1], samples[indexes[3] + 1]);
+    __m128  value = _mm_mul_ps(_mm_add_ps(a, _mm_mul_ps(f, _mm_sub_ps(b, a))), _mm_add_ps(_mm_set1_ps(gain), _mm_mul_ps(n, _mm_set1_ps(step))));
+    __m128  l = _mm_mul_ps(value, _mm_set1_ps(left));
+    __m128  r = _mm_mul_ps(value, _mm_set1_ps(right));
+
+    // Interleave left and right channels
+    _mm_storeu_ps(output + index * 2 + 0, _mm_add_ps(_mm_loadu_ps(output + index * 2 + 0), _mm_unpacklo_ps(l, r)));
+    _mm_storeu_ps(output + index * 2 + 4, _mm_add_ps(_mm_loadu_ps(output + index * 2 + 4), _mm_unpackhi_ps(l, r)));
+  }
+#endif
+
+  // Remaining frames
+  for (; index < count; index++) {
+    float         x = fraction + (float)index * increment;
+    std::int32_t  i = (std::int32_t)x;
+    float         f = x - (float)i;
+    float         value = (samples[i] + f * (samples[i + 1] - samples[i])) * (gain + (float)index * step);
+
+    output[index * 2 + 0] += value * left;
+    output[index * 2 + 1] += value * right;
+  }
+}
+
+void  Game::Audio::Synthesizer::renderScalar(const int16_t* samples, double position, float increment, float gain, float step, float left, float right, std::size_t count, float* output)
+{
+  std::size_t base = (std::size_t)position;
+  float       fraction = (float)(position - (double)base);
+
+  // Positions are relative to first sample of block, to keep float precision
+  samples += base;
+
+  // Conversion of 16 bits samples to [-1:+1[ folded in gain
+  gain /= 32768.f;
+  step /= 32768.f;
+
+  // Linear interpolation between the two nearest samples
+  for (std::size_t index = 0; index < count; index++) {
+    float         x = fraction + (float)index * increment;
+    std::int32_t  i = (std::int32_t)x;
+    float         f = x - (float)i;
+    float         value = ((float)samples[i] + f * (float)(samples[i + 1] - samples[i])) * (gain + (float)index * step);
+
+    output[index * 2 + 0] += value * left;
+    output[index * 2 + 1] += value * right;
+  }
+}
+
+void  Game::Audio::Synthesizer::renderVector(const int16_t* samples, double position, float increment, float gain, float step, float left, float right, std::size_t count, float* output)
+{
+  std::size_t base = (std::size_t)position;
+  float       fraction = (float)(position - (double)base);
+  std::size_t index = 0;
+
+  // Positions are relative to first sample of block, to keep float precision
+  samples += base;
+
+  // Conversion of 16 bits samples to [-1:+1[ folded in gain
+  gain /= 32768.f;
+  step /= 32768.f;
+
+#if defined(__AVX2__)
+  const __m256  offsets = _mm256_setr_ps(0.f, 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f);
+
+  // Eight frames at a time, both samples of a frame gathered as a single 32 bits value
+  for (; index + 8 <= count; index += 8) {
+    __m256  n = _mm256_add_ps(_mm256_set1_ps((float)index), offsets);
+    __m256  x = _mm256_add_ps(_mm256_set1_ps(fraction), _mm256_mul_ps(n, _mm256_set1_ps(increment)));
+    __m256i i = _mm256_cvttps_epi32(x);
+    __m256  f = _mm256_sub_ps(x, _mm256_cvtepi32_ps(i));
+    __m256i pair = _mm256_i32gather_epi32((const int*)samples, i, sizeof(int16_t));
+    __m256  a = _mm256_cvtepi32_ps(_mm256_srai_epi32(_mm256_slli_epi32(pair, 16), 16));
+    __m256  b = _mm256_cvtepi32_ps(_mm256_srai_epi32(pair, 16));
+    __m256  value = _mm256_mul_ps(_mm256_add_ps(a, _mm256_mul_ps(f, _mm256_sub_ps(b, a))), _mm256_add_ps(_mm256_set1_ps(gain), _mm256_mul_ps(n, _mm256_set1_ps(step))));
+    __m256  l = _mm256_mul_ps(value, _mm256_set1_ps(left));
+    __m256  r = _mm256_mul_ps(value, _mm256_set1_ps(right));
+
+    // Interleave left and right channels
+    __m256  low = _mm256_unpacklo_ps(l, r);
+    __m256  high = _mm256_unpackhi_ps(l, r);
+
+    _mm256_storeu_ps(output + index * 2 + 0, _mm256_add_ps(_mm256_loadu_ps(output + index * 2 + 0), _mm256_permute2f128_ps(low, high, 0x20)));
+    _mm256_storeu_ps(output + index * 2 + 8, _mm256_add_ps(_mm256_loadu_ps(output + index * 2 + 8), _mm256_permute2f128_ps(low, high, 0x31)));
+  }
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+  const __m128  offsets = _mm_setr_ps(0.f, 1.f, 2.f, 3.f);
+
+  // Four frames at a time, no gather instruction so samples are loaded one by one
+  for (; index + 4 <= count; index += 4) {
+    __m128  n = _mm_add_ps(_mm_set1_ps((float)index), offsets);
+    __m128  x = _mm_add_ps(_mm_set1_ps(fraction), _mm_mul_ps(n, _mm_set1_ps(increment)));
+    __m128i i = _mm_cvttps_epi32(x);
+    __m128  f = _mm_sub_ps(x, _mm_cvtepi32_ps(i));
+
+    alignas(16) std::int32_t  indexes[4];
+
+    _mm_store_si128((__m128i*)indexes, i);
+
+    __m128  a = _mm_cvtepi32_ps(_mm_setr_epi32(samples[indexes[0] + 0], samples[indexes[1] + 0], samples[indexes[2] + 0], samples[indexes[3] + 0]));
+    __m128  b = _mm_cvtepi32_ps(_mm_setr_epi32(samples[indexes[0] + 1], samples[indexes[1] + 1], samples[indexes[2] + 1], samples[indexes[3] + 1]));
+    __m128  value = _mm_mul_ps(_mm_add_ps(a, _mm_mul_ps(f, _mm_sub_ps(b, a))), _mm_add_ps(_mm_set1_ps(gain), _mm_mul_ps(n, _mm_set1_ps(step))));
+    __m128  l = _mm_mul_ps(value, _mm_set1_ps(left));
+    __m128  r = _mm_mul_ps(value, _mm_set1_ps(right));
+
+    // Interleave left and right channels
+    _mm_storeu_ps(output + index * 2 + 0, _mm_add_ps(_mm_loadu_ps(output + index * 2 + 0), _mm_unpacklo_ps(l, r)));
+    _mm_storeu_ps(output + index * 2 + 4, _mm_add_ps(_mm_loadu_ps(output + index * 2 + 4), _mm_unpackhi_ps(l, r)));
+  }
+#endif
+
+  // Remaining frames
+  for (; index < count; index++) {
+    float         x = fraction + (float)index * increment;
+    std::int32_t  i = (std::int32_t)x;
+    float         f = x - (float)i;
+    float         value = ((float)samples[i] + f * (float)(samples[i + 1] - samples[i])) * (gain + (float)index * step);
+
+    output[index * 2 + 0] += value * left;
+    output[index * 2 + 1] += value * right;
+  }
+}
+
+void  Game::Audio::Synthesizer::benchmark(const std::filesystem::path& soundfont)
+{
+  using FloatKernel = void(*)(const float*, double, float, float, float, float, float, std::size_t, float*);
+  using MappedKernel = void(*)(const int16_t*, double, float, float, float, float, float, std::size_t, float*);
+
+  double  reference = 0.;
+  float   checksum = 0.;
+
+  const std::array<std::tuple<const char*, FloatKernel, MappedKernel>, 2> kernels = {
+    std::tuple{ "scalar", static_cast<FloatKernel>(&Game::Audio::Synthesizer::renderScalar), static_cast<MappedKernel>(&Game::Audio::Synthesizer::renderScalar) },
+    std::tuple{ Game::Audio::Synthesizer::VoiceKernel, static_cast<FloatKernel>(&Game::Audio::Synthesizer::renderVector), static_cast<MappedKernel>(&Game::Audio::Synthesizer::renderVector) }
+  };
+
+  // Resample every sample of soundfont at several pitches with each storage and kernel
+  for (auto storage : { Game::Audio::Soundfont::Storage::StorageFloat, Game::Audio::Soundfont::Storage::StorageMapped }) {
+    Game::Audio::Soundfont  font(soundfont, storage);
+
+    for (const auto& [kernel, floating, mapped] : kernels)
+    {
+      std::array<float, Game::Audio::Synthesizer::VoiceBlock * 2> output = { 0.f };
+      std::size_t                                                 frames = 0;
+      std::string                                                 name = std::string(kernel) + ((storage == Game::Audio::Soundfont::Storage::StorageMapped) ? " 16 bits" : " float");
+
+      auto  start = std::chrono::steady_clock::now();
+
+      for (float increment : { 0.5f, 1.f, 1.5f, 2.f }) {
+        for (const auto& sample : font.samples) {
+          double  limit = (double)sample.size - 2.;
+
+          // Render sample from start to end in blocks, as a voice would
+          for (double position = 0.; position < limit;) {
+            std::size_t count = std::min(Game::Audio::Synthesizer::VoiceBlock, (std::size_t)std::ceil((limit - position) / increment));
+
+            if (sample.mapped != nullptr)
+              mapped(sample.mapped, position, increment, 0.5f, 0.0001f, 0.7f, 0.7f, count, output.data());
+            else
+              floating(sample.samples.data(), position, increment, 0.5f, 0.0001f, 0.7f, 0.7f, count, output.data());
+            position += (double)increment * (double)count;
+            frames += count;
+          }
+        }
+      }
+
+      auto  duration = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+      auto  fps = (duration > 0.) ? frames / duration : 0.;
+      float sum = 0.f;
+
+      // Accumulated output, should match between kernels
+      for (float value : output)
+        sum += value;
+
+      // Keep scalar kernel with float samples as reference
+      if (reference == 0.) {
+        reference = fps;
+        checksum = sum;
+      }
+
+      // Report voice rendering throughput
+      std::cout
+        << "[Game::Audio::Synthesizer] " << soundfont.filename().string() << ": "
+        << name << " voice, "
+        << frames << " frames in " << duration << "s, "
+        << fps << " frames/s (x" << ((reference > 0.) ? fps / reference : 0.) << "), "
+        << "checksum " << sum << ((std::abs(sum - checksum) <= std::abs(checksum) * 0.0001f) ? "" : " (mismatch)") << "." << std::endl;
+    }
+  }
+}
+
+
+Game::Audio::Synthesizer::Note  Game::Audio::Synthesizer::initialNote()
+{
+  Game::Audio::Synthesizer::Note  note = {
+    .key = 0,
+    .velocity = 0,
+    .polyphonic = 0,
+
+    .channel_pitch = 0x2000,
+    .channel_program = 0,
+    .channel_controllers = { 0 }
+  };
+
+  // Default channel volume, expression and pan, pitch wheel centered
+  note.channel_controllers[Game::Audio::Midi::Sequence::Track::Channel::Controller::ControllerVolumeCoarse] = 100;
+  note.channel_controllers[Game::Audio::Midi::Sequence::Track::Channel::Controller::ControllerExpressionCoarse] = 127;
+  note.channel_controllers[Game::Audio::Midi::Sequence::Track::Channel::Controller::ControllerPanCoarse] = 64;
+
+  return note;
+}
+
+std::size_t Game::Audio::Synthesizer::sampleRate() const
+{
+  return _sampleRate;
+}
+
+Game::Audio::Synthesizer::Stream::Stream(Game::Audio::Synthesizer& synthesizer, std::size_t sequenceId, std::size_t voices) :
+  _synthesizer(synthesizer),
+  _sequence(),
+  _channels(),
+  _voices(),
+  _pressed(),
+  _limit(std::max<std::size_t>(voices, 1)),
+  _frame(0),
+  statistics{ .blocks = 0, .total = 0., .maximum = 0., .voices = 0, .stolen = 0, .skipped = 0 }
+{
+  // Handle invalid sequence ID
+  if (sequenceId >= synthesizer.midi.sequences.size())
+    throw std::runtime_error((std::string(__FILE__) + ": l." + std::to_string(__LINE__)).c_str());
+
+  // Copy sequence, voices keep references to its events
+  _sequence = *std::next(synthesizer.midi.sequences.begin(), sequenceId);
+
+  // Start every non-empty channel of each track
+  for (const auto& [track_id, track] : _sequence.tracks)
+    for (const auto& channel : track.channel)
+      if (channel.events.empty() == false)
+        _channels.push_back({
+          .track = &track,
+          .channel = &channel,
+          .event = channel.events.begin(),
+          .note = Game::Audio::Synthesizer::initialNote(),
+          .polyphonics = { 0 }
+          });
+
+  // Never reallocated while playing
+  _voices.reserve(_limit);
+}
+
+float Game::Audio::Synthesizer::Stream::time() const
+{
+  return (float)_frame / (float)_synthesizer._sampleRate;
+}
+
+void  Game::Audio::Synthesizer::Stream::play(Game::Audio::Synthesizer::Stream::Channel& channel)
+{
+  using Controller = Game::Audio::Midi::Sequence::Track::Channel::Controller;
+  using Event = Game::Audio::Midi::Sequence::Track::Channel::Event;
+
+  auto& note = channel.note;
+
+  // Release a voice of the channel unless sustained by a pedal
+  auto  release = [this, &note](Game::Audio::Synthesizer::Voice& voice, bool force)
+    {
+      if (force == true || (voice.held == false && voice.captured == false && note.channel_controllers[Controller::ControllerHoldPedal] < 64))
+        voice.release = std::min(voice.release, (float)voice.frame / (float)_synthesizer._sampleRate);
+    };
+
+  // Process events of channel up to current time
+  for (; channel.event != channel.channel->events.end() && channel.event->clock <= time(); channel.event++)
+  {
+    const auto& event = *channel.event;
+
+    switch (event.type) {
+    case Event::Type::EventKey:           // Key pressed/released
+      // Release voices of the key, stop them if played again
+      for (auto& voice : _voices)
+        if (voice.channel == channel.channel && voice.note.key == event.data.note.key) {
+          voice.held = false;
+          release(voice, event.data.note.velocity > 0 && voice.captured == false);
+        }
+
+      // Key is pressed, allocate voices of matching instrument bags
+      // NOTE: rendered on audio thread, warnings are counted instead of printed
+      if (event.data.note.velocity > 0) {
+        note.key = event.data.note.key;
+        note.velocity = event.data.note.velocity;
+        note.polyphonic = channel.polyphonics[note.key];
+
+        _pressed.clear();
+        _synthesizer.generateNote(_sequence, *channel.track, *channel.channel, channel.event, note, _pressed, &statistics.skipped);
+        for (auto& voice : _pressed)
+          if (_synthesizer.startVoice(voice, &statistics.skipped) == true)
+            allocate(voice);
+      }
+      break;
+
+    case Event::Type::EventPolyphonicKey: // Pressure change
+      channel.polyphonics[event.data.polyphonic.key] = event.data.polyphonic.pressure;
+      break;
+
+    case Event::Type::EventProgram:       // Program change
+      note.channel_program = event.data.program;
+      break;
+
+    case Event::Type::EventPitch:         // Pitch change
+      note.channel_pitch = event.data.pitch;
+      break;
+
+    case Event::Type::EventController:    // Controller change
+    {
+      bool  sustenuto = note.channel_controllers[Controller::ControllerSustenutoPedal] >= 64;
+
+      note.channel_controllers[event.data.controller.type] = event.data.controller.value;
+
+      for (auto& voice : _voices) {
+        if (voice.channel != channel.channel)
+          continue;
+
+        switch (event.data.controller.type) {
+        case Controller::ControllerHoldPedal:       // Released keys are not sustained anymore
+          release(voice, false);
+          break;
+        case Controller::ControllerSustenutoPedal:  // Capture held keys when pressed, release them when released
+          if (event.data.controller.value >= 64)
+            voice.captured = voice.captured == true || (voice.held == true && sustenuto == false);
+          else
+            voice.captured = false;
+          release(voice, false);
+          break;
+        case Controller::ControllerAllSoundOff:
+        case Controller::ControllerAllNoteOff:
+          release(voice, true);
+          break;
+        default:
+          break;
+        }
+      }
+      break;
     }
+
+    default:  // Error
+      throw std::runtime_error((std::string(__FILE__) + ": l." + std::to_string(__LINE__)).c_str());
+    }
+  }
+}
+
+void  Game::Audio::Synthesizer::Stream::allocate(Game::Audio::Synthesizer::Voice& voice)
+{
+  // Free slot
+  if (_voices.size() < _limit) {
+    _voices.push_back(std::move(voice));
+    statistics.voices = std::max(statistics.voices, _voices.size());
+    return;
+  }
+
+  // Replace oldest released voice, or oldest voice if none is released
+  auto  oldest = std::max_element(_voices.begin(), _voices.end(), [](const auto& a, const auto& b)
+    {
+      return std::pair(std::isinf(a.release) == false, a.frame) < std::pair(std::isinf(b.release) == false, b.frame);
+    });
+
+  *oldest = std::move(voice);
+  statistics.stolen++;
+}
+
+bool  Game::Audio::Synthesizer::Stream::render(float* output, std::size_t frames)
+{
+  auto  start = std::chrono::steady_clock::now();
+
+  std::fill(output, output + frames * 2, 0.f);
+
+  // Render blocks of frames, channel events are applied between blocks
+  for (std::size_t done = 0; done < frames;)
+  {
+    std::size_t count = std::min(Game::Audio::Synthesizer::VoiceBlock, frames - done);
+
+    for (auto& channel : _channels)
+      play(channel);
+
+    // Release remaining voices at end of sequence, like missing key releases
+    if (time() >= _sequence.metadata.end)
+      for (auto& voice : _voices)
+        voice.release = std::min(voice.release, (float)voice.frame / (float)_synthesizer._sampleRate);
+
+    // Render voices with state of their channel, remove ended ones
+    for (std::size_t index = 0; index < _voices.size();) {
+      auto& voice = _voices[index];
+      auto& channel = *std::find_if(_channels.begin(), _channels.end(), [&voice](const auto& channel) { return channel.channel == voice.channel; });
+
+      if (_synthesizer.renderVoice(voice, channel.note.channel_controllers, channel.note.channel_pitch, count, output + done * 2) == true)
+        index++;
+      else {
+        voice = std::move(_voices.back());
+        _voices.pop_back();
+      }
+    }
+
+    _frame += count;
+    done += count;
   }
 
-  // Wait for rendering tasks to complete
-  for (auto& task : tasks)
-    task.wait();
+  auto  duration = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  // Rendering time of block
+  statistics.blocks++;
+  statistics.total += duration;
+  statistics.maximum = std::max(statistics.maximum, duration);
+
+  // Sequence ends once every event has been played and every voice has ended
+  return _voices.empty() == false || std::any_of(_channels.begin(), _channels.end(), [](const auto& channel) { return channel.event != channel.channel->events.end(); });
 }
 
-void  Game::Audio::Synthesizer::generateInstrument(const Game::Audio::Midi::Sequence& sequence, const Game::Audio::Midi::Sequence::Track& track, const Game::Audio::Midi::Sequence::Track::Channel& channel, std::list<Game::Audio::Midi::Sequence::Track::Channel::Event>::const_iterator event, Game::Audio::Synthesizer::Note note, const Game::Audio::Soundfont::Preset& preset, const Game::Audio::Soundfont::Preset::Instrument& instrument, const Game::Audio::Soundfont::Preset::Instrument::Bag& bag)
+void  Game::Audio::Synthesizer::benchmark(const std::filesystem::path& midi, const std::filesystem::path& soundfont)
 {
-  bool on = true;
-  bool hold = note.channel_controllers[Game::Audio::Midi::Sequence::Track::Channel::Controller::ControllerHoldPedal] >= 64;
-  bool sustenuto = note.channel_controllers[Game::Audio::Midi::Sequence::Track::Channel::Controller::ControllerSustenutoPedal] >= 64;
-  bool soft = note.channel_controllers[Game::Audio::Midi::Sequence::Track::Channel::Controller::ControllerSoftPedal] >= 64;
+  auto  load = std::chrono::steady_clock::now();
+
+  Game::Audio::Synthesizer  synthesizer(midi, soundfont);
 
-  
+  std::cout << "[Game::Audio::Synthesizer] " << midi.filename().string() << ": loaded in " << std::chrono::duration<double>(std::chrono::steady_clock::now() - load).count() << "s." << std::endl;
 
-  // TODO
+  std::vector<float>  block(Game::Audio::Synthesizer::StreamBlock * 2, 0.f);
+  double              budget = (double)Game::Audio::Synthesizer::StreamBlock / (double)synthesizer.sampleRate();
+
+  // Stream each sequence as fast as possible
+  for (std::size_t sequenceId = 0; sequenceId < synthesizer.midi.sequences.size(); sequenceId++)
+  {
+    Game::Audio::Synthesizer::Stream  stream(synthesizer, sequenceId);
+
+    auto  start = std::chrono::steady_clock::now();
+
+    while (stream.render(block.data(), block.size() / 2) == true);
+
+    auto  duration = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    // Report real-time factor and time of blocks against their duration
+    std::cout
+      << "[Game::Audio::Synthesizer] " << midi.filename().string() << ": sequence " << sequenceId << ", "
+      << stream.time() << "s of audio in " << duration << "s, "
+      << "real-time x" << ((duration > 0.) ? stream.time() / duration : 0.) << ", "
+      << stream.statistics.blocks << " blocks of " << budget * 1000. << "ms, "
+      << "average " << stream.statistics.total / (double)std::max<std::size_t>(stream.statistics.blocks, 1) * 1000. << "ms, "
+      << "maximum " << stream.statistics.maximum * 1000. << "ms, "
+      << stream.statistics.voices << " voices, " << stream.statistics.stolen << " stolen, " << stream.statistics.skipped << " skipped." << std::endl;
+  }
 }
 
 /*
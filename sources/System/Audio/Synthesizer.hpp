@@ -24,22 +24,130 @@ namespace Game
         std::array<uint8_t, 128>  channel_controllers;  // Current channel controllers
       };
 
+      struct Envelope // Volume envelope of a voice, times in seconds, levels as attenuation in centibels
+      {
+        float delay;    // Time before attack
+        float attack;   // Time of linear rise from silence to full level
+        float hold;     // Time at full level
+        float decay;    // Time of a 100dB fall, stopped at sustain level
+        float sustain;  // Attenuation of sustain level
+        float release;  // Time of a 100dB fall after key is released
+
+        float attenuation(float time) const;          // Attenuation while key is held
+        float gain(float time, float released) const; // Linear gain, key released at given time
+      };
+
+      struct Voice  // Instrument bag played by a note, rendered on its own
+      {
+        const Game::Audio::Midi::Sequence::Track*                                     track;      // Track of the note
+        const Game::Audio::Midi::Sequence::Track::Channel*                            channel;    // Channel of the note
+        std::list<Game::Audio::Midi::Sequence::Track::Channel::Event>::const_iterator event;      // Key pressed event
+        Game::Audio::Synthesizer::Note                                                note;       // Note and channel state when pressed
+        const Game::Audio::Soundfont::Preset*                                         preset;     // Preset of the channel
+        const Game::Audio::Soundfont::Preset::Instrument*                             instrument; // Instrument of the preset
+        const Game::Audio::Soundfont::Preset::Instrument::Bag*                        bag;        // Bag of the instrument matching note
+
+        std::size_t         offset; // Index of first frame of voice in rendering target
+        std::vector<float>  buffer; // Rendered voice, stereo
+
+        const Game::Audio::Soundfont::Sample* sample;       // Sample played
+        int                                   mode;         // Sample loop mode
+        double                                sample_start; // Position of first sample played
+        double                                sample_end;   // Position after which sample stops
+        double                                loop_start;   // Position of first sample of loop
+        double                                loop_end;     // Position of end of loop
+        float                                 tuning;       // Pitch relative to sample, pitch wheel excluded (cents)
+        float                                 level;        // Gain of voice, envelope and channel controllers excluded
+        float                                 pan;          // Pan of instrument [-0.5:+0.5]
+        Game::Audio::Synthesizer::Envelope    envelope;     // Volume envelope
+
+        double      position; // Current position in sample
+        std::size_t frame;    // Number of frames rendered since key pressed
+        float       release;  // Time of key release since key pressed, infinity while not released
+        bool        held;     // Key is still pressed, used by stream
+        bool        captured; // Voice is sustained by sustenuto pedal, used by stream
+      };
+
+      static const std::size_t  MergeSlices = 4;      // Number of merge jobs per worker thread
+      static const std::size_t  VoiceBlock = 64;      // Number of frames rendered with constant pitch and linear gain ramp
+      static constexpr float    VoiceSilence = 960.f; // Attenuation after which a decaying voice is stopped (centibels)
+      static const std::size_t  StreamBlock = 512;    // Number of frames per block in stream benchmark
+      static const char* const  VoiceKernel;          // Name of instruction set used by vectorized voice rendering
+
       std::size_t         _sampleRate; // Number of sample per second
       std::vector<float>  _buffer;     // Rendering target, stereo
-      std::mutex          _bufferLock; // Lock for multithreaded rendering
 
-      void  generateChannel(const Game::Audio::Midi::Sequence& sequence, const Game::Audio::Midi::Sequence::Track& track, const Game::Audio::Midi::Sequence::Track::Channel& channel);
-      void  generateNote(const Game::Audio::Midi::Sequence& sequence, const Game::Audio::Midi::Sequence::Track& track, const Game::Audio::Midi::Sequence::Track::Channel& channel, std::list<Game::Audio::Midi::Sequence::Track::Channel::Event>::const_iterator event, Game::Audio::Synthesizer::Note note);
-      void  generateInstrument(const Game::Audio::Midi::Sequence& sequence, const Game::Audio::Midi::Sequence::Track& track, const Game::Audio::Midi::Sequence::Track::Channel& channel, std::list<Game::Audio::Midi::Sequence::Track::Channel::Event>::const_iterator event, Game::Audio::Synthesizer::Note note, const Game::Audio::Soundfont::Preset& preset, const Game::Audio::Soundfont::Preset::Instrument& instrument, const Game::Audio::Soundfont::Preset::Instrument::Bag& bag);
+      static Game::Audio::Synthesizer::Note initialNote(); // Channel state at start of sequence
+
+      void  generateChannel(const Game::Audio::Midi::Sequence& sequence, const Game::Audio::Midi::Sequence::Track& track, const Game::Audio::Midi::Sequence::Track::Channel& channel, std::vector<Game::Audio::Synthesizer::Voice>& voices);
+      void  generateNote(const Game::Audio::Midi::Sequence& sequence, const Game::Audio::Midi::Sequence::Track& track, const Game::Audio::Midi::Sequence::Track::Channel& channel, std::list<Game::Audio::Midi::Sequence::Track::Channel::Event>::const_iterator event, Game::Audio::Synthesizer::Note note, std::vector<Game::Audio::Synthesizer::Voice>& voices, std::size_t* skipped = nullptr); // List voices of note, note without preset counted in skipped if given, printed otherwise
+      void  generateInstrument(const Game::Audio::Midi::Sequence& sequence, Game::Audio::Synthesizer::Voice& voice);
+
+      bool  startVoice(Game::Audio::Synthesizer::Voice& voice, std::size_t* skipped = nullptr) const;                                                                      // Compute playback parameters of voice from its instrument bag, false if not playable, invalid sample counted in skipped if given, printed otherwise
+      bool  renderVoice(Game::Audio::Synthesizer::Voice& voice, const std::array<uint8_t, 128>& controllers, std::uint16_t pitch, std::size_t count, float* output) const; // Add next frames of voice to stereo output, false when voice has ended
+
+      static void renderScalar(const float* samples, double position, float increment, float gain, float step, float left, float right, std::size_t count, float* output); // Add resampled frames to stereo output, gain ramped by step each frame
+      static void renderVector(const float* samples, double position, float increment, float gain, float step, float left, float right, std::size_t count, float* output); // Same as renderScalar, using SSE2 or AVX2 when available
+      static void renderScalar(const int16_t* samples, double position, float increment, float gain, float step, float left, float right, std::size_t count, float* output);  // Same as renderScalar, 16 bits samples converted to float while resampled
+      static void renderVector(const int16_t* samples, double position, float increment, float gain, float step, float left, float right, std::size_t count, float* output);  // Same as renderScalar with 16 bits samples, using SSE2 or AVX2 when available
 
     public:
-      Synthesizer(const std::filesystem::path& midi, const std::filesystem::path& soundfont, std::size_t sampleRate = 22050);
+      class Stream  // Incremental rendering of a MIDI sequence in fixed-size blocks, with a bounded number of voices
+      {
+      private:
+        struct Channel  // Playback state of a MIDI channel
+        {
+          const Game::Audio::Midi::Sequence::Track*                                     track;        // Track of the channel
+          const Game::Audio::Midi::Sequence::Track::Channel*                            channel;      // Channel played
+          std::list<Game::Audio::Midi::Sequence::Track::Channel::Event>::const_iterator event;        // Next event to be played
+          Game::Audio::Synthesizer::Note                                                note;         // Current channel state
+          std::array<uint8_t, 128>                                                      polyphonics;  // Pressure on channel keys
+        };
+
+        Game::Audio::Synthesizer&                               _synthesizer; // Synthesizer providing soundfont and voice rendering
+        Game::Audio::Midi::Sequence                             _sequence;    // Sequence played, referenced by voices
+        std::vector<Game::Audio::Synthesizer::Stream::Channel>  _channels;    // State of every non-empty channel
+        std::vector<Game::Audio::Synthesizer::Voice>            _voices;      // Voices being played
+        std::vector<Game::Audio::Synthesizer::Voice>            _pressed;     // Voices of last pressed key, before allocation
+        std::size_t                                             _limit;       // Maximum number of voices played at the same time
+        std::size_t                                             _frame;       // Number of frames rendered since start of sequence
+
+        void  play(Game::Audio::Synthesizer::Stream::Channel& channel);  // Apply channel events up to current frame
+        void  allocate(Game::Audio::Synthesizer::Voice& voice);          // Add a voice, replacing the oldest one when limit is reached
+
+      public:
+        struct Statistics
+        {
+          std::size_t blocks;   // Number of blocks rendered
+          double      total;    // Time spent rendering blocks (seconds)
+          double      maximum;  // Longest time spent rendering a block (seconds)
+          std::size_t voices;   // Highest number of voices played at the same time
+          std::size_t stolen;   // Number of voices stopped early to respect limit
+          std::size_t skipped;  // Number of notes without preset and voices with invalid sample, not played
+        };
+
+        Stream(Game::Audio::Synthesizer& synthesizer, std::size_t sequenceId, std::size_t voices = 64);
+        Stream(const Game::Audio::Synthesizer::Stream&) = delete;
+        ~Stream() = default;
+
+        Game::Audio::Synthesizer::Stream::Statistics  statistics; // Rendering time and voice usage
+
+        bool  render(float* output, std::size_t frames);  // Fill stereo output with next frames of sequence, false once sequence and every voice have ended
+        float time() const;                               // Time of next frame to be rendered (seconds)
+      };
+
+      Synthesizer(const std::filesystem::path& midi, const std::filesystem::path& soundfont, std::size_t sampleRate = 22050, Game::Audio::Soundfont::Storage storage = Game::Audio::Soundfont::Storage::StorageFloat);
       ~Synthesizer() = default;
 
       Game::Audio::Midi       midi;
       Game::Audio::Soundfont  soundfont;
       
       std::vector<float>  generate(std::size_t sequenceId); // Generate music from MIDI sequence, 2 channel at given sample rate
+
+      std::size_t         sampleRate() const;               // Number of sample per second
+
+      static void benchmark(const std::filesystem::path& soundfont);                                  // Resample every sample of soundfont with scalar and vectorized voice rendering, report frames per second
+      static void benchmark(const std::filesystem::path& midi, const std::filesystem::path& soundfont); // Stream every sequence of MIDI file without output, report real-time factor and block rendering time
     };
   }
 }
\ No newline at end of file
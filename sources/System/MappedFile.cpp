@@ -0,0 +1,106 @@
+#include <stdexcept>
+#include <string>
+
+#ifdef _WIN32
+# include <windows.h>
+#else
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <sys/stat.h>
+# include <unistd.h>
+#endif
+
+#include "System/MappedFile.hpp"
+
+Game::MappedFile::MappedFile(const std::filesystem::path& filename) :
+#ifdef _WIN32
+  _file(INVALID_HANDLE_VALUE),
+  _mapping(nullptr),
+#else
+  _file(-1),
+#endif
+  _data(nullptr),
+  _size(0)
+{
+#ifdef _WIN32
+  ::LARGE_INTEGER size = {};
+
+  // Open file and get its size
+  _file = ::CreateFileW(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (_file == INVALID_HANDLE_VALUE || ::GetFileSizeEx(_file, &size) == FALSE) {
+    close();
+    throw std::runtime_error((std::string(__FILE__) + ": l." + std::to_string(__LINE__)).c_str());
+  }
+  _size = (std::size_t)size.QuadPart;
+
+  // Map whole file, read-only
+  if (_size > 0) {
+    _mapping = ::CreateFileMappingW(_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    _data = (_mapping != nullptr) ? (const std::uint8_t*)::MapViewOfFile(_mapping, FILE_MAP_READ, 0, 0, 0) : nullptr;
+    if (_data == nullptr) {
+      close();
+      throw std::runtime_error((std::string(__FILE__) + ": l." + std::to_string(__LINE__)).c_str());
+    }
+  }
+#else
+  struct ::stat status = {};
+
+  // Open file and get its size
+  _file = ::open(filename.c_str(), O_RDONLY);
+  if (_file == -1 || ::fstat(_file, &status) == -1) {
+    close();
+    throw std::runtime_error((std::string(__FILE__) + ": l." + std::to_string(__LINE__)).c_str());
+  }
+  _size = (std::size_t)status.st_size;
+
+  // Map whole file, read-only
+  if (_size > 0) {
+    void* data = ::mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, _file, 0);
+
+    if (data == MAP_FAILED) {
+      close();
+      throw std::runtime_error((std::string(__FILE__) + ": l." + std::to_string(__LINE__)).c_str());
+    }
+    _data = (const std::uint8_t*)data;
+  }
+#endif
+}
+
+Game::MappedFile::~MappedFile()
+{
+  close();
+}
+
+void  Game::MappedFile::close()
+{
+#ifdef _WIN32
+  // Unmap view and close handles
+  if (_data != nullptr)
+    ::UnmapViewOfFile(_data);
+  if (_mapping != nullptr)
+    ::CloseHandle(_mapping);
+  if (_file != INVALID_HANDLE_VALUE)
+    ::CloseHandle(_file);
+  _mapping = nullptr;
+  _file = INVALID_HANDLE_VALUE;
+#else
+  // Unmap file and close descriptor
+  if (_data != nullptr)
+    ::munmap((void*)_data, _size);
+  if (_file != -1)
+    ::close(_file);
+  _file = -1;
+#endif
+  _data = nullptr;
+  _size = 0;
+}
+
+const std::uint8_t* Game::MappedFile::data() const
+{
+  return _data;
+}
+
+std::size_t Game::MappedFile::size() const
+{
+  return _size;
+}
\ No newline at end of file
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+
+namespace Game
+{
+  class MappedFile  // Read-only memory mapping of a whole file, pages are loaded by the system on first access
+  {
+  private:
+#ifdef _WIN32
+    void*               _file;    // Handle of the file
+    void*               _mapping; // Handle of the file mapping
+#else
+    int                 _file;    // Descriptor of the file
+#endif
+    const std::uint8_t* _data;    // First byte of mapped file
+    std::size_t         _size;    // Size of mapped file in bytes
+
+    void  close();  // Unmap and close file, also used to clean up a failed constructor
+
+  public:
+    MappedFile(const std::filesystem::path& filename);
+    MappedFile(const Game::MappedFile&) = delete;
+    ~MappedFile();
+
+    Game::MappedFile& operator=(const Game::MappedFile&) = delete;
+
+    const std::uint8_t* data() const; // First byte of mapped file
+    std::size_t         size() const; // Size of mapped file in bytes
+  };
+}
\ No newline at end of file
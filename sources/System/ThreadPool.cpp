@@ -0,0 +1,172 @@
+#include <algorithm>
+
+#include "System/ThreadPool.hpp"
+
+thread_local Game::ThreadPool*  Game::ThreadPool::_pool = nullptr;
+thread_local std::size_t        Game::ThreadPool::_index = 0;
+
+Game::ThreadPool::ThreadPool(std::size_t threads) :
+  _queues(),
+  _threads(),
+  _lock(),
+  _wake(),
+  _done(),
+  _queued(0),
+  _pending(0),
+  _next(0),
+  _active(0),
+  _peak(0),
+  _stop(false)
+{
+  // At least one worker
+  threads = std::max<std::size_t>(threads, 1);
+
+  // Create a queue per worker before starting any of them
+  for (std::size_t index = 0; index < threads; index++)
+    _queues.push_back(std::make_unique<Game::ThreadPool::Queue>());
+
+  // Start workers
+  for (std::size_t index = 0; index < threads; index++)
+    _threads.emplace_back(&Game::ThreadPool::loop, this, index);
+}
+
+Game::ThreadPool::~ThreadPool()
+{
+  // Complete remaining jobs
+  wait();
+
+  // Stop workers
+  {
+    std::unique_lock  lock(_lock);
+
+    _stop = true;
+  }
+  _wake.notify_all();
+
+  // Wait for workers to exit
+  for (auto& thread : _threads)
+    thread.join();
+}
+
+void  Game::ThreadPool::loop(std::size_t index)
+{
+  // Register worker
+  _pool = this;
+  _index = index;
+
+  while (true)
+  {
+    // Run jobs while available
+    if (execute(index) == true)
+      continue;
+
+    std::unique_lock  lock(_lock);
+
+    // Sleep until a job is queued or pool is stopped
+    _wake.wait(lock, [this]() { return _stop == true || _queued > 0; });
+    if (_stop == true && _queued == 0)
+      return;
+  }
+}
+
+bool  Game::ThreadPool::execute(std::size_t index)
+{
+  Game::ThreadPool::Job job;
+
+  // Take most recent job of own queue, still hot in cache
+  if (index < _queues.size()) {
+    std::unique_lock  lock(_queues[index]->lock);
+
+    if (_queues[index]->jobs.empty() == false) {
+      job = std::move(_queues[index]->jobs.back());
+      _queues[index]->jobs.pop_back();
+    }
+  }
+
+  // Steal oldest job of other queues, usually the largest remaining work
+  for (std::size_t offset = 1; !job && offset <= _queues.size(); offset++) {
+    auto&             queue = *_queues[(index + offset) % _queues.size()];
+    std::unique_lock  lock(queue.lock);
+
+    if (queue.jobs.empty() == false) {
+      job = std::move(queue.jobs.front());
+      queue.jobs.pop_front();
+    }
+  }
+
+  // No job available
+  if (!job)
+    return false;
+
+  _queued--;
+
+  // Track concurrency
+  std::size_t active = ++_active;
+  std::size_t peak = _peak;
+
+  while (active > peak && _peak.compare_exchange_weak(peak, active) == false);
+
+  // Run job
+  job();
+
+  _active--;
+
+  // Signal waiting threads when last job completes
+  if (--_pending == 0) {
+    std::unique_lock  lock(_lock);
+
+    _done.notify_all();
+  }
+
+  return true;
+}
+
+void  Game::ThreadPool::push(Game::ThreadPool::Job job)
+{
+  // Workers push to their own queue, other threads spread jobs over workers
+  std::size_t index = (_pool == this) ? _index : (_next++ % _queues.size());
+
+  _pending++;
+
+  {
+    std::unique_lock  lock(_queues[index]->lock);
+
+    _queues[index]->jobs.push_back(std::move(job));
+  }
+
+  _queued++;
+
+  // Wake a sleeping worker, lock prevents a missed notification
+  {
+    std::unique_lock  lock(_lock);
+  }
+  _wake.notify_one();
+}
+
+void  Game::ThreadPool::wait()
+{
+  // Queue of calling thread, external threads only steal
+  std::size_t index = (_pool == this) ? _index : _queues.size();
+
+  while (_pending > 0)
+  {
+    // Help workers instead of sleeping
+    if (execute(index) == true)
+      continue;
+
+    std::unique_lock  lock(_lock);
+
+    // Every remaining job is running, sleep until completion or new jobs
+    _done.wait(lock, [this]() { return _pending == 0 || _queued > 0; });
+  }
+}
+
+std::size_t Game::ThreadPool::size() const
+{
+  return _threads.size();
+}
+
+std::size_t Game::ThreadPool::peak() const
+{
+  return _peak;
+}
\ No newline at end of file
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Game
+{
+  class ThreadPool  // Fixed number of workers, each with its own job queue, idle workers steal jobs from others
+  {
+  public:
+    using Job = std::function<void()>;
+
+  private:
+    struct Queue
+    {
+      std::mutex                        lock; // Lock of job queue
+      std::deque<Game::ThreadPool::Job> jobs; // Jobs pushed to worker, owner pops from back, thieves from front
+    };
+
+    std::vector<std::unique_ptr<Game::ThreadPool::Queue>> _queues;  // Job queue of each worker
+    std::vector<std::thread>                              _threads; // Worker threads
+    std::mutex                                            _lock;    // Lock for sleeping workers and waiting threads
+    std::condition_variable                               _wake;    // Signal new jobs or end of pool to workers
+    std::condition_variable                               _done;    // Signal completion of every job to waiting threads
+    std::atomic<std::size_t>                              _queued;  // Number of jobs in queues, not started yet
+    std::atomic<std::size_t>                              _pending; // Number of jobs pushed and not completed
+    std::atomic<std::size_t>                              _next;    // Round-robin index of queue for jobs pushed by external threads
+    std::atomic<std::size_t>                              _active;  // Number of threads currently running a job
+    std::atomic<std::size_t>                              _peak;    // Highest number of threads running a job at the same time
+    bool                                                  _stop;    // Workers should exit
+
+    static thread_local Game::ThreadPool* _pool;  // Pool of current worker thread, nullptr for external threads
+    static thread_local std::size_t       _index; // Queue index of current worker thread
+
+    void  loop(std::size_t index);    // Worker main loop
+    bool  execute(std::size_t index); // Run a job from given queue or stolen from another one, false if none available
+
+  public:
+    ThreadPool(std::size_t threads);
+    ~ThreadPool();
+
+    void  push(Game::ThreadPool::Job job);  // Queue a job, jobs pushed from a worker go to its own queue
+    void  wait();                           // Help running jobs until every job pushed is completed
+
+    std::size_t size() const; // Number of worker threads
+    std::size_t peak() const; // Highest number of threads running a job at the same time
+  };
+}
\ No newline at end of file
@@ -1,12 +1,18 @@
 #include <chrono>
 #include <iostream>
 #include <stdexcept>
+#include <string>
 
+#include "Doom/Demo.hpp"
+#include "Doom/Doom.hpp"
+#include "GameBoyColor/GameBoyColor.hpp"
 #include "Scenes/SplashScene.hpp"
 #include "Scenes/SceneMachine.hpp"
 #include "System/Config.hpp"
 #include "System/Window.hpp"
+#include "System/Audio/Pitch.hpp"
 #include "System/Audio/Sound.hpp"
+#include "System/Audio/Synthesizer.hpp"
 
 #ifdef _WIN32
 # include <windows.h>
@@ -30,6 +36,82 @@ namespace Game
   void  help()
   {}
 
+  bool  benchmark(int argc, char ** argv)
+  {
+    // Headless DOOM demo playback: --doom-timedemo <wad> <demo>
+    if (argc == 4 && std::string(argv[1]) == "--doom-timedemo") {
+      DOOM::Demo::benchmark(argv[2], argv[3]);
+      return true;
+    }
+
+    // DOOM sound propagation on every level: --doom-noise <wad>
+    if (argc == 3 && std::string(argv[1]) == "--doom-noise") {
+      DOOM::Doom::Level::Adjacency::benchmark(argv[2]);
+      return true;
+    }
+
+    // GBC emulation speed, accurate against fast CPU mode: --gbc-benchmark <rom>
+    if (argc == 3 && std::string(argv[1]) == "--gbc-benchmark") {
+      GBC::GameBoyColor::benchmark(argv[2], 60 * 60);
+      return true;
+    }
+
+    // GBC test ROM or regression run, fast CPU mode unless requested, per-frame profile on request: --gbc-headless <rom> <frames> [accurate] [profile]
+    if (argc >= 4 && argc <= 6 && std::string(argv[1]) == "--gbc-headless") {
+      int   index = 4;
+      bool  accurate = (index < argc && std::string(argv[index]) == "accurate");
+      bool  profile = (index + (accurate ? 1 : 0) < argc && std::string(argv[index + (accurate ? 1 : 0)]) == "profile");
+
+      // Optional flags, in order
+      index += (accurate ? 1 : 0) + (profile ? 1 : 0);
+      if (index == argc) {
+        if (GBC::GameBoyColor::headless(argv[2], std::stoull(argv[3]), accurate == true ? GBC::CentralProcessingUnit::Mode::ModeAccurate : GBC::CentralProcessingUnit::Mode::ModeFast, profile) == false)
+          throw std::runtime_error("GBC test ROM failed");
+        return true;
+      }
+    }
+
+    // GBC parallel regression runs, one "<rom> [script]" per line of list: --gbc-batch <list> <frames>
+    if (argc == 4 && std::string(argv[1]) == "--gbc-batch") {
+      GBC::GameBoyColor::batch(argv[2], std::stoull(argv[3]));
+      return true;
+    }
+
+    // GBC two emulators connected through link cable: --gbc-link <rom> <rom> <frames>
+    if (argc == 5 && std::string(argv[1]) == "--gbc-link") {
+      if (GBC::GameBoyColor::link(argv[2], argv[3], std::stoull(argv[4])) == false)
+        throw std::runtime_error("GBC link transfer late");
+      return true;
+    }
+
+    // Soundfont loading, float against mapped 16 bits samples: --soundfont-benchmark <soundfont>
+    if (argc == 3 && std::string(argv[1]) == "--soundfont-benchmark") {
+      Game::Audio::Soundfont::benchmark(argv[2]);
+      return true;
+    }
+
+    // Soundfont voice rendering, scalar against vectorized: --synthesizer-benchmark <soundfont>
+    if (argc == 3 && std::string(argv[1]) == "--synthesizer-benchmark") {
+      Game::Audio::Synthesizer::benchmark(argv[2]);
+      return true;
+    }
+
+    // Streaming MIDI rendering, real-time factor and block timing: --synthesizer-stream <midi> <soundfont>
+    if (argc == 4 && std::string(argv[1]) == "--synthesizer-stream") {
+      Game::Audio::Synthesizer::benchmark(argv[2], argv[3]);
+      return true;
+    }
+
+    // STFT pitch shifting, FFT and phase vocoder throughput: --pitch-benchmark
+    if (argc == 2 && std::string(argv[1]) == "--pitch-benchmark") {
+      Game::Audio::Vocoder::benchmark();
+      return true;
+    }
+
+    // No benchmark requested
+    return false;
+  }
+
   void  run()
   {
     Game::SceneMachine  game;
@@ -67,7 +149,10 @@ int main(int argc, char ** argv)
   try {
     Game::initialize(argc, argv);
     Game::help();
-    Game::run();
+
+    // Run benchmark instead of game if requested
+    if (Game::benchmark(argc, argv) == false)
+      Game::run();
   }
   catch (const std::exception& e) {
     std::cerr << "[Runtime Error]: " << e.what() << std::endl;